@@ -0,0 +1,96 @@
+//
+//  draco_depth_image_wrapper.h
+//  spacetime-mic
+//
+
+#ifndef draco_depth_image_wrapper_h
+#define draco_depth_image_wrapper_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Encodes depth camera frames as a depth image instead of a list of points
+// The decoder reconstructs the points of the valid pixels from the camera intrinsics
+@interface DracoDepthImageEncoder : NSObject
+
+// Create a new encoder
+- (instancetype)init;
+
+// Size of a depth quantization step in the units of the depth values (default 0.001)
+- (void)setDepthPrecision:(float)depthPrecision;
+
+// Number of interleaved rANS states (4 or 8) used to code the depths, 0 (default) uses the Draco symbol coding
+// Interleaved coding decodes faster, e.g. for playback of recorded depth streams
+- (void)setInterleavedSymbolCoding:(NSInteger)numStates;
+
+// Collect the statistics of the encoded depths for createSharedSymbolTableWithStates:
+- (void)setCollectsSymbolStatistics:(BOOL)collectsSymbolStatistics;
+
+// Create a symbol table from the depths encoded while collecting statistics and code the following frames with it
+// The frames no longer store their own table, store the returned table once per sequence (e.g. in the sequence
+// metadata) and pass it to DracoDepthImageDecoder before decoding the frames
+// numStates: Number of interleaved rANS states (4 or 8)
+// Returns nil if no statistics were collected, statistics collection stops either way
+- (nullable NSData *)createSharedSymbolTableWithStates:(NSInteger)numStates;
+
+// Code the following frames with a table returned by createSharedSymbolTableWithStates:, returns NO if it is invalid
+- (BOOL)setSharedSymbolTable:(NSData *)table;
+
+// Encode a depth image
+// depth: Pointer to the first row of float depths, e.g. the base address of a CVPixelBuffer
+// width, height: Size of the image in pixels
+// bytesPerRow: Distance between two consecutive rows in bytes
+// validMask: One byte per pixel in row-major order, nonzero for valid pixels
+//            If NULL, pixels with a finite positive depth are valid
+// fx, fy, cx, cy: Camera intrinsics in pixels
+// Returns NSData containing the encoded depth image, or nil on failure
+- (nullable NSData *)encodeDepth:(const float *)depth
+                           width:(NSInteger)width
+                          height:(NSInteger)height
+                     bytesPerRow:(NSInteger)bytesPerRow
+                       validMask:(nullable const uint8_t *)validMask
+                              fx:(float)fx
+                              fy:(float)fy
+                              cx:(float)cx
+                              cy:(float)cy;
+
+@end
+
+// Decodes depth images encoded by DracoDepthImageEncoder
+@interface DracoDepthImageDecoder : NSObject
+
+// Create a new decoder
+- (instancetype)init;
+
+// Set the shared symbol table of the sequence, required for frames encoded with a shared table
+// The decoding table is built once and used for all following frames, returns NO if the table is invalid
+- (BOOL)setSharedSymbolTable:(NSData *)table;
+
+// Decode the depth image, returns NO on failure
+- (BOOL)decode:(NSData *)data;
+
+// Size of the decoded image in pixels
+- (NSInteger)width;
+- (NSInteger)height;
+
+// Number of valid pixels, i.e. of decoded points
+- (NSInteger)numPoints;
+
+// Copy the decoded depths into destination, invalid pixels are set to 0
+// bytesPerRow: Distance between two consecutive rows in bytes
+- (void)copyDepthTo:(float *)destination bytesPerRow:(NSInteger)bytesPerRow;
+
+// Copy the points of the valid pixels as float triplets into destination
+// capacity: Maximum number of points that fit into destination
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns the number of copied points
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* draco_depth_image_wrapper_h */
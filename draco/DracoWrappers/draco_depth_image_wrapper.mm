@@ -0,0 +1,179 @@
+//
+//  draco_depth_image_wrapper.mm
+//  spacetime-mic
+//
+
+#import <Foundation/Foundation.h>
+#import "draco_depth_image_wrapper.h"
+#import "draco_encoded_data.h"
+
+#include <memory>
+
+// Include the Draco headers
+#include "../compression/point_cloud/depth_image_decoder.h"
+#include "../compression/point_cloud/depth_image_encoder.h"
+#include "../core/status.h"
+
+// Private class extension to hold the C++ objects
+@interface DracoDepthImageEncoder () {
+    std::unique_ptr<draco::DepthImageEncoder> _encoder;
+    draco::EncoderBuffer _buffer;
+    draco::InterleavedSymbolHistogram _symbolHistogram;
+}
+@end
+
+@implementation DracoDepthImageEncoder
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _encoder.reset(new draco::DepthImageEncoder());
+    }
+    return self;
+}
+
+- (void)setDepthPrecision:(float)depthPrecision {
+    _encoder->SetDepthPrecision(depthPrecision);
+}
+
+- (void)setInterleavedSymbolCoding:(NSInteger)numStates {
+    _encoder->SetInterleavedSymbolCoding(static_cast<int>(numStates));
+}
+
+- (void)setCollectsSymbolStatistics:(BOOL)collectsSymbolStatistics {
+    _encoder->SetSymbolHistogram(collectsSymbolStatistics ? &_symbolHistogram : nullptr);
+}
+
+- (nullable NSData *)createSharedSymbolTableWithStates:(NSInteger)numStates {
+    _encoder->SetSymbolHistogram(nullptr);
+    draco::InterleavedRAnsTable table;
+    const bool ok = !_symbolHistogram.empty() &&
+                    _symbolHistogram.CreateTable(static_cast<int>(numStates), &table) &&
+                    _encoder->SetSharedSymbolTable(table);
+    _symbolHistogram.Clear();
+    if (!ok) {
+        return nil;
+    }
+    
+    draco::EncoderBuffer buffer;
+    table.Encode(&buffer);
+    return DracoTakeEncodedData(&buffer, false);
+}
+
+- (BOOL)setSharedSymbolTable:(NSData *)table {
+    if (!table) {
+        return NO;
+    }
+    
+    draco::DecoderBuffer buffer;
+    buffer.Init(static_cast<const char *>(table.bytes), table.length);
+    draco::InterleavedRAnsTable sharedTable;
+    return sharedTable.Decode(&buffer) && _encoder->SetSharedSymbolTable(sharedTable);
+}
+
+- (nullable NSData *)encodeDepth:(const float *)depth
+                           width:(NSInteger)width
+                          height:(NSInteger)height
+                     bytesPerRow:(NSInteger)bytesPerRow
+                       validMask:(nullable const uint8_t *)validMask
+                              fx:(float)fx
+                              fy:(float)fy
+                              cx:(float)cx
+                              cy:(float)cy {
+    if (!depth || width <= 0 || height <= 0) {
+        return nil;
+    }
+    
+    draco::DepthImageCamera camera;
+    camera.width = static_cast<int>(width);
+    camera.height = static_cast<int>(height);
+    camera.fx = fx;
+    camera.fy = fy;
+    camera.cx = cx;
+    camera.cy = cy;
+    _buffer.Clear();
+    const draco::Status status = _encoder->EncodeDepthImage(
+        depth, bytesPerRow, validMask, camera, &_buffer);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to encode depth image: %s", status.error_msg());
+        return nil;
+    }
+    
+    return DracoTakeEncodedData(&_buffer, true);
+}
+
+@end
+
+// Private class extension to hold the C++ object
+@interface DracoDepthImageDecoder () {
+    std::unique_ptr<draco::DepthImageDecoder> _decoder;
+}
+@end
+
+@implementation DracoDepthImageDecoder
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _decoder.reset(new draco::DepthImageDecoder());
+    }
+    return self;
+}
+
+- (BOOL)setSharedSymbolTable:(NSData *)table {
+    if (!table) {
+        return NO;
+    }
+    
+    draco::DecoderBuffer buffer;
+    buffer.Init(static_cast<const char *>(table.bytes), table.length);
+    draco::InterleavedRAnsTable sharedTable;
+    return sharedTable.Decode(&buffer) && _decoder->SetSharedSymbolTable(sharedTable);
+}
+
+- (BOOL)decode:(NSData *)data {
+    if (!data) {
+        return NO;
+    }
+    
+    draco::DecoderBuffer buffer;
+    buffer.Init(static_cast<const char *>(data.bytes), data.length);
+    const draco::Status status = _decoder->DecodeDepthImage(&buffer);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to decode depth image: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (NSInteger)width {
+    return _decoder->camera().width;
+}
+
+- (NSInteger)height {
+    return _decoder->camera().height;
+}
+
+- (NSInteger)numPoints {
+    return static_cast<NSInteger>(_decoder->num_points());
+}
+
+- (void)copyDepthTo:(float *)destination bytesPerRow:(NSInteger)bytesPerRow {
+    if (!destination) {
+        return;
+    }
+    _decoder->GetDepthImage(destination, bytesPerRow);
+}
+
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride {
+    if (!destination || capacity <= 0) {
+        return 0;
+    }
+    return static_cast<NSInteger>(_decoder->GetPositions(
+        static_cast<float *>(destination), byteStride,
+        static_cast<size_t>(capacity)));
+}
+
+@end
@@ -0,0 +1,31 @@
+//
+//  draco_encoded_data.h
+//  spacetime-mic
+//
+
+#ifndef draco_encoded_data_h
+#define draco_encoded_data_h
+
+#import <Foundation/Foundation.h>
+
+#include <vector>
+
+#include "../core/encoder_buffer.h"
+
+// Returns the content of an encoder buffer as NSData without copying it
+// The storage of the buffer is handed over to the NSData and freed with it, the buffer is left empty
+// keepCapacity: Reserve the previous capacity again, for buffers that are reused for the next frame
+static inline NSData *DracoTakeEncodedData(draco::EncoderBuffer *buffer, bool keepCapacity) {
+    std::vector<char> *storage = new std::vector<char>();
+    storage->swap(*buffer->buffer());
+    if (keepCapacity) {
+        buffer->buffer()->reserve(storage->capacity());
+    }
+    return [[NSData alloc] initWithBytesNoCopy:storage->data()
+                                        length:storage->size()
+                                   deallocator:^(void *bytes, NSUInteger length) {
+        delete storage;
+    }];
+}
+
+#endif /* draco_encoded_data_h */
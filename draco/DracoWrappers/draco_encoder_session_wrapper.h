@@ -0,0 +1,51 @@
+//
+//  draco_encoder_session_wrapper.h
+//  spacetime-mic
+//
+
+#ifndef draco_encoder_session_wrapper_h
+#define draco_encoder_session_wrapper_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Long-lived encoder for a sequence of point cloud frames
+// Keeps the point cloud, encoder options and output buffer alive between frames
+// Not thread safe, use it from a single serial queue
+@interface DracoEncoderSession : NSObject
+
+// Create a new session
+- (instancetype)init;
+
+// Set the speed options for encoding and decoding
+// Setting the same values again is free, so this can be called before every frame
+- (void)setSpeedOptions:(int)encodingSpeed decodingSpeed:(int)decodingSpeed;
+
+// Set quantization (compression) for a specific attribute type
+- (void)setAttributeQuantization:(NSInteger)type bits:(int)quantizationBits;
+
+// Set the encoding method to be used
+- (void)setEncodingMethod:(int)method;
+
+// Grow the internal storage up front so that frames with up to maxNumPoints
+// points don't allocate while encoding
+- (void)reserveForMaxPoints:(NSInteger)maxNumPoints;
+
+// Encode a frame of float positions
+// bytes: Pointer to the first point, e.g. the base address of a [SIMD3<Float>] array
+// count: Number of points
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns NSData containing the encoded frame, or nil on failure
+- (nullable NSData *)encodePositions:(const void *)bytes
+                               count:(NSInteger)count
+                          byteStride:(NSInteger)byteStride;
+
+// Number of frames encoded by this session
+- (NSInteger)numEncodedFrames;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* draco_encoder_session_wrapper_h */
@@ -0,0 +1,91 @@
+//
+//  draco_encoder_session_wrapper.mm
+//  spacetime-mic
+//
+
+#import <Foundation/Foundation.h>
+#import "draco_encoder_session_wrapper.h"
+#import "draco_encoded_data.h"
+
+// Include the Draco headers
+#include "../compression/encoder_session.h"
+#include "../attributes/geometry_attribute.h"
+#include "../core/status.h"
+
+// Private class extension to hold the C++ object
+@interface DracoEncoderSession () {
+    draco::EncoderSession* _session;
+    draco::EncoderBuffer _buffer;
+}
+@end
+
+@implementation DracoEncoderSession
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _session = new draco::EncoderSession();
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_session) {
+        delete _session;
+        _session = nullptr;
+    }
+}
+
+- (void)setSpeedOptions:(int)encodingSpeed decodingSpeed:(int)decodingSpeed {
+    if (_session) {
+        _session->SetSpeedOptions(encodingSpeed, decodingSpeed);
+    }
+}
+
+- (void)setAttributeQuantization:(NSInteger)type bits:(int)quantizationBits {
+    if (_session) {
+        _session->SetAttributeQuantization(
+            static_cast<draco::GeometryAttribute::Type>(type),
+            quantizationBits);
+    }
+}
+
+- (void)setEncodingMethod:(int)method {
+    if (_session) {
+        _session->SetEncodingMethod(method);
+    }
+}
+
+- (void)reserveForMaxPoints:(NSInteger)maxNumPoints {
+    if (_session && maxNumPoints > 0) {
+        _session->Reserve(static_cast<draco::PointIndex::ValueType>(maxNumPoints));
+        // The raw size of the positions is an upper estimate of a frame
+        _buffer.buffer()->reserve(static_cast<size_t>(maxNumPoints) * 3 * sizeof(float));
+    }
+}
+
+- (nullable NSData *)encodePositions:(const void *)bytes
+                               count:(NSInteger)count
+                          byteStride:(NSInteger)byteStride {
+    if (!_session || !bytes || count <= 0) {
+        return nil;
+    }
+    
+    const draco::Status status = _session->EncodePositions(
+        static_cast<const float *>(bytes),
+        static_cast<draco::PointIndex::ValueType>(count), byteStride, &_buffer);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to encode frame: %s", status.error_msg());
+        return nil;
+    }
+    
+    // The frame is encoded into a buffer of the wrapper, whose storage is
+    // handed over to NSData without copying it
+    return DracoTakeEncodedData(&_buffer, true);
+}
+
+- (NSInteger)numEncodedFrames {
+    return _session ? static_cast<NSInteger>(_session->num_encoded_frames()) : 0;
+}
+
+@end
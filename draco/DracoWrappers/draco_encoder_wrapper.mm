@@ -9,6 +9,7 @@
 #import <objc/runtime.h> // For Objective-C runtime functions
 #import "draco_encoder_wrapper.h"
 #import "draco_point_cloud_wrapper.h"
+#import "draco_encoded_data.h"
 
 // Include the Draco headers
 #include "../compression/encode.h"
@@ -68,8 +69,8 @@
         return nil;
     }
     
-    // Create NSData from the buffer
-    return [NSData dataWithBytes:buffer.data() length:buffer.size()];
+    // Hand the encoded data over to NSData without copying it
+    return DracoTakeEncodedData(&buffer, false);
 }
 
 - (void)setSpeedOptions:(int)encodingSpeed decodingSpeed:(int)decodingSpeed {
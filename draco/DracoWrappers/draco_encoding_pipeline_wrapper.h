@@ -0,0 +1,87 @@
+//
+//  draco_encoding_pipeline_wrapper.h
+//  spacetime-mic
+//
+
+#ifndef draco_encoding_pipeline_wrapper_h
+#define draco_encoding_pipeline_wrapper_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// What happens to a submitted frame when the input queue is full
+typedef NS_ENUM(NSInteger, DracoEncodingQueuePolicy) {
+    // Wait until a worker takes a frame from the queue
+    DracoEncodingQueuePolicyBlock = 0,
+    // Drop the submitted frame
+    DracoEncodingQueuePolicyDropNewest = 1,
+    // Drop the oldest queued frame
+    DracoEncodingQueuePolicyDropOldest = 2,
+};
+
+// Called for each encoded frame in submission order on the writer thread of the pipeline
+// data: Encoded frame, only valid during the call (copy it to keep it)
+// timestamp: Timestamp passed to submitPositions in seconds
+// keyFrame: Whether the frame can be decoded without the preceding frames
+// Return NO to report a write error
+typedef BOOL (^DracoEncodedFrameHandler)(NSData *data, NSTimeInterval timestamp, BOOL keyFrame);
+
+// Encodes frames on a pool of worker threads with a bounded input queue
+// Encoded frames are passed to the frame handler in the order they were submitted
+@interface DracoEncodingPipeline : NSObject
+
+// Create a pipeline and start its threads
+// workers: Number of encoding threads (with temporal prediction they encode the parts of each frame)
+// queueCapacity: Maximum number of frames waiting for a worker
+// temporalPrediction: Code frames with DracoSequenceEncoder instead of independent point clouds
+// keyFrameInterval: Maximum distance between two key frames with temporal prediction
+- (instancetype)initWithWorkers:(NSInteger)workers
+                  queueCapacity:(NSInteger)queueCapacity
+                    queuePolicy:(DracoEncodingQueuePolicy)queuePolicy
+             temporalPrediction:(BOOL)temporalPrediction
+               keyFrameInterval:(int)keyFrameInterval
+               quantizationBits:(int)quantizationBits
+                   frameHandler:(DracoEncodedFrameHandler)frameHandler;
+
+// Queue a frame of float positions, the positions are copied
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns NO if the frame was dropped
+- (BOOL)submitPositions:(const void *)bytes
+                  count:(NSInteger)count
+             byteStride:(NSInteger)byteStride
+              timestamp:(NSTimeInterval)timestamp;
+
+// Wait until all queued frames were passed to the frame handler
+// Returns NO if encoding or writing of any frame failed
+- (BOOL)flush;
+
+// Flush and stop all threads, no frames can be submitted afterwards
+- (BOOL)close;
+
+// Number of frames waiting for a worker
+- (NSInteger)queueDepth;
+
+// Number of dropped frames
+- (NSInteger)numDroppedFrames;
+
+// Number of frames passed to the frame handler
+- (NSInteger)numWrittenFrames;
+
+// Average time in seconds a frame waited in the queue
+- (NSTimeInterval)averageQueueLatency;
+
+// Average time in seconds needed to encode a frame
+- (NSTimeInterval)averageEncodeLatency;
+
+// Average time in seconds a frame waited for the preceding frames to be written
+- (NSTimeInterval)averageReorderLatency;
+
+// Average time in seconds spent in the frame handler
+- (NSTimeInterval)averageWriteLatency;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* draco_encoding_pipeline_wrapper_h */
@@ -0,0 +1,134 @@
+//
+//  draco_encoding_pipeline_wrapper.mm
+//  spacetime-mic
+//
+
+#import <Foundation/Foundation.h>
+#import "draco_encoding_pipeline_wrapper.h"
+
+#include <cmath>
+#include <memory>
+
+// Include the Draco headers
+#include "../compression/frame_encoding_pipeline.h"
+#include "../core/status.h"
+
+// Private class extension to hold the C++ object
+@interface DracoEncodingPipeline () {
+    std::unique_ptr<draco::FrameEncodingPipeline> _pipeline;
+}
+@end
+
+@implementation DracoEncodingPipeline
+
+- (instancetype)initWithWorkers:(NSInteger)workers
+                  queueCapacity:(NSInteger)queueCapacity
+                    queuePolicy:(DracoEncodingQueuePolicy)queuePolicy
+             temporalPrediction:(BOOL)temporalPrediction
+               keyFrameInterval:(int)keyFrameInterval
+               quantizationBits:(int)quantizationBits
+                   frameHandler:(DracoEncodedFrameHandler)frameHandler {
+    self = [super init];
+    if (self) {
+        draco::FrameEncodingPipelineOptions options;
+        options.num_workers = static_cast<int>(workers);
+        options.queue_capacity = static_cast<int>(queueCapacity);
+        options.queue_policy = static_cast<draco::FrameEncodingQueuePolicy>(queuePolicy);
+        options.temporal_prediction = temporalPrediction;
+        options.key_frame_interval = keyFrameInterval;
+        options.position_quantization_bits = quantizationBits;
+        // Split frames into about two subtrees per worker to balance the load
+        if (temporalPrediction) {
+            while (options.subtree_depth < 6 &&
+                   (1 << options.subtree_depth) < 2 * options.num_workers) {
+                ++options.subtree_depth;
+            }
+        }
+        
+        // The handler is copied into the sink, it must not reference the
+        // pipeline itself to avoid a retain cycle
+        DracoEncodedFrameHandler handler = [frameHandler copy];
+        _pipeline.reset(new draco::FrameEncodingPipeline(
+            options, [handler](const draco::EncodedFrame &frame) {
+                @autoreleasepool {
+                    // Borrow the encoded data for the duration of the call
+                    NSData *data = [[NSData alloc]
+                        initWithBytesNoCopy:const_cast<char *>(frame.data)
+                                     length:frame.size
+                               freeWhenDone:NO];
+                    if (!handler(data, frame.timestamp_us / 1e6, frame.is_key_frame)) {
+                        return draco::Status(draco::Status::IO_ERROR,
+                                             "Failed to write frame.");
+                    }
+                }
+                return draco::OkStatus();
+            }));
+    }
+    return self;
+}
+
+- (BOOL)submitPositions:(const void *)bytes
+                  count:(NSInteger)count
+             byteStride:(NSInteger)byteStride
+              timestamp:(NSTimeInterval)timestamp {
+    if (!_pipeline || !bytes || count <= 0) {
+        return NO;
+    }
+    return _pipeline->SubmitFrame(static_cast<const float *>(bytes),
+                                  static_cast<size_t>(count), byteStride,
+                                  static_cast<int64_t>(std::llround(timestamp * 1e6)));
+}
+
+- (BOOL)flush {
+    if (!_pipeline) {
+        return NO;
+    }
+    const draco::Status status = _pipeline->Flush();
+    if (!status.ok()) {
+        NSLog(@"Error: Encoding pipeline failed: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (BOOL)close {
+    if (!_pipeline) {
+        return NO;
+    }
+    const draco::Status status = _pipeline->Close();
+    if (!status.ok()) {
+        NSLog(@"Error: Encoding pipeline failed: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (NSInteger)queueDepth {
+    return _pipeline ? _pipeline->GetStats().queue_depth : 0;
+}
+
+- (NSInteger)numDroppedFrames {
+    return _pipeline ? static_cast<NSInteger>(_pipeline->GetStats().num_dropped_frames) : 0;
+}
+
+- (NSInteger)numWrittenFrames {
+    return _pipeline ? static_cast<NSInteger>(_pipeline->GetStats().num_written_frames) : 0;
+}
+
+- (NSTimeInterval)averageQueueLatency {
+    return _pipeline ? _pipeline->GetStats().queue_wait.average_us() / 1e6 : 0;
+}
+
+- (NSTimeInterval)averageEncodeLatency {
+    return _pipeline ? _pipeline->GetStats().encode.average_us() / 1e6 : 0;
+}
+
+- (NSTimeInterval)averageReorderLatency {
+    return _pipeline ? _pipeline->GetStats().reorder_wait.average_us() / 1e6 : 0;
+}
+
+- (NSTimeInterval)averageWriteLatency {
+    return _pipeline ? _pipeline->GetStats().write.average_us() / 1e6 : 0;
+}
+
+@end
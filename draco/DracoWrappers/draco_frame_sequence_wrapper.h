@@ -0,0 +1,95 @@
+//
+//  draco_frame_sequence_wrapper.h
+//  spacetime-mic
+//
+
+#ifndef draco_frame_sequence_wrapper_h
+#define draco_frame_sequence_wrapper_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Codec of the frames stored in a sequence file
+typedef NS_ENUM(NSInteger, DracoFrameSequenceCodec) {
+    // Every frame is an independent Draco point cloud (DracoEncoder)
+    DracoFrameSequenceCodecDraco = 0,
+    // Frames are coded with temporal prediction (DracoSequenceEncoder)
+    DracoFrameSequenceCodecSequence = 1,
+};
+
+// Writes encoded frames into a single .drcseq file
+// Frames are appended as they arrive, the frame index is written by finish
+// Not thread safe, use it from a single serial queue
+@interface DracoFrameSequenceWriter : NSObject
+
+// Create a new sequence file at path, replacing any existing file
+// Returns nil if the file can't be created
+- (nullable instancetype)initWithPath:(NSString *)path frameRate:(double)frameRate;
+
+// Same as above, for frames encoded with the given codec
+- (nullable instancetype)initWithPath:(NSString *)path
+                            frameRate:(double)frameRate
+                                codec:(DracoFrameSequenceCodec)codec;
+
+// Append an encoded frame
+// timestamp: Presentation time of the frame in seconds from the start of the recording
+- (BOOL)appendFrame:(NSData *)data timestamp:(NSTimeInterval)timestamp;
+
+// Append an encoded frame that is a key frame or depends on the previous frame
+- (BOOL)appendFrame:(NSData *)data
+          timestamp:(NSTimeInterval)timestamp
+           keyFrame:(BOOL)keyFrame;
+
+// Set metadata stored with the sequence (e.g. JSON), written by finish
+- (void)setMetadata:(NSData *)metadata;
+
+// Write the frame index and close the file, no frames can be appended afterwards
+- (BOOL)finish;
+
+// Number of appended frames
+- (NSInteger)numFrames;
+
+// Current size of the file in bytes
+- (uint64_t)fileSize;
+
+@end
+
+// Reads frames from a .drcseq file
+// The file is memory-mapped, frame data references the mapping instead of a copy of the encoded frame
+@interface DracoFrameSequenceReader : NSObject
+
+// Open the sequence file at path
+// Returns nil if the file is not a valid sequence
+- (nullable instancetype)initWithPath:(NSString *)path;
+
+// Number of frames in the sequence
+- (NSInteger)numFrames;
+
+// Nominal frame rate of the sequence, 0 if unknown
+- (double)frameRate;
+
+// Codec of the frames in the sequence
+- (DracoFrameSequenceCodec)codec;
+
+// Whether the frame at index can be decoded without the preceding frames
+- (BOOL)isKeyFrameAtIndex:(NSInteger)index;
+
+// Encoded data of the frame at index
+// The data points into the file mapping and keeps the reader alive
+- (nullable NSData *)frameDataAtIndex:(NSInteger)index;
+
+// Presentation time of the frame at index in seconds
+- (NSTimeInterval)timestampAtIndex:(NSInteger)index;
+
+// Index of the last frame with a timestamp not greater than timestamp
+- (NSInteger)frameIndexForTimestamp:(NSTimeInterval)timestamp;
+
+// Metadata stored with the sequence, nil if there is none
+- (nullable NSData *)metadata;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* draco_frame_sequence_wrapper_h */
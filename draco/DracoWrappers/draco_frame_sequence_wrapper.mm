@@ -0,0 +1,182 @@
+//
+//  draco_frame_sequence_wrapper.mm
+//  spacetime-mic
+//
+
+#import <Foundation/Foundation.h>
+#import "draco_frame_sequence_wrapper.h"
+
+#include <cmath>
+#include <memory>
+
+// Include the Draco headers
+#include "../io/frame_sequence_reader.h"
+#include "../io/frame_sequence_writer.h"
+
+static int64_t DracoTimestampToMicroseconds(NSTimeInterval timestamp) {
+    return static_cast<int64_t>(std::llround(timestamp * 1e6));
+}
+
+// Private class extension to hold the C++ object
+@interface DracoFrameSequenceWriter () {
+    std::unique_ptr<draco::FrameSequenceWriter> _writer;
+}
+@end
+
+@implementation DracoFrameSequenceWriter
+
+- (nullable instancetype)initWithPath:(NSString *)path frameRate:(double)frameRate {
+    return [self initWithPath:path frameRate:frameRate codec:DracoFrameSequenceCodecDraco];
+}
+
+- (nullable instancetype)initWithPath:(NSString *)path
+                            frameRate:(double)frameRate
+                                codec:(DracoFrameSequenceCodec)codec {
+    self = [super init];
+    if (self) {
+        auto statusOr = draco::FrameSequenceWriter::Create(
+            path.UTF8String, frameRate, static_cast<draco::FrameSequenceCodec>(codec));
+        if (!statusOr.ok()) {
+            NSLog(@"Error: Failed to create frame sequence: %s", statusOr.status().error_msg());
+            return nil;
+        }
+        _writer = std::move(statusOr).value();
+    }
+    return self;
+}
+
+- (BOOL)appendFrame:(NSData *)data timestamp:(NSTimeInterval)timestamp {
+    return [self appendFrame:data timestamp:timestamp keyFrame:YES];
+}
+
+- (BOOL)appendFrame:(NSData *)data
+          timestamp:(NSTimeInterval)timestamp
+           keyFrame:(BOOL)keyFrame {
+    if (!_writer || !data) {
+        return NO;
+    }
+    const draco::Status status = _writer->AppendFrame(
+        static_cast<const char *>(data.bytes), data.length,
+        DracoTimestampToMicroseconds(timestamp),
+        keyFrame ? draco::FRAME_SEQUENCE_FLAG_KEYFRAME : 0);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to append frame: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (void)setMetadata:(NSData *)metadata {
+    if (_writer && metadata) {
+        _writer->SetMetadata(static_cast<const char *>(metadata.bytes), metadata.length);
+    }
+}
+
+- (BOOL)finish {
+    if (!_writer) {
+        return NO;
+    }
+    const draco::Status status = _writer->Finalize();
+    _writer.reset();
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to finish frame sequence: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (NSInteger)numFrames {
+    return _writer ? static_cast<NSInteger>(_writer->num_frames()) : 0;
+}
+
+- (uint64_t)fileSize {
+    return _writer ? _writer->file_size() : 0;
+}
+
+@end
+
+// Private class extension to hold the C++ object
+@interface DracoFrameSequenceReader () {
+    std::unique_ptr<draco::FrameSequenceReader> _reader;
+}
+@end
+
+@implementation DracoFrameSequenceReader
+
+- (nullable instancetype)initWithPath:(NSString *)path {
+    self = [super init];
+    if (self) {
+        auto statusOr = draco::FrameSequenceReader::Open(path.UTF8String);
+        if (!statusOr.ok()) {
+            NSLog(@"Error: Failed to open frame sequence: %s", statusOr.status().error_msg());
+            return nil;
+        }
+        _reader = std::move(statusOr).value();
+    }
+    return self;
+}
+
+- (NSInteger)numFrames {
+    return static_cast<NSInteger>(_reader->num_frames());
+}
+
+- (double)frameRate {
+    return _reader->frame_rate();
+}
+
+- (DracoFrameSequenceCodec)codec {
+    return static_cast<DracoFrameSequenceCodec>(_reader->codec());
+}
+
+- (BOOL)isKeyFrameAtIndex:(NSInteger)index {
+    if (index < 0 || index >= self.numFrames) {
+        return NO;
+    }
+    return (_reader->GetIndexEntry(static_cast<size_t>(index)).flags &
+            draco::FRAME_SEQUENCE_FLAG_KEYFRAME) != 0;
+}
+
+// Wraps memory of the reader without copying it, the deallocator keeps the
+// mapping alive for as long as the data is referenced
+- (NSData *)borrowedDataWithBytes:(const char *)bytes length:(size_t)length {
+    DracoFrameSequenceReader *owner = self;
+    return [[NSData alloc] initWithBytesNoCopy:const_cast<char *>(bytes)
+                                        length:length
+                                   deallocator:^(void *data, NSUInteger dataLength) {
+        (void)owner;
+    }];
+}
+
+- (nullable NSData *)frameDataAtIndex:(NSInteger)index {
+    if (index < 0) {
+        return nil;
+    }
+    auto statusOr = _reader->GetFrame(static_cast<size_t>(index));
+    if (!statusOr.ok()) {
+        return nil;
+    }
+    const draco::FrameSequenceFrame &frame = statusOr.value();
+    return [self borrowedDataWithBytes:frame.data length:frame.size];
+}
+
+- (NSTimeInterval)timestampAtIndex:(NSInteger)index {
+    if (index < 0 || index >= self.numFrames) {
+        return 0;
+    }
+    return _reader->GetIndexEntry(static_cast<size_t>(index)).timestamp_us / 1e6;
+}
+
+- (NSInteger)frameIndexForTimestamp:(NSTimeInterval)timestamp {
+    return static_cast<NSInteger>(
+        _reader->FindFrame(DracoTimestampToMicroseconds(timestamp)));
+}
+
+- (nullable NSData *)metadata {
+    if (!_reader->metadata()) {
+        return nil;
+    }
+    return [self borrowedDataWithBytes:_reader->metadata()
+                                length:_reader->metadata_size()];
+}
+
+@end
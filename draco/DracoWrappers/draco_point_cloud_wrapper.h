@@ -41,11 +41,32 @@ NS_ASSUME_NONNULL_BEGIN
 // Returns YES if successful, NO otherwise
 - (BOOL)setFloatAttributeData:(NSInteger)attributeId data:(NSData *)floatData;
 
+// Set attribute data directly from caller memory without any repacking
+// bytes: Pointer to the first point, e.g. the base address of a [SIMD3<Float>] array
+// count: Number of points, must match numPoints
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns YES if successful, NO otherwise
+- (BOOL)setFloatAttributeData:(NSInteger)attributeId
+                        bytes:(const void *)bytes
+                        count:(NSInteger)count
+                   byteStride:(NSInteger)byteStride;
+
 // Get the position attribute data as an array of floats
 // Returns nil if there is no position attribute or if the data cannot be accessed
 // The returned data is organized as [x1,y1,z1,x2,y2,z2,...]
+// The data is a copy and stays valid when the positions change; use
+// copyPositionsTo:capacity:byteStride: to avoid the allocation
 - (nullable NSData *)getPositionData;
 
+// Copy the positions into caller memory in a single pass
+// destination: Pointer to the first point, e.g. the base address of a [SIMD3<Float>] array
+// capacity: Number of points the destination can hold
+// byteStride: Distance between two consecutive points in bytes (0 means tightly packed)
+// Returns the number of copied points, or -1 on error
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride;
+
 @end
 
 NS_ASSUME_NONNULL_END
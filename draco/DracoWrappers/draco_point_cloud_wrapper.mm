@@ -106,19 +106,7 @@
         return NO;
     }
     
-    // Get the attribute - ensure we cast it as draco::GeometryAttribute to match API
-    draco::GeometryAttribute* attribute = static_cast<draco::GeometryAttribute*>(_pointCloud->attribute(static_cast<int32_t>(attributeId)));
-    if (!attribute) {
-        NSLog(@"Error: Could not get attribute %ld", (long)attributeId);
-        return NO;
-    }
-    
-    // Verify we're working with float data
-    if (attribute->data_type() != draco::DT_FLOAT32) {
-        NSLog(@"Error: Attribute is not of float type");
-        return NO;
-    }
-    
+    const draco::PointAttribute *attribute = _pointCloud->attribute(static_cast<int32_t>(attributeId));
     const size_t numComponents = attribute->num_components();
     const size_t numPoints = _pointCloud->num_points();
     const size_t expectedDataSize = numPoints * numComponents * sizeof(float);
@@ -128,99 +116,41 @@
         return NO;
     }
     
-    // Get raw pointer to the float data
-    const float *floatValues = static_cast<const float *>(floatData.bytes);
-    
-    NSLog(@"Setting attribute data for %zu points with %zu components each", numPoints, numComponents);
+    // Tightly packed input, copied into the attribute with a single memcpy
+    return [self setFloatAttributeData:attributeId
+                                 bytes:floatData.bytes
+                                 count:static_cast<NSInteger>(numPoints)
+                            byteStride:static_cast<NSInteger>(numComponents * sizeof(float))];
+}
+
+- (BOOL)setFloatAttributeData:(NSInteger)attributeId
+                        bytes:(const void *)bytes
+                        count:(NSInteger)count
+                   byteStride:(NSInteger)byteStride {
+    if (!_pointCloud || attributeId < 0 || attributeId >= _pointCloud->num_attributes() || !bytes || count < 0) {
+        NSLog(@"Error: Invalid inputs to setFloatAttributeData");
+        return NO;
+    }
     
-    // For each point, we'll use the appropriate API to set the attribute value
-    bool success = true;
+    draco::PointAttribute *attribute = _pointCloud->attribute(static_cast<int32_t>(attributeId));
     
-    // Set the attribute values point by point
-    for (uint32_t pointId = 0; pointId < numPoints; pointId++) {
-        const float *pointValues = floatValues + (pointId * numComponents);
-        
-        // Method 1: Use direct data buffer access
-        try {
-            // Get the attribute value index using the PointAttribute's methods
-            uint32_t valueIndex = pointId;  // Identity mapping
-            
-            // Cast as PointAttribute for access to GetAddress method
-            draco::PointAttribute* pointAttr = static_cast<draco::PointAttribute*>(attribute);
-            uint8_t* dstAddress = pointAttr->GetAddress(draco::AttributeValueIndex(valueIndex));
-            
-            // If GetAddress fails, try an alternate approach
-            if (!dstAddress && pointId == 0) {
-                NSLog(@"GetAddress returned null, trying alternate approach");
-                
-                // Try to get the buffer directly and use stride-based indexing
-                if (pointAttr->buffer() && pointAttr->buffer()->data()) {
-                    NSLog(@"Using direct buffer approach");
-                    
-                    uint8_t* bufferStart = const_cast<uint8_t*>(pointAttr->buffer()->data());
-                    size_t stride = pointAttr->byte_stride();
-                    
-                    // Copy point data to the appropriate buffer location
-                    for (uint32_t i = 0; i < numPoints; i++) {
-                        const float *srcPoint = floatValues + (i * numComponents);
-                        float *dstPoint = reinterpret_cast<float*>(bufferStart + i * stride);
-                        
-                        // Copy each component
-                        for (size_t c = 0; c < numComponents; c++) {
-                            dstPoint[c] = srcPoint[c];
-                        }
-                        
-                        // Log first and last points
-                        if (i == 0 || i == numPoints - 1) {
-                            NSLog(@"Set point %u: (%f, %f, %f)", i,
-                                  srcPoint[0],
-                                  numComponents > 1 ? srcPoint[1] : 0.0f,
-                                  numComponents > 2 ? srcPoint[2] : 0.0f);
-                        }
-                    }
-                    
-                    // Mark as successful and skip the rest of the loop
-                    success = true;
-                    break;
-                }
-            }
-            
-            if (dstAddress) {
-                // Copy the float data directly to the attribute's memory
-                memcpy(dstAddress, pointValues, numComponents * sizeof(float));
-                
-                // Log first and last point for verification
-                if (pointId == 0 || pointId == numPoints - 1) {
-                    NSLog(@"Set point %u: (%f, %f, %f)", pointId,
-                         pointValues[0],
-                         numComponents > 1 ? pointValues[1] : 0.0f,
-                         numComponents > 2 ? pointValues[2] : 0.0f);
-                }
-            } else {
-                // If we couldn't get an address for the first point, that's a critical error
-                if (pointId == 0) {
-                    NSLog(@"Error: Could not get attribute data address for point 0");
-                    return NO;
-                }
-                success = false;
-            }
-        } catch (...) {
-            // If the first point fails, log and fail
-            if (pointId == 0) {
-                NSLog(@"Error: Exception setting data for point 0");
-                return NO;
-            }
-            success = false;
-        }
+    // Verify we're working with float data
+    if (attribute->data_type() != draco::DT_FLOAT32) {
+        NSLog(@"Error: Attribute is not of float type");
+        return NO;
     }
     
-    if (success) {
-        NSLog(@"Successfully set attribute data for all %zu points", numPoints);
-    } else {
-        NSLog(@"Warning: Some points may not have been set correctly");
+    if (static_cast<size_t>(count) != _pointCloud->num_points()) {
+        NSLog(@"Error: Point count mismatch: expected %u points, got %ld", _pointCloud->num_points(), (long)count);
+        return NO;
     }
     
-    return success;
+    // Bulk copy of all values, the stride lets us skip the padding of SIMD3<Float>
+    if (!attribute->SetValuesFromInterleavedData(bytes, byteStride, static_cast<size_t>(count))) {
+        NSLog(@"Error: Failed to set attribute data (stride %ld)", (long)byteStride);
+        return NO;
+    }
+    return YES;
 }
 
 - (nullable NSData *)getPositionData {
@@ -229,124 +159,66 @@
         return nil;
     }
     
-    // Find the position attribute by iterating through all attributes
-    // Position attribute typically has type POSITION = 0
-    int attributeId = -1;
-    for (int i = 0; i < _pointCloud->num_attributes(); ++i) {
-        // Cast to GeometryAttribute for attribute_type access
-        const draco::GeometryAttribute* att = static_cast<const draco::GeometryAttribute*>(_pointCloud->attribute(i));
-        if (att && att->attribute_type() == 0) { // 0 = POSITION in Draco
-            attributeId = i;
-            break;
-        }
-    }
-    
-    if (attributeId == -1) {
-        NSLog(@"Error: No position attribute found in point cloud");
+    const draco::PointAttribute *positionAttribute =
+        _pointCloud->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    if (!positionAttribute || positionAttribute->data_type() != draco::DT_FLOAT32) {
+        NSLog(@"Error: No float position attribute found in point cloud");
         return nil;
     }
     
-    // Get the position attribute - cast to GeometryAttribute for API compatibility
-    const draco::GeometryAttribute *geomAttribute = static_cast<const draco::GeometryAttribute*>(_pointCloud->attribute(attributeId));
-    if (!geomAttribute) {
-        NSLog(@"Error: Failed to get position attribute");
+    // Always copy: the attribute storage is replaced or reallocated when the
+    // positions change, so a borrowed view could silently dangle.
+    const size_t numPoints = _pointCloud->num_points();
+    const size_t dataSize = numPoints * positionAttribute->num_components() * sizeof(float);
+    NSMutableData *data = [NSMutableData dataWithLength:dataSize];
+    if (numPoints > 0 &&
+        [self copyPositionsTo:data.mutableBytes
+                     capacity:numPoints
+                   byteStride:0] != (NSInteger)numPoints) {
         return nil;
     }
-    
-    // Also get as PointAttribute for GetAddress access
-    const draco::PointAttribute *positionAttribute = static_cast<const draco::PointAttribute*>(geomAttribute);
-    
-    // Check if it's a float attribute
-    if (geomAttribute->data_type() != draco::DT_FLOAT32) {
-        NSLog(@"Error: Position attribute is not of float type");
-        return nil;
+    return data;
+}
+
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride {
+    if (!_pointCloud || !destination) {
+        return -1;
     }
     
-    const size_t numComponents = geomAttribute->num_components();
-    const size_t numPoints = _pointCloud->num_points();
-    const size_t dataSize = numPoints * numComponents * sizeof(float);
-    
-    // Log key information for debugging
-    NSLog(@"Position attribute info: %d points, %zu components", 
-          _pointCloud->num_points(), numComponents);
-          
-    // Check the attribute's byte stride (should be numComponents * sizeof(float))
-    size_t byteStride = geomAttribute->byte_stride();
-    NSLog(@"Attribute byte stride: %zu (expected %zu)", 
-          byteStride, numComponents * sizeof(float));
-    
-    // Create a buffer to hold the point data
-    float *pointBuffer = (float *)malloc(dataSize);
-    if (!pointBuffer) {
-        NSLog(@"Error: Failed to allocate memory for point data (%zu bytes)", dataSize);
-        return nil;
+    const draco::PointAttribute *positionAttribute =
+        _pointCloud->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    if (!positionAttribute || positionAttribute->data_type() != draco::DT_FLOAT32) {
+        NSLog(@"Error: No float position attribute found in point cloud");
+        return -1;
     }
     
-    // Initialize buffer with zeros
-    memset(pointBuffer, 0, dataSize);
-    
-    // Use direct memory access to get the real point data
-    bool success = false;
-    
-    try {
-        // Get a pointer to the start of the attribute data
-        // For PointAttribute, we can usually access the data directly
-        const uint8_t* srcBuffer = positionAttribute->GetAddress(draco::AttributeValueIndex(0));
-        
-        // If GetAddress returns null, try a different approach
-        if (!srcBuffer) {
-            NSLog(@"GetAddress returned null, trying alternate approach");
-            srcBuffer = positionAttribute->buffer()->data();
-        }
-        
-        if (srcBuffer && byteStride > 0) {
-            NSLog(@"Extracting real point data using direct buffer access");
-            
-            // Copy the data with the correct stride
-            for (uint32_t pointId = 0; pointId < numPoints; pointId++) {
-                float* currentPoint = pointBuffer + (pointId * numComponents);
-                
-                // Calculate attribute value index
-                uint32_t valueIndex = pointId;  // Identity mapping
-                size_t offset = valueIndex * byteStride;
-                const float* srcPoint = reinterpret_cast<const float*>(srcBuffer + offset);
-                
-                // Copy each component
-                for (size_t c = 0; c < numComponents; c++) {
-                    currentPoint[c] = srcPoint[c];
-                }
-                
-                // Log first and last point for verification
-                if (pointId == 0 || pointId == numPoints - 1) {
-                    NSLog(@"Point %u: (%f, %f, %f)", pointId,
-                         currentPoint[0],
-                         numComponents > 1 ? currentPoint[1] : 0,
-                         numComponents > 2 ? currentPoint[2] : 0);
-                }
-            }
-            
-            success = true;
-        } else {
-            NSLog(@"Error: Failed to get attribute buffer address or stride is invalid");
-        }
-    } catch (...) {
-        NSLog(@"Exception while accessing attribute data buffer");
+    const int64_t entrySize = positionAttribute->num_components() * sizeof(float);
+    if (byteStride == 0) {
+        byteStride = entrySize;
     }
-    
-    // If we failed to extract the data, we need to fail - NOT create fake data
-    if (!success) {
-        NSLog(@"Error: Failed to extract real point data from the point cloud");
-        free(pointBuffer);
-        return nil;
+    const uint32_t numPoints = _pointCloud->num_points();
+    if (byteStride < entrySize || capacity < (NSInteger)numPoints) {
+        NSLog(@"Error: Destination can't hold %u positions", numPoints);
+        return -1;
     }
     
-    NSLog(@"Successfully extracted %zu points with %zu components each", 
-          numPoints, numComponents);
-    
-    // Create NSData from our buffer, which will take ownership and free memory when released
-    return [NSData dataWithBytesNoCopy:pointBuffer 
-                                length:dataSize 
-                          freeWhenDone:YES];
+    uint8_t *dst = static_cast<uint8_t *>(destination);
+    if (numPoints == 0) {
+        return 0;
+    }
+    if (positionAttribute->is_mapping_identity() && byteStride == entrySize &&
+        positionAttribute->byte_stride() == entrySize) {
+        memcpy(dst, positionAttribute->GetAddress(draco::AttributeValueIndex(0)),
+               entrySize * numPoints);
+    } else {
+        for (draco::PointIndex i(0); i < numPoints; ++i) {
+            memcpy(dst + byteStride * i.value(),
+                   positionAttribute->GetAddressOfMappedIndex(i), entrySize);
+        }
+    }
+    return numPoints;
 }
 
 @end
@@ -0,0 +1,73 @@
+//
+//  draco_progressive_wrapper.h
+//  spacetime-mic
+//
+
+#ifndef draco_progressive_wrapper_h
+#define draco_progressive_wrapper_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Encodes positions into a progressive stream ordered from coarse to fine
+// Any prefix of the stream decodes to a uniformly subsampled point cloud
+@interface DracoProgressiveEncoder : NSObject
+
+// Create a new encoder
+- (instancetype)init;
+
+// Number of bits used to quantize positions (default 11), each bit adds three levels of detail
+- (void)setQuantizationBits:(int)quantizationBits;
+
+// Encode float positions
+// bytes: Pointer to the first point, e.g. the base address of a [SIMD3<Float>] array
+// count: Number of points
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns NSData containing the encoded point cloud, or nil on failure
+- (nullable NSData *)encodePositions:(const void *)bytes
+                               count:(NSInteger)count
+                          byteStride:(NSInteger)byteStride;
+
+@end
+
+// Decodes point clouds encoded by DracoProgressiveEncoder up to a level of detail
+// Use it for previews and thumbnails, or to decode only the detail needed for the current zoom
+@interface DracoProgressiveDecoder : NSObject
+
+// Create a new decoder that decodes the full resolution
+- (instancetype)init;
+
+// Maximum number of decoded levels, negative for no limit
+- (void)setMaxDepth:(NSInteger)maxDepth;
+
+// Maximum number of bytes read from the data, negative for no limit
+// The data passed to decode: may end after this many bytes
+- (void)setMaxNumBytes:(int64_t)maxNumBytes;
+
+// Decode the point cloud, returns NO on failure
+- (BOOL)decode:(NSData *)data;
+
+// Number of decoded points
+- (NSInteger)numPoints;
+
+// Number of decoded levels and of all encoded levels
+- (NSInteger)depth;
+- (NSInteger)numLevels;
+
+// Whether the full resolution point cloud was decoded
+- (BOOL)isComplete;
+
+// Copy the decoded positions as float triplets into destination
+// capacity: Maximum number of points that fit into destination
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns the number of copied points
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* draco_progressive_wrapper_h */
@@ -0,0 +1,125 @@
+//
+//  draco_progressive_wrapper.mm
+//  spacetime-mic
+//
+
+#import <Foundation/Foundation.h>
+#import "draco_progressive_wrapper.h"
+#import "draco_encoded_data.h"
+
+#include <memory>
+
+// Include the Draco headers
+#include "../compression/point_cloud/progressive_point_cloud_decoder.h"
+#include "../compression/point_cloud/progressive_point_cloud_encoder.h"
+#include "../core/status.h"
+
+// Private class extension to hold the C++ objects
+@interface DracoProgressiveEncoder () {
+    std::unique_ptr<draco::ProgressivePointCloudEncoder> _encoder;
+    draco::EncoderBuffer _buffer;
+}
+@end
+
+@implementation DracoProgressiveEncoder
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _encoder.reset(new draco::ProgressivePointCloudEncoder());
+    }
+    return self;
+}
+
+- (void)setQuantizationBits:(int)quantizationBits {
+    _encoder->SetQuantizationBits(quantizationBits);
+}
+
+- (nullable NSData *)encodePositions:(const void *)bytes
+                               count:(NSInteger)count
+                          byteStride:(NSInteger)byteStride {
+    if (!bytes || count <= 0) {
+        return nil;
+    }
+    
+    _buffer.Clear();
+    const draco::Status status = _encoder->EncodePositions(
+        static_cast<const float *>(bytes), static_cast<size_t>(count),
+        byteStride, &_buffer);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to encode point cloud: %s", status.error_msg());
+        return nil;
+    }
+    
+    return DracoTakeEncodedData(&_buffer, true);
+}
+
+@end
+
+// Private class extension to hold the C++ object
+@interface DracoProgressiveDecoder () {
+    std::unique_ptr<draco::ProgressivePointCloudDecoder> _decoder;
+}
+@end
+
+@implementation DracoProgressiveDecoder
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _decoder.reset(new draco::ProgressivePointCloudDecoder());
+    }
+    return self;
+}
+
+- (void)setMaxDepth:(NSInteger)maxDepth {
+    _decoder->SetMaxDepth(static_cast<int>(maxDepth));
+}
+
+- (void)setMaxNumBytes:(int64_t)maxNumBytes {
+    _decoder->SetMaxNumBytes(maxNumBytes);
+}
+
+- (BOOL)decode:(NSData *)data {
+    if (!data) {
+        return NO;
+    }
+    
+    draco::DecoderBuffer buffer;
+    buffer.Init(static_cast<const char *>(data.bytes), data.length);
+    const draco::Status status = _decoder->DecodePositions(&buffer);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to decode point cloud: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (NSInteger)numPoints {
+    return static_cast<NSInteger>(_decoder->num_points());
+}
+
+- (NSInteger)depth {
+    return _decoder->depth();
+}
+
+- (NSInteger)numLevels {
+    return _decoder->num_levels();
+}
+
+- (BOOL)isComplete {
+    return _decoder->is_complete();
+}
+
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride {
+    if (!destination || capacity <= 0) {
+        return 0;
+    }
+    return static_cast<NSInteger>(_decoder->GetPositions(
+        static_cast<float *>(destination), byteStride,
+        static_cast<size_t>(capacity)));
+}
+
+@end
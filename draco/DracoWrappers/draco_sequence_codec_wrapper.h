@@ -0,0 +1,123 @@
+//
+//  draco_sequence_codec_wrapper.h
+//  spacetime-mic
+//
+
+#ifndef draco_sequence_codec_wrapper_h
+#define draco_sequence_codec_wrapper_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Encodes the positions of consecutive frames with temporal prediction
+// Frames between two key frames are coded as the difference to the previous frame
+// Not thread safe, use it from a single serial queue
+@interface DracoSequenceEncoder : NSObject
+
+// Create a new encoder
+- (instancetype)init;
+
+// Number of bits used to quantize positions (default 11)
+- (void)setQuantizationBits:(int)quantizationBits;
+
+// Compression level 0 (fastest) to 6 (smallest), default 6
+- (void)setCompressionLevel:(int)compressionLevel;
+
+// Maximum number of frames between two key frames (default 30), 0 disables periodic key frames
+- (void)setKeyFrameInterval:(int)keyFrameInterval;
+
+// Split frames into up to 2^subtreeDepth independently coded parts, 0 to 6 (default 0)
+- (void)setSubtreeDepth:(int)subtreeDepth;
+
+// Split key frames into exactly 2^subtreeDepth cells of space instead (default NO)
+// Region decoding skips the cells outside of the queried region, full decoding gets a little slower
+- (void)setSpatialSubtrees:(BOOL)spatialSubtrees;
+
+// Number of threads encoding the parts of a frame (default 1)
+- (void)setNumThreads:(int)numThreads;
+
+// Force the next frame to be a key frame
+- (void)requestKeyFrame;
+
+// Encode the next frame of float positions
+// bytes: Pointer to the first point, e.g. the base address of a [SIMD3<Float>] array
+// count: Number of points
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns NSData containing the encoded frame, or nil on failure
+- (nullable NSData *)encodePositions:(const void *)bytes
+                               count:(NSInteger)count
+                          byteStride:(NSInteger)byteStride;
+
+// Whether the last encoded frame is a key frame
+- (BOOL)lastFrameIsKeyFrame;
+
+// Discard the reference frame, the next frame is coded as a key frame
+- (void)reset;
+
+@end
+
+// Decodes frames encoded by DracoSequenceEncoder
+// Frames must be decoded in order, starting at a key frame
+@interface DracoSequenceDecoder : NSObject
+
+// Create a new decoder
+- (instancetype)init;
+
+// Number of threads decoding the parts of a frame (default 1)
+- (void)setNumThreads:(int)numThreads;
+
+// Decode the next frame, returns NO on failure
+- (BOOL)decodeFrame:(NSData *)data;
+
+// Decode the next frame and write its positions as float triplets into destination in the same pass
+// capacity: Maximum number of points that fit into destination
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// sorted: Same order as copyPositionsTo:, otherwise the order in which the points are decoded
+// Returns NO on failure or if the frame has more than capacity points
+- (BOOL)decodeFrame:(NSData *)data
+    intoPositions:(void *)destination
+         capacity:(NSInteger)capacity
+       byteStride:(NSInteger)byteStride
+           sorted:(BOOL)sorted;
+
+// Decode the next frame and write the positions inside the box [boxMin, boxMax] in sorted order
+// boxMin, boxMax: Three floats each
+// Key frames encoded with spatial subtrees only decode the parts intersecting the box and reset the decoder
+// afterwards, other frames are decoded completely and can be followed by their predicted frames
+// Returns the number of points inside the box, or -1 on failure or if more than capacity points are inside
+- (NSInteger)decodeFrame:(NSData *)data
+               insideBoxMin:(const float *)boxMin
+                        max:(const float *)boxMax
+              intoPositions:(void *)destination
+                   capacity:(NSInteger)capacity
+                 byteStride:(NSInteger)byteStride;
+
+// Same as decodeFrame:insideBoxMin:max:... for the convex region where a*x + b*y + c*z + d >= 0 for all planes
+// planes: numPlanes times four floats (a, b, c, d), e.g. the six inward facing planes of a camera frustum
+- (NSInteger)decodeFrame:(NSData *)data
+             insidePlanes:(const float *)planes
+                numPlanes:(NSInteger)numPlanes
+            intoPositions:(void *)destination
+                 capacity:(NSInteger)capacity
+               byteStride:(NSInteger)byteStride;
+
+// Number of points of the last decoded frame
+- (NSInteger)numPoints;
+
+// Copy the positions of the last decoded frame as float triplets into destination
+// capacity: Maximum number of points that fit into destination
+// byteStride: Distance between two consecutive points in bytes (16 for SIMD3<Float>)
+// Returns the number of copied points
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride;
+
+// Discard the last decoded frame, the next frame must be a key frame
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* draco_sequence_codec_wrapper_h */
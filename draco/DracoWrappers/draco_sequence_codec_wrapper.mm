@@ -0,0 +1,226 @@
+//
+//  draco_sequence_codec_wrapper.mm
+//  spacetime-mic
+//
+
+#import <Foundation/Foundation.h>
+#import "draco_sequence_codec_wrapper.h"
+#import "draco_encoded_data.h"
+
+#include <memory>
+
+// Include the Draco headers
+#include "../compression/point_cloud/point_cloud_sequence_decoder.h"
+#include "../compression/point_cloud/point_cloud_sequence_encoder.h"
+#include "../core/status.h"
+
+// Private class extension to hold the C++ objects
+@interface DracoSequenceEncoder () {
+    std::unique_ptr<draco::PointCloudSequenceEncoder> _encoder;
+    draco::EncoderBuffer _buffer;
+}
+@end
+
+@implementation DracoSequenceEncoder
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _encoder.reset(new draco::PointCloudSequenceEncoder());
+    }
+    return self;
+}
+
+- (void)setQuantizationBits:(int)quantizationBits {
+    _encoder->SetQuantizationBits(quantizationBits);
+}
+
+- (void)setCompressionLevel:(int)compressionLevel {
+    _encoder->SetCompressionLevel(compressionLevel);
+}
+
+- (void)setKeyFrameInterval:(int)keyFrameInterval {
+    _encoder->SetKeyFrameInterval(keyFrameInterval);
+}
+
+- (void)setSubtreeDepth:(int)subtreeDepth {
+    _encoder->SetSubtreeDepth(subtreeDepth);
+}
+
+- (void)setSpatialSubtrees:(BOOL)spatialSubtrees {
+    _encoder->SetSpatialSubtrees(spatialSubtrees);
+}
+
+- (void)setNumThreads:(int)numThreads {
+    _encoder->SetNumThreads(numThreads);
+}
+
+- (void)requestKeyFrame {
+    _encoder->RequestKeyFrame();
+}
+
+- (nullable NSData *)encodePositions:(const void *)bytes
+                               count:(NSInteger)count
+                          byteStride:(NSInteger)byteStride {
+    if (!bytes || count <= 0) {
+        return nil;
+    }
+    
+    _buffer.Clear();
+    const draco::Status status = _encoder->EncodeFrame(
+        static_cast<const float *>(bytes), static_cast<size_t>(count),
+        byteStride, &_buffer);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to encode frame: %s", status.error_msg());
+        return nil;
+    }
+    
+    return DracoTakeEncodedData(&_buffer, true);
+}
+
+- (BOOL)lastFrameIsKeyFrame {
+    return _encoder->last_frame_is_key_frame();
+}
+
+- (void)reset {
+    _encoder->Reset();
+}
+
+@end
+
+// Private class extension to hold the C++ object
+@interface DracoSequenceDecoder () {
+    std::unique_ptr<draco::PointCloudSequenceDecoder> _decoder;
+}
+@end
+
+@implementation DracoSequenceDecoder
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _decoder.reset(new draco::PointCloudSequenceDecoder());
+    }
+    return self;
+}
+
+- (void)setNumThreads:(int)numThreads {
+    _decoder->SetNumThreads(numThreads);
+}
+
+- (BOOL)decodeFrame:(NSData *)data {
+    if (!data) {
+        return NO;
+    }
+    
+    draco::DecoderBuffer buffer;
+    buffer.Init(static_cast<const char *>(data.bytes), data.length);
+    const draco::Status status = _decoder->DecodeFrame(&buffer);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to decode frame: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (NSInteger)decodeFrame:(NSData *)data
+               insideBoxMin:(const float *)boxMin
+                        max:(const float *)boxMax
+              intoPositions:(void *)destination
+                   capacity:(NSInteger)capacity
+                 byteStride:(NSInteger)byteStride {
+    if (!boxMin || !boxMax) {
+        return -1;
+    }
+    return [self decodeFrame:data
+                      region:draco::PointCloudRegionQuery::FromBox(boxMin, boxMax)
+               intoPositions:destination
+                    capacity:capacity
+                  byteStride:byteStride];
+}
+
+- (NSInteger)decodeFrame:(NSData *)data
+             insidePlanes:(const float *)planes
+                numPlanes:(NSInteger)numPlanes
+            intoPositions:(void *)destination
+                 capacity:(NSInteger)capacity
+               byteStride:(NSInteger)byteStride {
+    if ((!planes && numPlanes > 0) || numPlanes < 0) {
+        return -1;
+    }
+    return [self decodeFrame:data
+                      region:draco::PointCloudRegionQuery::FromPlanes(
+                                 reinterpret_cast<const float (*)[4]>(planes),
+                                 static_cast<int>(numPlanes))
+               intoPositions:destination
+                    capacity:capacity
+                  byteStride:byteStride];
+}
+
+- (NSInteger)decodeFrame:(NSData *)data
+                  region:(const draco::PointCloudRegionQuery &)region
+           intoPositions:(void *)destination
+                capacity:(NSInteger)capacity
+              byteStride:(NSInteger)byteStride {
+    if (!data || !destination || capacity < 0) {
+        return -1;
+    }
+    
+    draco::DecoderBuffer buffer;
+    buffer.Init(static_cast<const char *>(data.bytes), data.length);
+    size_t numPoints = 0;
+    const draco::Status status = _decoder->DecodeFrameRegion(
+        &buffer, region,
+        draco::PositionsOutputLayout::Interleaved(static_cast<float *>(destination), byteStride),
+        static_cast<size_t>(capacity), &numPoints);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to decode frame region: %s", status.error_msg());
+        return -1;
+    }
+    return static_cast<NSInteger>(numPoints);
+}
+
+- (BOOL)decodeFrame:(NSData *)data
+    intoPositions:(void *)destination
+         capacity:(NSInteger)capacity
+       byteStride:(NSInteger)byteStride
+           sorted:(BOOL)sorted {
+    if (!data || !destination || capacity < 0) {
+        return NO;
+    }
+    
+    draco::DecoderBuffer buffer;
+    buffer.Init(static_cast<const char *>(data.bytes), data.length);
+    const draco::Status status = _decoder->DecodeFrame(
+        &buffer,
+        draco::PositionsOutputLayout::Interleaved(static_cast<float *>(destination), byteStride),
+        static_cast<size_t>(capacity),
+        sorted ? draco::POINT_CLOUD_SEQUENCE_SORTED_ORDER
+               : draco::POINT_CLOUD_SEQUENCE_DECODING_ORDER);
+    if (!status.ok()) {
+        NSLog(@"Error: Failed to decode frame: %s", status.error_msg());
+        return NO;
+    }
+    return YES;
+}
+
+- (NSInteger)numPoints {
+    return static_cast<NSInteger>(_decoder->num_points());
+}
+
+- (NSInteger)copyPositionsTo:(void *)destination
+                    capacity:(NSInteger)capacity
+                  byteStride:(NSInteger)byteStride {
+    if (!destination || capacity <= 0) {
+        return 0;
+    }
+    return static_cast<NSInteger>(_decoder->GetPositions(
+        static_cast<float *>(destination), byteStride,
+        static_cast<size_t>(capacity)));
+}
+
+- (void)reset {
+    _decoder->Reset();
+}
+
+@end
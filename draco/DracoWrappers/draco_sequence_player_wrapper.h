@@ -0,0 +1,54 @@
+//
+//  draco_sequence_player_wrapper.h
+//  spacetime-mic
+//
+
+#ifndef draco_sequence_player_wrapper_h
+#define draco_sequence_player_wrapper_h
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Plays back a .drcseq file by decoding frames ahead of the playhead on background threads
+// Only ringSize decoded frames are kept in memory, regardless of the length of the recording
+// Not thread safe, use it from a single thread (e.g. the main thread)
+@interface DracoSequencePlayer : NSObject
+
+// Open the sequence file at path
+// workers: Number of decoding threads
+// ringSize: Number of frames decoded ahead of the playhead
+// loop: Prefetch the first frames when the playhead approaches the end
+// Returns nil if the file is not a valid sequence
+- (nullable instancetype)initWithPath:(NSString *)path
+                              workers:(NSInteger)workers
+                             ringSize:(NSInteger)ringSize
+                                 loop:(BOOL)loop;
+
+// Number of frames in the sequence
+- (NSInteger)numFrames;
+
+// Nominal frame rate of the sequence, 0 if unknown
+- (double)frameRate;
+
+// Move the playhead to index without waiting for the frame, frames that are
+// no longer needed are discarded
+- (void)seekToFrame:(NSInteger)index;
+
+// Move the playhead to index and wait up to timeout seconds for the frame
+// Returns the number of points of the frame, -1 if the frame is not decoded yet
+// Frames that fail to decode have 0 points
+- (NSInteger)numPointsOfFrame:(NSInteger)index timeout:(NSTimeInterval)timeout;
+
+// Copy the positions of a decoded frame as float triplets byteStride bytes apart
+// Call numPointsOfFrame:timeout: first, returns the number of copied points
+- (NSInteger)copyPositionsOfFrame:(NSInteger)index
+                               to:(void *)positions
+                         capacity:(NSInteger)capacity
+                       byteStride:(NSInteger)byteStride;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* draco_sequence_player_wrapper_h */
@@ -0,0 +1,119 @@
+//
+//  draco_sequence_player_wrapper.mm
+//  spacetime-mic
+//
+
+#import <Foundation/Foundation.h>
+#import "draco_sequence_player_wrapper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+// Include the Draco headers
+#include "../io/frame_sequence_player.h"
+
+// Private class extension to hold the C++ object
+@interface DracoSequencePlayer () {
+    std::unique_ptr<draco::FrameSequencePlayer> _player;
+}
+@end
+
+@implementation DracoSequencePlayer
+
+- (nullable instancetype)initWithPath:(NSString *)path
+                              workers:(NSInteger)workers
+                             ringSize:(NSInteger)ringSize
+                                 loop:(BOOL)loop {
+    self = [super init];
+    if (self) {
+        auto readerOr = draco::FrameSequenceReader::Open(path.UTF8String);
+        if (!readerOr.ok()) {
+            NSLog(@"Error: Failed to open frame sequence: %s", readerOr.status().error_msg());
+            return nil;
+        }
+        draco::FrameSequencePlayerOptions options;
+        options.num_workers = static_cast<int>(workers);
+        options.ring_size = static_cast<int>(ringSize);
+        options.loop = loop;
+        auto playerOr = draco::FrameSequencePlayer::Create(std::move(readerOr).value(), options);
+        if (!playerOr.ok()) {
+            NSLog(@"Error: Failed to create sequence player: %s", playerOr.status().error_msg());
+            return nil;
+        }
+        _player = std::move(playerOr).value();
+    }
+    return self;
+}
+
+- (NSInteger)numFrames {
+    return static_cast<NSInteger>(_player->num_frames());
+}
+
+- (double)frameRate {
+    return _player->reader().frame_rate();
+}
+
+- (void)seekToFrame:(NSInteger)index {
+    if (index < 0 || index >= self.numFrames) {
+        return;
+    }
+    _player->Seek(static_cast<size_t>(index));
+}
+
+- (NSInteger)numPointsOfFrame:(NSInteger)index timeout:(NSTimeInterval)timeout {
+    if (index < 0 || index >= self.numFrames) {
+        return 0;
+    }
+    const int64_t timeoutUs =
+        timeout < 0 ? -1 : static_cast<int64_t>(std::llround(timeout * 1e6));
+    const auto statusOr = _player->GetFrame(static_cast<size_t>(index), timeoutUs);
+    if (!statusOr.ok()) {
+        NSLog(@"Error: Failed to decode frame %ld: %s", (long)index, statusOr.status().error_msg());
+        return 0;
+    }
+    if (statusOr.value() == nullptr) {
+        return -1;
+    }
+    return static_cast<NSInteger>(statusOr.value()->num_points());
+}
+
+- (NSInteger)copyPositionsOfFrame:(NSInteger)index
+                               to:(void *)positions
+                         capacity:(NSInteger)capacity
+                       byteStride:(NSInteger)byteStride {
+    if (!positions || capacity <= 0 || index < 0 || index >= self.numFrames) {
+        return 0;
+    }
+    if (byteStride == 0) {
+        byteStride = 3 * sizeof(float);
+    }
+    if (byteStride < static_cast<NSInteger>(3 * sizeof(float))) {
+        return 0;
+    }
+    // The frame is decoded already, so this doesn't wait
+    const auto statusOr = _player->GetFrame(static_cast<size_t>(index), 0);
+    if (!statusOr.ok() || !statusOr.value()) {
+        return 0;
+    }
+    const draco::PointCloud *pc = statusOr.value();
+    const draco::PointAttribute *att = pc->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    const NSInteger numPoints = std::min<NSInteger>(capacity, pc->num_points());
+    if (!att || numPoints == 0) {
+        return 0;
+    }
+    // Positions of the player are tightly packed float triplets
+    const uint8_t *src = att->GetAddress(draco::AttributeValueIndex(0));
+    uint8_t *dst = static_cast<uint8_t *>(positions);
+    if (byteStride == static_cast<NSInteger>(3 * sizeof(float))) {
+        memcpy(dst, src, 3 * sizeof(float) * numPoints);
+    } else {
+        for (NSInteger i = 0; i < numPoints; ++i) {
+            memcpy(dst + byteStride * i, src + 3 * sizeof(float) * i, 3 * sizeof(float));
+        }
+    }
+    return numPoints;
+}
+
+@end
@@ -5,4 +5,12 @@
 #import "draco_point_cloud_wrapper.h"
 #import "draco_encoder_wrapper.h"
 #import "draco_decoder_wrapper.h"
+#import "draco_encoder_session_wrapper.h"
+#import "draco_frame_sequence_wrapper.h"
+#import "draco_sequence_codec_wrapper.h"
+#import "draco_encoding_pipeline_wrapper.h"
+#import "draco_sequence_player_wrapper.h"
+#import "draco_progressive_wrapper.h"
+#import "draco_octree_wrapper.h"
 
+#import "draco_depth_image_wrapper.h"
@@ -81,6 +81,133 @@ class PointAttribute : public GeometryAttribute {
   // valid attribute value).
   void Resize(size_t new_num_unique_entries);
 
+  // Bulk setters of attribute values. All of them (re)allocate the attribute
+  // storage to hold exactly |num_attribute_values| tightly packed entries and
+  // they don't change the mapping between points and attribute values.
+  // Returns false on invalid input.
+  //
+  // Copies values from interleaved (AoS) input where the beginning of two
+  // consecutive entries is |input_byte_stride| bytes apart. Each entry must
+  // start with |num_components()| values of |data_type()|, any remaining bytes
+  // of the entry are ignored (e.g. the padding of the 16 byte simd_float3).
+  // Tightly packed input (|input_byte_stride| equal to the entry size or 0) is
+  // copied with a single memcpy.
+  bool SetValuesFromInterleavedData(const void *data, int64_t input_byte_stride,
+                                    size_t num_attribute_values) {
+    const int64_t entry_size = GetEntrySize();
+    if (input_byte_stride == 0) {
+      input_byte_stride = entry_size;
+    }
+    if (data == nullptr || entry_size <= 0 || input_byte_stride < entry_size) {
+      return false;
+    }
+    if (!PrepareValuesStorage(num_attribute_values)) {
+      return false;
+    }
+    const uint8_t *const src = static_cast<const uint8_t *>(data);
+    uint8_t *const dst = attribute_buffer_->data();
+    if (input_byte_stride == entry_size) {
+      memcpy(dst, src, num_attribute_values * entry_size);
+      return true;
+    }
+    // Fixed entry sizes allow the compiler to turn the per entry memcpy into
+    // plain (vector) loads and stores.
+    switch (entry_size) {
+      case 4:
+        CopyStridedEntries<4>(src, input_byte_stride, num_attribute_values,
+                              dst, entry_size);
+        break;
+      case 8:
+        CopyStridedEntries<8>(src, input_byte_stride, num_attribute_values,
+                              dst, entry_size);
+        break;
+      case 12:
+        CopyStridedEntries<12>(src, input_byte_stride, num_attribute_values,
+                               dst, entry_size);
+        break;
+      case 16:
+        CopyStridedEntries<16>(src, input_byte_stride, num_attribute_values,
+                               dst, entry_size);
+        break;
+      default:
+        for (size_t i = 0; i < num_attribute_values; ++i) {
+          memcpy(dst + i * entry_size, src + i * input_byte_stride, entry_size);
+        }
+        break;
+    }
+    return true;
+  }
+
+  // Copies values from planar (SoA) input, where |planes[c]| stores tightly
+  // packed values of the c-th component for all entries. |planes| must contain
+  // |num_components()| pointers.
+  bool SetValuesFromPlanarData(const void *const *planes,
+                               size_t num_attribute_values) {
+    const int64_t entry_size = GetEntrySize();
+    if (planes == nullptr || entry_size <= 0) {
+      return false;
+    }
+    const int num_planes = num_components();
+    for (int c = 0; c < num_planes; ++c) {
+      if (planes[c] == nullptr) {
+        return false;
+      }
+    }
+    if (!PrepareValuesStorage(num_attribute_values)) {
+      return false;
+    }
+    const int64_t component_size = entry_size / num_planes;
+    uint8_t *const dst = attribute_buffer_->data();
+    for (int c = 0; c < num_planes; ++c) {
+      const uint8_t *const src = static_cast<const uint8_t *>(planes[c]);
+      uint8_t *const dst_c = dst + c * component_size;
+      switch (component_size) {
+        case 1:
+          CopyStridedEntries<1>(src, 1, num_attribute_values, dst_c,
+                                entry_size);
+          break;
+        case 2:
+          CopyStridedEntries<2>(src, 2, num_attribute_values, dst_c,
+                                entry_size);
+          break;
+        case 4:
+          CopyStridedEntries<4>(src, 4, num_attribute_values, dst_c,
+                                entry_size);
+          break;
+        case 8:
+          CopyStridedEntries<8>(src, 8, num_attribute_values, dst_c,
+                                entry_size);
+          break;
+        default:
+          for (size_t i = 0; i < num_attribute_values; ++i) {
+            memcpy(dst_c + i * entry_size, src + i * component_size,
+                   component_size);
+          }
+          break;
+      }
+    }
+    return true;
+  }
+
+  // Uses |data| directly as the attribute storage without making a copy.
+  // |data| must contain tightly packed entries of the attribute format and
+  // its size must be a multiple of the entry size.
+  bool AdoptValues(std::vector<uint8_t> &&data) {
+    const int64_t entry_size = GetEntrySize();
+    if (entry_size <= 0 || data.size() % entry_size != 0) {
+      return false;
+    }
+    const size_t num_attribute_values = data.size() / entry_size;
+    if (attribute_buffer_ == nullptr) {
+      attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer());
+    }
+    attribute_buffer_->Adopt(std::move(data));
+    ResetBuffer(attribute_buffer_.get(), entry_size, 0);
+    num_unique_entries_ =
+        static_cast<AttributeValueIndex::ValueType>(num_attribute_values);
+    return true;
+  }
+
   // Functions for setting the type of mapping between point indices and
   // attribute entry ids.
   // This function sets the mapping to implicit, where point indices are equal
@@ -140,6 +267,42 @@ class PointAttribute : public GeometryAttribute {
 #endif
 
  private:
+  // Size of a single tightly packed attribute entry in bytes.
+  int64_t GetEntrySize() const {
+    return static_cast<int64_t>(DataTypeLength(data_type())) *
+           num_components();
+  }
+
+  // Makes sure the attribute storage holds exactly |num_attribute_values|
+  // tightly packed entries. Existing storage of the right size is reused.
+  bool PrepareValuesStorage(size_t num_attribute_values) {
+    const int64_t entry_size = GetEntrySize();
+    if (attribute_buffer_ != nullptr && byte_stride() == entry_size &&
+        byte_offset() == 0 && size() == num_attribute_values &&
+        attribute_buffer_->data_size() ==
+            num_attribute_values * static_cast<size_t>(entry_size)) {
+      // The values are overwritten in place, which must invalidate the
+      // PointAttributeViews of the old values.
+      attribute_buffer_->set_update_count(attribute_buffer_->update_count() +
+                                          1);
+      return true;
+    }
+    return Reset(num_attribute_values);
+  }
+
+  // Copies |num_entries| entries of |entry_size_t| bytes between strided
+  // arrays.
+  template <int entry_size_t>
+  static void CopyStridedEntries(const uint8_t *src, int64_t src_stride,
+                                 size_t num_entries, uint8_t *dst,
+                                 int64_t dst_stride) {
+    for (size_t i = 0; i < num_entries; ++i) {
+      memcpy(dst, src, entry_size_t);
+      src += src_stride;
+      dst += dst_stride;
+    }
+  }
+
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   template <typename T>
   AttributeValueIndex::ValueType DeduplicateTypedValues(
@@ -0,0 +1,234 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "attributes/point_attribute.h"
+
+#include <cstring>
+#include <vector>
+
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class PointAttributeTest : public ::testing::Test {
+ protected:
+  static PointAttribute CreateAttribute(int num_components,
+                                        DataType data_type) {
+    GeometryAttribute attribute;
+    attribute.Init(GeometryAttribute::POSITION, nullptr, num_components,
+                   data_type, false,
+                   DataTypeLength(data_type) * num_components, 0);
+    return PointAttribute(attribute);
+  }
+
+  // Expects the entries of |attribute| to be tightly packed and equal to
+  // |expected|.
+  template <typename T>
+  static void ExpectValues(const PointAttribute &attribute,
+                           const std::vector<T> &expected) {
+    const size_t num_components = attribute.num_components();
+    ASSERT_EQ(attribute.size() * num_components, expected.size());
+    ASSERT_EQ(attribute.byte_stride(),
+              static_cast<int64_t>(sizeof(T) * num_components));
+    ASSERT_EQ(attribute.byte_offset(), 0);
+    ASSERT_EQ(attribute.buffer()->data_size(), expected.size() * sizeof(T));
+    for (size_t i = 0; i < attribute.size(); ++i) {
+      std::vector<T> value(num_components);
+      attribute.GetValue(AttributeValueIndex(static_cast<uint32_t>(i)),
+                         value.data());
+      for (size_t c = 0; c < num_components; ++c) {
+        ASSERT_EQ(value[c], expected[i * num_components + c]) << i;
+      }
+    }
+  }
+};
+
+TEST_F(PointAttributeTest, TestInterleavedData) {
+  // 16 byte entries with three floats and padding, like simd_float3.
+  const size_t num_values = 101;
+  std::vector<float> padded(4 * num_values);
+  std::vector<float> expected;
+  for (size_t i = 0; i < num_values; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      padded[4 * i + c] = static_cast<float>(3 * i + c) + 0.5f;
+      expected.push_back(padded[4 * i + c]);
+    }
+    padded[4 * i + 3] = -1.f;
+  }
+  PointAttribute attribute = CreateAttribute(3, DT_FLOAT32);
+  ASSERT_TRUE(attribute.SetValuesFromInterleavedData(
+      padded.data(), 4 * sizeof(float), num_values));
+  ExpectValues(attribute, expected);
+
+  // Tightly packed input, with the stride given or 0.
+  for (const int64_t stride : {static_cast<int64_t>(3 * sizeof(float)),
+                               static_cast<int64_t>(0)}) {
+    PointAttribute packed_attribute = CreateAttribute(3, DT_FLOAT32);
+    ASSERT_TRUE(packed_attribute.SetValuesFromInterleavedData(
+        expected.data(), stride, num_values));
+    ExpectValues(packed_attribute, expected);
+  }
+}
+
+TEST_F(PointAttributeTest, TestInterleavedDataEntrySizes) {
+  // Entry sizes with and without a fixed size copy.
+  const size_t num_values = 37;
+  const int num_components_list[] = {1, 2, 3, 4, 5};
+  for (const int num_components : num_components_list) {
+    std::vector<uint16_t> input(7 * num_values);
+    std::vector<uint16_t> expected;
+    for (size_t i = 0; i < num_values; ++i) {
+      for (int c = 0; c < 7; ++c) {
+        input[7 * i + c] = static_cast<uint16_t>(100 * i + c);
+        if (c < num_components) {
+          expected.push_back(input[7 * i + c]);
+        }
+      }
+    }
+    PointAttribute attribute = CreateAttribute(num_components, DT_UINT16);
+    ASSERT_TRUE(attribute.SetValuesFromInterleavedData(
+        input.data(), 7 * sizeof(uint16_t), num_values));
+    ExpectValues(attribute, expected);
+  }
+}
+
+TEST_F(PointAttributeTest, TestInterleavedDataReusesStorage) {
+  std::vector<float> values(30);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(i);
+  }
+  PointAttribute attribute = CreateAttribute(3, DT_FLOAT32);
+  ASSERT_TRUE(attribute.SetValuesFromInterleavedData(values.data(), 0, 10));
+  const uint8_t *const data = attribute.buffer()->data();
+  for (float &value : values) {
+    value *= 2.f;
+  }
+  ASSERT_TRUE(attribute.SetValuesFromInterleavedData(values.data(), 0, 10));
+  EXPECT_EQ(attribute.buffer()->data(), data);
+  ExpectValues(attribute, values);
+
+  // A different number of values resizes the storage.
+  values.resize(15);
+  ASSERT_TRUE(attribute.SetValuesFromInterleavedData(values.data(), 0, 5));
+  ExpectValues(attribute, values);
+}
+
+TEST_F(PointAttributeTest, TestInterleavedDataInvalidInput) {
+  const std::vector<float> values(12, 1.f);
+  PointAttribute attribute = CreateAttribute(3, DT_FLOAT32);
+  EXPECT_FALSE(attribute.SetValuesFromInterleavedData(nullptr, 0, 4));
+  // The entries would overlap.
+  EXPECT_FALSE(attribute.SetValuesFromInterleavedData(values.data(), 8, 4));
+  EXPECT_FALSE(attribute.SetValuesFromInterleavedData(values.data(), -12, 1));
+}
+
+TEST_F(PointAttributeTest, TestPlanarData) {
+  const size_t num_values = 53;
+  std::vector<float> x(num_values), y(num_values), z(num_values);
+  std::vector<float> expected;
+  for (size_t i = 0; i < num_values; ++i) {
+    x[i] = static_cast<float>(i);
+    y[i] = static_cast<float>(i) + 0.25f;
+    z[i] = -static_cast<float>(i);
+    expected.insert(expected.end(), {x[i], y[i], z[i]});
+  }
+  const void *const planes[] = {x.data(), y.data(), z.data()};
+  PointAttribute attribute = CreateAttribute(3, DT_FLOAT32);
+  ASSERT_TRUE(attribute.SetValuesFromPlanarData(planes, num_values));
+  ExpectValues(attribute, expected);
+}
+
+TEST_F(PointAttributeTest, TestPlanarDataComponentSizes) {
+  const size_t num_values = 19;
+  {
+    std::vector<uint8_t> a(num_values), b(num_values);
+    std::vector<uint8_t> expected;
+    for (size_t i = 0; i < num_values; ++i) {
+      a[i] = static_cast<uint8_t>(i);
+      b[i] = static_cast<uint8_t>(200 + i);
+      expected.insert(expected.end(), {a[i], b[i]});
+    }
+    const void *const planes[] = {a.data(), b.data()};
+    PointAttribute attribute = CreateAttribute(2, DT_UINT8);
+    ASSERT_TRUE(attribute.SetValuesFromPlanarData(planes, num_values));
+    ExpectValues(attribute, expected);
+  }
+  {
+    std::vector<uint16_t> a(num_values), b(num_values), c(num_values);
+    std::vector<uint16_t> expected;
+    for (size_t i = 0; i < num_values; ++i) {
+      a[i] = static_cast<uint16_t>(i);
+      b[i] = static_cast<uint16_t>(1000 + i);
+      c[i] = static_cast<uint16_t>(60000 + i);
+      expected.insert(expected.end(), {a[i], b[i], c[i]});
+    }
+    const void *const planes[] = {a.data(), b.data(), c.data()};
+    PointAttribute attribute = CreateAttribute(3, DT_UINT16);
+    ASSERT_TRUE(attribute.SetValuesFromPlanarData(planes, num_values));
+    ExpectValues(attribute, expected);
+  }
+  {
+    std::vector<double> a(num_values), b(num_values);
+    std::vector<double> expected;
+    for (size_t i = 0; i < num_values; ++i) {
+      a[i] = 0.5 * i;
+      b[i] = -0.25 * i;
+      expected.insert(expected.end(), {a[i], b[i]});
+    }
+    const void *const planes[] = {a.data(), b.data()};
+    PointAttribute attribute = CreateAttribute(2, DT_FLOAT64);
+    ASSERT_TRUE(attribute.SetValuesFromPlanarData(planes, num_values));
+    ExpectValues(attribute, expected);
+  }
+}
+
+TEST_F(PointAttributeTest, TestPlanarDataInvalidInput) {
+  const std::vector<float> plane(4, 1.f);
+  const void *const planes[] = {plane.data(), nullptr, plane.data()};
+  PointAttribute attribute = CreateAttribute(3, DT_FLOAT32);
+  EXPECT_FALSE(attribute.SetValuesFromPlanarData(nullptr, 4));
+  EXPECT_FALSE(attribute.SetValuesFromPlanarData(planes, 4));
+}
+
+TEST_F(PointAttributeTest, TestAdoptValues) {
+  const std::vector<float> expected = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+  std::vector<uint8_t> data(expected.size() * sizeof(float));
+  memcpy(data.data(), expected.data(), data.size());
+  const uint8_t *const data_address = data.data();
+
+  PointAttribute attribute = CreateAttribute(3, DT_FLOAT32);
+  ASSERT_TRUE(attribute.AdoptValues(std::move(data)));
+  EXPECT_EQ(attribute.size(), 2u);
+  // The vector is used as the storage without a copy.
+  EXPECT_EQ(attribute.buffer()->data(), data_address);
+  ExpectValues(attribute, expected);
+
+  // Adopting replaces values set before.
+  PointAttribute other_attribute = CreateAttribute(3, DT_FLOAT32);
+  ASSERT_TRUE(
+      other_attribute.SetValuesFromInterleavedData(expected.data(), 0, 1));
+  std::vector<uint8_t> other_data(data_address,
+                                  data_address + 2 * 3 * sizeof(float));
+  ASSERT_TRUE(other_attribute.AdoptValues(std::move(other_data)));
+  ExpectValues(other_attribute, expected);
+}
+
+TEST_F(PointAttributeTest, TestAdoptValuesInvalidSize) {
+  PointAttribute attribute = CreateAttribute(3, DT_FLOAT32);
+  EXPECT_FALSE(attribute.AdoptValues(std::vector<uint8_t>(13)));
+  EXPECT_TRUE(attribute.AdoptValues(std::vector<uint8_t>()));
+  EXPECT_EQ(attribute.size(), 0u);
+}
+
+}  // namespace draco
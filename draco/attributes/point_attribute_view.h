@@ -0,0 +1,113 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_ATTRIBUTES_POINT_ATTRIBUTE_VIEW_H_
+#define DRACO_ATTRIBUTES_POINT_ATTRIBUTE_VIEW_H_
+
+#include "attributes/point_attribute.h"
+#include "core/macros.h"
+
+namespace draco {
+
+// Read-only view of the attribute values stored in the DataBuffer of a
+// PointAttribute. The view borrows the storage of the attribute and never
+// copies it. Because the view does not extend the lifetime of the attribute,
+// it records the buffer address and the buffer update count at the time it
+// was created. IsValid() can be used to detect that the underlying buffer was
+// modified or reallocated since then, in which case the view must be
+// re-created.
+//
+// Usage:
+//   const PointAttribute *const pos_att =
+//       pc->GetNamedAttribute(GeometryAttribute::POSITION);
+//   PointAttributeView view(*pos_att);
+//   if (view.IsValid() && view.data_type() == DT_FLOAT32) {
+//     const float *const p = view.GetValue<float>(AttributeValueIndex(0));
+//   }
+class PointAttributeView {
+ public:
+  PointAttributeView()
+      : buffer_(nullptr),
+        data_(nullptr),
+        update_count_(0),
+        num_values_(0),
+        byte_stride_(0),
+        num_components_(0),
+        data_type_(DT_INVALID) {}
+
+  explicit PointAttributeView(const PointAttribute &attribute)
+      : buffer_(attribute.buffer()),
+        data_(nullptr),
+        update_count_(0),
+        num_values_(attribute.size()),
+        byte_stride_(attribute.byte_stride()),
+        num_components_(attribute.num_components()),
+        data_type_(attribute.data_type()) {
+    if (buffer_ != nullptr) {
+      data_ = buffer_->data() + attribute.byte_offset();
+      update_count_ = buffer_->update_count();
+    }
+  }
+
+  // Returns true when the viewed buffer still exists at the same address and
+  // was not updated since the view was created. The attribute itself must
+  // still be alive for this check to be meaningful.
+  bool IsValid() const {
+    if (buffer_ == nullptr || data_ == nullptr) {
+      return num_values_ == 0 && buffer_ != nullptr;
+    }
+    return buffer_->update_count() == update_count_ &&
+           buffer_->data() != nullptr &&
+           data_ >= buffer_->data() &&
+           data_ + byte_stride_ * static_cast<int64_t>(num_values_) <=
+               buffer_->data() + buffer_->data_size();
+  }
+
+  // Returns the address of the first component of the value at |index|.
+  template <typename T>
+  const T *GetValue(AttributeValueIndex index) const {
+    DRACO_DCHECK(IsValid());
+    DRACO_DCHECK_LT(index.value(), num_values_);
+    return reinterpret_cast<const T *>(data_ + byte_stride_ * index.value());
+  }
+
+  // Returns true when there are no gaps between consecutive values, i.e. the
+  // whole content of the view can be copied with a single memcpy().
+  bool is_tightly_packed() const {
+    return byte_stride_ ==
+           static_cast<int64_t>(DataTypeLength(data_type_)) * num_components_;
+  }
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return num_values_; }
+  size_t size_in_bytes() const {
+    return num_values_ == 0 ? 0 : byte_stride_ * num_values_;
+  }
+  int64_t byte_stride() const { return byte_stride_; }
+  int8_t num_components() const { return num_components_; }
+  DataType data_type() const { return data_type_; }
+
+ private:
+  const DataBuffer *buffer_;
+  const uint8_t *data_;
+  int64_t update_count_;
+  size_t num_values_;
+  int64_t byte_stride_;
+  int8_t num_components_;
+  DataType data_type_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_ATTRIBUTES_POINT_ATTRIBUTE_VIEW_H_
@@ -0,0 +1,109 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "attributes/point_attribute_view.h"
+
+#include <vector>
+
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class PointAttributeViewTest : public ::testing::Test {
+ protected:
+  PointAttributeViewTest() : attribute_(CreateGeometryAttribute()) {
+    for (int i = 0; i < 30; ++i) {
+      values_.push_back(static_cast<float>(i));
+    }
+  }
+
+  static GeometryAttribute CreateGeometryAttribute() {
+    GeometryAttribute attribute;
+    attribute.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+                   3 * sizeof(float), 0);
+    return attribute;
+  }
+
+  std::vector<float> values_;
+  PointAttribute attribute_;
+};
+
+TEST_F(PointAttributeViewTest, TestView) {
+  ASSERT_TRUE(attribute_.SetValuesFromInterleavedData(values_.data(), 0, 10));
+  const PointAttributeView view(attribute_);
+  ASSERT_TRUE(view.IsValid());
+  EXPECT_EQ(view.size(), 10u);
+  EXPECT_EQ(view.size_in_bytes(), 10 * 3 * sizeof(float));
+  EXPECT_EQ(view.byte_stride(), static_cast<int64_t>(3 * sizeof(float)));
+  EXPECT_EQ(view.num_components(), 3);
+  EXPECT_EQ(view.data_type(), DT_FLOAT32);
+  EXPECT_TRUE(view.is_tightly_packed());
+  // The view borrows the storage of the attribute.
+  EXPECT_EQ(view.data(), attribute_.buffer()->data());
+  for (int i = 0; i < 10; ++i) {
+    const float *const value = view.GetValue<float>(AttributeValueIndex(i));
+    EXPECT_EQ(value[0], values_[3 * i]);
+    EXPECT_EQ(value[2], values_[3 * i + 2]);
+  }
+}
+
+TEST_F(PointAttributeViewTest, TestDefaultView) {
+  const PointAttributeView view;
+  EXPECT_FALSE(view.IsValid());
+  EXPECT_EQ(view.size(), 0u);
+  EXPECT_EQ(view.size_in_bytes(), 0u);
+
+  // An attribute without storage can't be viewed either.
+  EXPECT_FALSE(PointAttributeView(attribute_).IsValid());
+}
+
+TEST_F(PointAttributeViewTest, TestEmptyAttribute) {
+  ASSERT_TRUE(attribute_.SetValuesFromInterleavedData(values_.data(), 0, 0));
+  const PointAttributeView view(attribute_);
+  EXPECT_TRUE(view.IsValid());
+  EXPECT_EQ(view.size(), 0u);
+  EXPECT_EQ(view.size_in_bytes(), 0u);
+}
+
+TEST_F(PointAttributeViewTest, TestInvalidatedByUpdates) {
+  ASSERT_TRUE(attribute_.SetValuesFromInterleavedData(values_.data(), 0, 10));
+  {
+    // Values overwritten in the same storage.
+    const PointAttributeView view(attribute_);
+    ASSERT_TRUE(attribute_.SetValuesFromInterleavedData(values_.data(), 0, 10));
+    EXPECT_EQ(attribute_.buffer()->data(), view.data());
+    EXPECT_FALSE(view.IsValid());
+  }
+  {
+    // Reallocated storage.
+    const PointAttributeView view(attribute_);
+    ASSERT_TRUE(attribute_.SetValuesFromInterleavedData(values_.data(), 0, 5));
+    EXPECT_FALSE(view.IsValid());
+  }
+  {
+    // Adopted storage.
+    const PointAttributeView view(attribute_);
+    ASSERT_TRUE(attribute_.AdoptValues(std::vector<uint8_t>(24)));
+    EXPECT_FALSE(view.IsValid());
+    EXPECT_TRUE(PointAttributeView(attribute_).IsValid());
+  }
+  {
+    // Released storage.
+    const PointAttributeView view(attribute_);
+    attribute_.buffer()->Release();
+    EXPECT_FALSE(view.IsValid());
+  }
+}
+
+}  // namespace draco
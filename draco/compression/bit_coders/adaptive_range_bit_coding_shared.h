@@ -0,0 +1,44 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// File provides shared constants of the adaptive range bit coders.
+#ifndef DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_CODING_SHARED_H_
+#define DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_CODING_SHARED_H_
+
+#include <cstdint>
+
+#include "core/macros.h"
+
+namespace draco {
+
+// Precision of the probability of a zero bit.
+constexpr int kAdaptiveRangeBitProbabilityBits = 11;
+constexpr uint32_t kAdaptiveRangeBitProbabilityScale =
+    1u << kAdaptiveRangeBitProbabilityBits;
+
+// The probability moves by 1/32 of the distance to the coded bit, which
+// adapts faster than the rANS bit coders (1/128) to the changing statistics
+// of the kd-tree levels.
+constexpr int kAdaptiveRangeBitAdaptationShift = 5;
+
+// The range is renormalized by a byte when it drops below this value.
+constexpr uint32_t kAdaptiveRangeBitTopValue = 1u << 24;
+
+// One probability for single bits and one for each of the 32 bit positions
+// of the values coded with *LeastSignificantBits32().
+constexpr int kAdaptiveRangeBitNumProbabilities = 33;
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_CODING_SHARED_H_
@@ -0,0 +1,222 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <random>
+#include <vector>
+
+#include "compression/bit_coders/adaptive_range_bit_decoder.h"
+#include "compression/bit_coders/adaptive_range_bit_encoder.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class AdaptiveRangeBitCodingTest : public ::testing::Test {
+ protected:
+  AdaptiveRangeBitCodingTest() : rng_(7) {}
+
+  // Returns |num_bits| random bits that are set with |probability_one|.
+  std::vector<bool> CreateBits(size_t num_bits, double probability_one) {
+    std::bernoulli_distribution dist(probability_one);
+    std::vector<bool> bits(num_bits);
+    for (size_t i = 0; i < num_bits; ++i) {
+      bits[i] = dist(rng_);
+    }
+    return bits;
+  }
+
+  static void EncodeBits(const std::vector<bool> &bits,
+                         EncoderBuffer *buffer) {
+    AdaptiveRangeBitEncoder encoder;
+    encoder.StartEncoding();
+    for (const bool bit : bits) {
+      encoder.EncodeBit(bit);
+    }
+    encoder.EndEncoding(buffer);
+  }
+
+  void TestRoundTrip(const std::vector<bool> &bits) {
+    EncoderBuffer buffer;
+    EncodeBits(bits, &buffer);
+    DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), buffer.size());
+    AdaptiveRangeBitDecoder decoder;
+    ASSERT_TRUE(decoder.StartDecoding(&in_buffer));
+    for (size_t i = 0; i < bits.size(); ++i) {
+      ASSERT_EQ(decoder.DecodeNextBit(), bits[i]) << i;
+    }
+    decoder.EndDecoding();
+    EXPECT_EQ(in_buffer.remaining_size(), 0);
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(AdaptiveRangeBitCodingTest, TestBits) {
+  TestRoundTrip({});
+  TestRoundTrip({false});
+  TestRoundTrip({true});
+  for (const double probability_one : {0.0, 0.001, 0.1, 0.5, 0.9, 0.999, 1.0}) {
+    for (const size_t num_bits : {1, 2, 31, 1000, 100000}) {
+      TestRoundTrip(CreateBits(num_bits, probability_one));
+    }
+  }
+  // Long runs of ones push |low_| close to the top of the range and produce
+  // carries into the held back bytes.
+  std::vector<bool> bits = CreateBits(1000, 0.5);
+  const std::vector<bool> ones(20000, true);
+  bits.insert(bits.end(), ones.begin(), ones.end());
+  const std::vector<bool> tail = CreateBits(1000, 0.5);
+  bits.insert(bits.end(), tail.begin(), tail.end());
+  TestRoundTrip(bits);
+}
+
+TEST_F(AdaptiveRangeBitCodingTest, TestCompression) {
+  // Skewed bits are coded with much less than a bit each, constant bits with
+  // nearly nothing.
+  EncoderBuffer buffer;
+  EncodeBits(CreateBits(80000, 0.02), &buffer);
+  EXPECT_LT(buffer.size(), 80000 / 8 / 4);
+  EncoderBuffer constant_buffer;
+  EncodeBits(std::vector<bool>(80000, false), &constant_buffer);
+  EXPECT_LT(constant_buffer.size(), 16);
+}
+
+TEST_F(AdaptiveRangeBitCodingTest, TestLeastSignificantBits) {
+  std::vector<std::pair<int, uint32_t>> values;
+  std::geometric_distribution<uint32_t> dist(0.05);
+  for (int i = 0; i < 10000; ++i) {
+    const int nbits = 1 + i % 32;
+    const uint32_t mask =
+        nbits == 32 ? 0xffffffffu : (static_cast<uint32_t>(1) << nbits) - 1;
+    // Mostly small values, with some full width ones.
+    const uint32_t value = (i % 7 == 0 ? rng_() : dist(rng_)) & mask;
+    values.push_back({nbits, value});
+  }
+  values.push_back({32, 0xffffffffu});
+  values.push_back({32, 0});
+
+  AdaptiveRangeBitEncoder encoder;
+  encoder.StartEncoding();
+  for (size_t i = 0; i < values.size(); ++i) {
+    encoder.EncodeLeastSignificantBits32(values[i].first, values[i].second);
+    // Interleave single bits, which use their own probability.
+    encoder.EncodeBit(i % 3 == 0);
+  }
+  EncoderBuffer buffer;
+  encoder.EndEncoding(&buffer);
+
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  AdaptiveRangeBitDecoder decoder;
+  ASSERT_TRUE(decoder.StartDecoding(&in_buffer));
+  for (size_t i = 0; i < values.size(); ++i) {
+    uint32_t value;
+    decoder.DecodeLeastSignificantBits32(values[i].first, &value);
+    ASSERT_EQ(value, values[i].second) << i;
+    ASSERT_EQ(decoder.DecodeNextBit(), i % 3 == 0) << i;
+  }
+  EXPECT_EQ(in_buffer.remaining_size(), 0);
+}
+
+TEST_F(AdaptiveRangeBitCodingTest, TestCallerContexts) {
+  // Probabilities owned by the caller are kept across several buffers, while
+  // the internal ones are reset by StartEncoding() and StartDecoding().
+  constexpr int kNumContexts = 4;
+  constexpr int kNumBuffers = 3;
+  std::vector<std::vector<bool>> bits(kNumBuffers);
+  for (int i = 0; i < kNumBuffers; ++i) {
+    bits[i] = CreateBits(4000, 0.2);
+  }
+  std::vector<uint16_t> encoder_contexts(kNumContexts,
+                                         kAdaptiveRangeBitProbabilityScale / 2);
+  std::vector<uint16_t> decoder_contexts = encoder_contexts;
+  AdaptiveRangeBitEncoder encoder;
+  EncoderBuffer buffer;
+  for (int i = 0; i < kNumBuffers; ++i) {
+    encoder.StartEncoding();
+    for (size_t j = 0; j < bits[i].size(); ++j) {
+      // The context depends on the previous bit.
+      const int context = j == 0 ? 0 : 1 + bits[i][j - 1];
+      encoder.EncodeBit(bits[i][j], &encoder_contexts[context]);
+      encoder.EncodeBit(!bits[i][j]);
+    }
+    encoder.EndEncoding(&buffer);
+  }
+
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  AdaptiveRangeBitDecoder decoder;
+  for (int i = 0; i < kNumBuffers; ++i) {
+    ASSERT_TRUE(decoder.StartDecoding(&in_buffer));
+    bool previous_bit = false;
+    for (size_t j = 0; j < bits[i].size(); ++j) {
+      const int context = j == 0 ? 0 : 1 + previous_bit;
+      previous_bit = decoder.DecodeBit(&decoder_contexts[context]);
+      ASSERT_EQ(previous_bit, bits[i][j]) << i << " " << j;
+      ASSERT_EQ(decoder.DecodeNextBit(), !bits[i][j]) << i << " " << j;
+    }
+  }
+  EXPECT_EQ(in_buffer.remaining_size(), 0);
+  EXPECT_EQ(decoder_contexts, encoder_contexts);
+}
+
+TEST_F(AdaptiveRangeBitCodingTest, TestTruncatedData) {
+  EncoderBuffer buffer;
+  EncodeBits(CreateBits(10000, 0.3), &buffer);
+  // The size of the coded data is checked against the buffer.
+  for (size_t size = 0; size < buffer.size(); ++size) {
+    DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), size);
+    AdaptiveRangeBitDecoder decoder;
+    ASSERT_FALSE(decoder.StartDecoding(&in_buffer)) << size;
+  }
+}
+
+TEST_F(AdaptiveRangeBitCodingTest, TestCorruptedData) {
+  const std::vector<bool> bits = CreateBits(10000, 0.3);
+  EncoderBuffer buffer;
+  EncodeBits(bits, &buffer);
+  const std::vector<char> data(buffer.data(), buffer.data() + buffer.size());
+
+  // A size larger than the data is rejected.
+  std::vector<char> corrupted = data;
+  corrupted[0] = static_cast<char>(0xff);
+  corrupted[1] = static_cast<char>(0x7f);
+  DecoderBuffer in_buffer;
+  in_buffer.Init(corrupted.data(), corrupted.size());
+  AdaptiveRangeBitDecoder decoder;
+  EXPECT_FALSE(decoder.StartDecoding(&in_buffer));
+
+  // Flipped bits in the coded data decode to different bits, without
+  // reading past the data. Decoding more bits than were coded is allowed.
+  for (int i = 0; i < 200; ++i) {
+    corrupted = data;
+    const size_t offset = 2 + rng_() % (corrupted.size() - 2);
+    corrupted[offset] ^= static_cast<char>(1 << (rng_() % 8));
+    DecoderBuffer corrupted_buffer;
+    corrupted_buffer.Init(corrupted.data(), corrupted.size());
+    AdaptiveRangeBitDecoder corrupted_decoder;
+    ASSERT_TRUE(corrupted_decoder.StartDecoding(&corrupted_buffer));
+    bool equal = true;
+    for (size_t j = 0; j < bits.size() + 1000; ++j) {
+      const bool bit = corrupted_decoder.DecodeNextBit();
+      if (j < bits.size() && bit != bits[j]) {
+        equal = false;
+      }
+    }
+    EXPECT_FALSE(equal) << offset;
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,52 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/bit_coders/adaptive_range_bit_decoder.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "core/varint_decoding.h"
+
+namespace draco {
+
+AdaptiveRangeBitDecoder::AdaptiveRangeBitDecoder()
+    : data_(nullptr),
+      data_end_(nullptr),
+      code_(0),
+      range_(0xffffffff) {
+  std::fill(std::begin(probabilities_), std::end(probabilities_),
+            kAdaptiveRangeBitProbabilityScale / 2);
+}
+
+bool AdaptiveRangeBitDecoder::StartDecoding(DecoderBuffer *source_buffer) {
+  uint32_t size;
+  if (!DecodeVarint(&size, source_buffer) ||
+      size > static_cast<uint64_t>(source_buffer->remaining_size())) {
+    return false;
+  }
+  data_ = reinterpret_cast<const uint8_t *>(source_buffer->data_head());
+  data_end_ = data_ + size;
+  source_buffer->Advance(size);
+  code_ = 0;
+  range_ = 0xffffffff;
+  std::fill(std::begin(probabilities_), std::end(probabilities_),
+            kAdaptiveRangeBitProbabilityScale / 2);
+  for (int i = 0; i < 4; ++i) {
+    code_ = (code_ << 8) | NextByte();
+  }
+  return true;
+}
+
+}  // namespace draco
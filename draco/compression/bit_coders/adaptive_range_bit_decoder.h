@@ -0,0 +1,87 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_DECODER_H_
+#define DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_DECODER_H_
+
+#include "compression/bit_coders/adaptive_range_bit_coding_shared.h"
+#include "core/decoder_buffer.h"
+
+namespace draco {
+
+// Class for decoding a sequence of bits that were encoded with
+// AdaptiveRangeBitEncoder.
+class AdaptiveRangeBitDecoder {
+ public:
+  AdaptiveRangeBitDecoder();
+
+  // Sets |source_buffer| as the buffer to decode bits from.
+  bool StartDecoding(DecoderBuffer *source_buffer);
+
+  // Decode one bit. Returns true if the bit is a 1, otherwise false.
+  bool DecodeNextBit() { return DecodeBit(&probabilities_[0]); }
+
+  // Decode the next |nbits| and return the sequence in |value|. |nbits| must be
+  // > 0 and <= 32.
+  void DecodeLeastSignificantBits32(int nbits, uint32_t *value) {
+    DRACO_DCHECK_EQ(true, nbits <= 32);
+    DRACO_DCHECK_EQ(true, nbits > 0);
+    uint32_t result = 0;
+    for (int i = nbits - 1; i >= 0; --i) {
+      result = (result << 1) | DecodeBit(&probabilities_[1 + i]);
+    }
+    *value = result;
+  }
+
+  void EndDecoding() {}
+
+  // Decodes a bit that was encoded with AdaptiveRangeBitEncoder::EncodeBit()
+  // and the same |probability|, and updates the probability.
+  bool DecodeBit(uint16_t *probability) {
+    const uint32_t bound =
+        (range_ >> kAdaptiveRangeBitProbabilityBits) * *probability;
+    bool bit;
+    if (code_ < bound) {
+      range_ = bound;
+      *probability += (kAdaptiveRangeBitProbabilityScale - *probability) >>
+                      kAdaptiveRangeBitAdaptationShift;
+      bit = false;
+    } else {
+      code_ -= bound;
+      range_ -= bound;
+      *probability -= *probability >> kAdaptiveRangeBitAdaptationShift;
+      bit = true;
+    }
+    while (range_ < kAdaptiveRangeBitTopValue) {
+      range_ <<= 8;
+      code_ = (code_ << 8) | NextByte();
+    }
+    return bit;
+  }
+
+ private:
+  // Returns the next coded byte. Reading past the end of the data returns
+  // zeros, the encoder does not store trailing zero bytes.
+  uint8_t NextByte() { return data_ < data_end_ ? *data_++ : 0; }
+
+  const uint8_t *data_;
+  const uint8_t *data_end_;
+  uint32_t code_;
+  uint32_t range_;
+  uint16_t probabilities_[kAdaptiveRangeBitNumProbabilities];
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_DECODER_H_
@@ -0,0 +1,76 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/bit_coders/adaptive_range_bit_encoder.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "core/varint_encoding.h"
+
+namespace draco {
+
+AdaptiveRangeBitEncoder::AdaptiveRangeBitEncoder() { StartEncoding(); }
+
+void AdaptiveRangeBitEncoder::StartEncoding() {
+  low_ = 0;
+  range_ = 0xffffffff;
+  std::fill(std::begin(probabilities_), std::end(probabilities_),
+            kAdaptiveRangeBitProbabilityScale / 2);
+  cache_ = 0;
+  cache_size_ = 1;
+  bytes_.clear();
+}
+
+void AdaptiveRangeBitEncoder::EndEncoding(EncoderBuffer *target_buffer) {
+  // Any value in [low_, low_ + range_) identifies the coded bits. Select the
+  // one with the most trailing zero bits, the zero bytes at the end of the
+  // data are not stored.
+  const uint64_t high = low_ + range_;
+  for (int shift = 32; shift > 0; --shift) {
+    const uint64_t mask = (uint64_t(1) << shift) - 1;
+    const uint64_t value = (low_ + mask) & ~mask;
+    if (value < high) {
+      low_ = value;
+      break;
+    }
+  }
+  for (int i = 0; i < 5; ++i) {
+    ShiftLow();
+  }
+  while (bytes_.size() > 1 && bytes_.back() == 0) {
+    bytes_.pop_back();
+  }
+  // The first byte is always zero and is not stored.
+  const size_t size = bytes_.size() - 1;
+  EncodeVarint(static_cast<uint32_t>(size), target_buffer);
+  target_buffer->Encode(bytes_.data() + 1, size);
+  StartEncoding();
+}
+
+void AdaptiveRangeBitEncoder::ShiftLow() {
+  if (static_cast<uint32_t>(low_) < 0xff000000u || (low_ >> 32) != 0) {
+    const uint8_t carry = static_cast<uint8_t>(low_ >> 32);
+    uint8_t byte = cache_;
+    do {
+      bytes_.push_back(static_cast<uint8_t>(byte + carry));
+      byte = 0xff;
+    } while (--cache_size_ != 0);
+    cache_ = static_cast<uint8_t>(low_ >> 24);
+  }
+  ++cache_size_;
+  low_ = (low_ & 0x00ffffff) << 8;
+}
+
+}  // namespace draco
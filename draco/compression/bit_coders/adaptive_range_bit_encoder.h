@@ -0,0 +1,95 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_ENCODER_H_
+#define DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_ENCODER_H_
+
+#include <vector>
+
+#include "compression/bit_coders/adaptive_range_bit_coding_shared.h"
+#include "core/encoder_buffer.h"
+
+namespace draco {
+
+// Class for adaptive encoding of a sequence of bits with a binary range
+// coder. Unlike the rANS bit encoders, which have to store all bits and code
+// them in reverse order in EndEncoding(), each bit is coded as soon as it is
+// added, so the encoder only stores the coded bytes. Has the same interface
+// as the other bit encoders and can be used in their place, but the coded
+// data can only be decoded by AdaptiveRangeBitDecoder.
+class AdaptiveRangeBitEncoder {
+ public:
+  AdaptiveRangeBitEncoder();
+
+  // Must be called before any Encode* function is called.
+  void StartEncoding();
+
+  // Encode one bit. If |bit| is true encode a 1, otherwise encode a 0.
+  void EncodeBit(bool bit) { EncodeBit(bit, &probabilities_[0]); }
+
+  // Encode |nbits| of |value|, starting from the least significant bit.
+  // |nbits| must be > 0 and <= 32. Each bit position is coded with its own
+  // probability, the high bits of small numbers are then nearly free.
+  void EncodeLeastSignificantBits32(int nbits, uint32_t value) {
+    DRACO_DCHECK_EQ(true, nbits <= 32);
+    DRACO_DCHECK_EQ(true, nbits > 0);
+    for (int i = nbits - 1; i >= 0; --i) {
+      EncodeBit((value >> i) & 1, &probabilities_[1 + i]);
+    }
+  }
+
+  // Ends the bit encoding and stores the result into the target_buffer.
+  void EndEncoding(EncoderBuffer *target_buffer);
+
+  // Encodes |bit| with the probability of a zero bit in |probability| and
+  // updates the probability. Allows coding with contexts owned by the
+  // caller, which may be kept across several encoded buffers. Probabilities
+  // start at kAdaptiveRangeBitProbabilityScale / 2.
+  void EncodeBit(bool bit, uint16_t *probability) {
+    const uint32_t bound =
+        (range_ >> kAdaptiveRangeBitProbabilityBits) * *probability;
+    if (bit) {
+      low_ += bound;
+      range_ -= bound;
+      *probability -= *probability >> kAdaptiveRangeBitAdaptationShift;
+    } else {
+      range_ = bound;
+      *probability += (kAdaptiveRangeBitProbabilityScale - *probability) >>
+                      kAdaptiveRangeBitAdaptationShift;
+    }
+    while (range_ < kAdaptiveRangeBitTopValue) {
+      range_ <<= 8;
+      ShiftLow();
+    }
+  }
+
+ private:
+  // Moves the top byte of |low_| to the output. A byte is held back in
+  // |cache_| as long as a carry can still propagate into it.
+  void ShiftLow();
+
+  uint64_t low_;
+  uint32_t range_;
+  // Probability of EncodeBit() followed by the probabilities of the bit
+  // positions of EncodeLeastSignificantBits32().
+  uint16_t probabilities_[kAdaptiveRangeBitNumProbabilities];
+  uint8_t cache_;
+  // Number of pending bytes: |cache_| followed by 0xff bytes.
+  uint64_t cache_size_;
+  std::vector<uint8_t> bytes_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_BIT_CODERS_ADAPTIVE_RANGE_BIT_ENCODER_H_
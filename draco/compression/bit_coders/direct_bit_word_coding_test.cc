@@ -0,0 +1,233 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "compression/bit_coders/direct_bit_decoder.h"
+#include "compression/bit_coders/direct_bit_encoder.h"
+#include "compression/bit_coders/direct_bit_word_decoder.h"
+#include "compression/bit_coders/direct_bit_word_encoder.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class DirectBitWordCodingTest : public ::testing::Test {
+ protected:
+  // A value of |nbits| bits, or of zero bits for EncodeBit().
+  struct Value {
+    int nbits;
+    uint32_t value;
+  };
+
+  DirectBitWordCodingTest() : rng_(3) {}
+
+  // Returns |num_values| random values of |nbits| bits each. The bits above
+  // |nbits| are random too, they must be ignored by the encoders.
+  std::vector<Value> CreateValues(int nbits, size_t num_values) {
+    std::vector<Value> values(num_values);
+    for (Value &value : values) {
+      value.nbits = nbits;
+      value.value = rng_();
+    }
+    return values;
+  }
+
+  // Returns |num_values| random values of random widths, including single
+  // bits.
+  std::vector<Value> CreateMixedValues(size_t num_values) {
+    std::uniform_int_distribution<int> nbits_dist(0, 32);
+    std::vector<Value> values(num_values);
+    for (Value &value : values) {
+      value.nbits = nbits_dist(rng_);
+      value.value = rng_();
+    }
+    return values;
+  }
+
+  template <class BitEncoderT>
+  static std::string Encode(const std::vector<Value> &values) {
+    BitEncoderT encoder;
+    encoder.StartEncoding();
+    for (const Value &value : values) {
+      if (value.nbits == 0) {
+        encoder.EncodeBit(value.value & 1);
+      } else {
+        encoder.EncodeLeastSignificantBits32(value.nbits, value.value);
+      }
+    }
+    EncoderBuffer buffer;
+    encoder.EndEncoding(&buffer);
+    return std::string(buffer.data(), buffer.size());
+  }
+
+  // Expects DirectBitWordEncoder to produce the same data as
+  // DirectBitEncoder for |values|.
+  static void ExpectSameData(const std::vector<Value> &values) {
+    EXPECT_EQ(Encode<DirectBitWordEncoder>(values),
+              Encode<DirectBitEncoder>(values))
+        << values.size();
+  }
+
+  // Decodes |values| from |data| with |BitDecoderT| and expects all of the
+  // data to be used.
+  template <class BitDecoderT>
+  static void ExpectDecodedValues(const std::string &data,
+                                  const std::vector<Value> &values) {
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    BitDecoderT decoder;
+    ASSERT_TRUE(decoder.StartDecoding(&buffer));
+    EXPECT_EQ(buffer.remaining_size(), 0);
+    for (size_t i = 0; i < values.size(); ++i) {
+      const Value &value = values[i];
+      if (value.nbits == 0) {
+        ASSERT_EQ(decoder.DecodeNextBit(), (value.value & 1) != 0) << i;
+      } else {
+        uint32_t decoded_value;
+        ASSERT_TRUE(
+            decoder.DecodeLeastSignificantBits32(value.nbits, &decoded_value))
+            << i;
+        const uint32_t mask =
+            value.nbits == 32 ? 0xffffffff : (1u << value.nbits) - 1;
+        ASSERT_EQ(decoded_value, value.value & mask) << i;
+      }
+    }
+    decoder.EndDecoding();
+  }
+
+  // Returns the number of values of |nbits| bits that can be decoded from
+  // |data| before |BitDecoderT| fails.
+  template <class BitDecoderT>
+  static size_t CountDecodableValues(const std::string &data, int nbits) {
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    BitDecoderT decoder;
+    if (!decoder.StartDecoding(&buffer)) {
+      return 0;
+    }
+    size_t num_values = 0;
+    uint32_t value;
+    while (decoder.DecodeLeastSignificantBits32(nbits, &value)) {
+      ++num_values;
+    }
+    return num_values;
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(DirectBitWordCodingTest, TestEncoderWidths) {
+  // Every width with numbers of values that end the data in any byte of the
+  // last word, and exactly at the end of a word.
+  for (int nbits = 1; nbits <= 32; ++nbits) {
+    for (const size_t num_values : {1, 2, 3, 5, 7, 31, 32, 33, 64, 100}) {
+      ExpectSameData(CreateValues(nbits, num_values));
+    }
+  }
+  ExpectSameData({});
+}
+
+TEST_F(DirectBitWordCodingTest, TestEncoderMixedWidths) {
+  for (const size_t num_values : {1, 2, 10, 1000, 10000}) {
+    ExpectSameData(CreateMixedValues(num_values));
+  }
+  // Single bits followed by values that cross a word.
+  std::vector<Value> values = CreateValues(0, 31);
+  const std::vector<Value> wide_values = CreateValues(32, 3);
+  values.insert(values.end(), wide_values.begin(), wide_values.end());
+  ExpectSameData(values);
+}
+
+TEST_F(DirectBitWordCodingTest, TestEncoderReuse) {
+  // The encoder starts from scratch after EndEncoding().
+  const std::vector<Value> first_values = CreateValues(13, 77);
+  const std::vector<Value> second_values = CreateValues(5, 13);
+  DirectBitWordEncoder encoder;
+  EncoderBuffer buffer;
+  for (const auto *values : {&first_values, &second_values}) {
+    encoder.StartEncoding();
+    for (const Value &value : *values) {
+      encoder.EncodeLeastSignificantBits32(value.nbits, value.value);
+    }
+    encoder.EndEncoding(&buffer);
+  }
+  EXPECT_EQ(std::string(buffer.data(), buffer.size()),
+            Encode<DirectBitEncoder>(first_values) +
+                Encode<DirectBitEncoder>(second_values));
+}
+
+TEST_F(DirectBitWordCodingTest, TestDecoderRoundTrip) {
+  for (int nbits = 1; nbits <= 32; ++nbits) {
+    for (const size_t num_values : {1, 3, 7, 32, 33, 100}) {
+      const std::vector<Value> values = CreateValues(nbits, num_values);
+      ExpectDecodedValues<DirectBitWordDecoder>(
+          Encode<DirectBitWordEncoder>(values), values);
+    }
+  }
+  for (const size_t num_values : {1, 10, 10000}) {
+    const std::vector<Value> values = CreateMixedValues(num_values);
+    const std::string data = Encode<DirectBitWordEncoder>(values);
+    ExpectDecodedValues<DirectBitWordDecoder>(data, values);
+    ExpectDecodedValues<DirectBitDecoder>(data, values);
+  }
+}
+
+TEST_F(DirectBitWordCodingTest, TestDecoderEndOfData) {
+  // Values are decoded until the last word is used up, the same as with
+  // DirectBitDecoder, also when a value would continue past the end.
+  for (int nbits = 1; nbits <= 32; ++nbits) {
+    for (const size_t num_values : {0, 1, 5, 31, 32, 33}) {
+      const std::string data =
+          Encode<DirectBitWordEncoder>(CreateValues(nbits, num_values));
+      const size_t num_decodable_values =
+          CountDecodableValues<DirectBitWordDecoder>(data, nbits);
+      EXPECT_EQ(num_decodable_values,
+                CountDecodableValues<DirectBitDecoder>(data, nbits))
+          << nbits << " " << num_values;
+      EXPECT_EQ(num_decodable_values, (data.size() - 4) * 8 / nbits);
+    }
+  }
+
+  // Past the end, DecodeNextBit() returns false like for a 0 bit.
+  const std::string data = Encode<DirectBitWordEncoder>(CreateValues(0, 32));
+  DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  DirectBitWordDecoder decoder;
+  ASSERT_TRUE(decoder.StartDecoding(&buffer));
+  uint32_t value;
+  ASSERT_TRUE(decoder.DecodeLeastSignificantBits32(32, &value));
+  ASSERT_TRUE(decoder.DecodeLeastSignificantBits32(32, &value));
+  EXPECT_FALSE(decoder.DecodeNextBit());
+  EXPECT_FALSE(decoder.DecodeLeastSignificantBits32(1, &value));
+}
+
+TEST_F(DirectBitWordCodingTest, TestDecoderInvalidSize) {
+  // The stored size must be a non-zero multiple of 4 and fit into the buffer.
+  std::string data = Encode<DirectBitWordEncoder>(CreateValues(32, 3));
+  DirectBitWordDecoder decoder;
+  for (const uint32_t size_in_bytes : {0, 3, 13, 20}) {
+    memcpy(&data[0], &size_in_bytes, sizeof(size_in_bytes));
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    EXPECT_FALSE(decoder.StartDecoding(&buffer)) << size_in_bytes;
+  }
+  DecoderBuffer buffer;
+  buffer.Init(data.data(), 3);
+  EXPECT_FALSE(decoder.StartDecoding(&buffer));
+}
+
+}  // namespace draco
@@ -0,0 +1,42 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/bit_coders/direct_bit_word_decoder.h"
+
+namespace draco {
+
+DirectBitWordDecoder::DirectBitWordDecoder()
+    : data_(nullptr), num_bits_(0), bit_pos_(0) {}
+
+bool DirectBitWordDecoder::StartDecoding(DecoderBuffer *source_buffer) {
+  uint32_t size_in_bytes;
+  if (!source_buffer->Decode(&size_in_bytes)) {
+    return false;
+  }
+  // Same checks as DirectBitDecoder, the encoder always stores at least one
+  // 32-bit word.
+  if (size_in_bytes == 0 || size_in_bytes & 0x3) {
+    return false;
+  }
+  if (size_in_bytes > source_buffer->remaining_size()) {
+    return false;
+  }
+  data_ = source_buffer->data_head();
+  num_bits_ = static_cast<uint64_t>(size_in_bytes) * 8;
+  bit_pos_ = 0;
+  source_buffer->Advance(size_in_bytes);
+  return true;
+}
+
+}  // namespace draco
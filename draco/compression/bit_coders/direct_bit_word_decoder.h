@@ -0,0 +1,83 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_BIT_CODERS_DIRECT_BIT_WORD_DECODER_H_
+#define DRACO_COMPRESSION_BIT_CODERS_DIRECT_BIT_WORD_DECODER_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "core/decoder_buffer.h"
+
+namespace draco {
+
+// Class for decoding bits that were encoded with DirectBitEncoder or
+// DirectBitWordEncoder. Unlike DirectBitDecoder, the 32-bit words are read
+// in place from the source buffer, which must outlive the decoding. Each
+// value is extracted from a 64-bit load of the current and the next word
+// with a single shift sequence.
+//
+// DirectBitDecoder is also compiled into the prebuilt libdraco, so its
+// inline methods can't change from this tree. Decoders of this tree use this
+// class in its place.
+class DirectBitWordDecoder {
+ public:
+  DirectBitWordDecoder();
+
+  // Sets |source_buffer| as the buffer to decode bits from.
+  bool StartDecoding(DecoderBuffer *source_buffer);
+
+  // Decode one bit. Returns true if the bit is a 1, otherwise false.
+  bool DecodeNextBit() {
+    uint32_t value;
+    return DecodeLeastSignificantBits32(1, &value) && value != 0;
+  }
+
+  // Decode the next |nbits| and return the sequence in |value|. |nbits| must be
+  // > 0 and <= 32. Returns false if the data holds less than |nbits| bits.
+  bool DecodeLeastSignificantBits32(int nbits, uint32_t *value) {
+    DRACO_DCHECK_EQ(true, nbits <= 32);
+    DRACO_DCHECK_EQ(true, nbits > 0);
+    if (static_cast<uint64_t>(nbits) > num_bits_ - bit_pos_) {
+      return false;
+    }
+    const uint64_t word_index = bit_pos_ >> 5;
+    const uint32_t num_used_bits = static_cast<uint32_t>(bit_pos_ & 31);
+    // The next word is only loaded when the value continues there, so the
+    // last word is never followed by a load past the end of the data.
+    const uint64_t bits =
+        (static_cast<uint64_t>(LoadWord(word_index)) << 32) |
+        (num_used_bits + nbits > 32 ? LoadWord(word_index + 1) : 0u);
+    *value = static_cast<uint32_t>((bits << num_used_bits) >> (64 - nbits));
+    bit_pos_ += nbits;
+    return true;
+  }
+
+  void EndDecoding() {}
+
+ private:
+  uint32_t LoadWord(uint64_t index) const {
+    uint32_t word;
+    memcpy(&word, data_ + 4 * index, sizeof(word));
+    return word;
+  }
+
+  const char *data_;
+  uint64_t num_bits_;
+  uint64_t bit_pos_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_BIT_CODERS_DIRECT_BIT_WORD_DECODER_H_
@@ -0,0 +1,37 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/bit_coders/direct_bit_word_encoder.h"
+
+namespace draco {
+
+DirectBitWordEncoder::DirectBitWordEncoder() { StartEncoding(); }
+
+void DirectBitWordEncoder::StartEncoding() {
+  words_.clear();
+  local_bits_ = 0;
+  num_local_bits_ = 0;
+}
+
+void DirectBitWordEncoder::EndEncoding(EncoderBuffer *target_buffer) {
+  // Like DirectBitEncoder, the last word is always stored, also when it
+  // holds no bits.
+  words_.push_back(static_cast<uint32_t>(local_bits_ >> 32));
+  const uint32_t size_in_bytes = static_cast<uint32_t>(words_.size()) * 4;
+  target_buffer->Encode(size_in_bytes);
+  target_buffer->Encode(words_.data(), size_in_bytes);
+  StartEncoding();
+}
+
+}  // namespace draco
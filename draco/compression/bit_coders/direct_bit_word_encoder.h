@@ -0,0 +1,71 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_BIT_CODERS_DIRECT_BIT_WORD_ENCODER_H_
+#define DRACO_COMPRESSION_BIT_CODERS_DIRECT_BIT_WORD_ENCODER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "core/encoder_buffer.h"
+
+namespace draco {
+
+// Class for encoding bits without compression in the format of
+// DirectBitEncoder, so the data is decoded by DirectBitDecoder. The pending
+// bits and each new value are merged in a 64-bit register, of which at most
+// one full 32-bit word is flushed per value, without branches on the
+// position of the value in the word.
+//
+// DirectBitEncoder is also compiled into the prebuilt libdraco, so its
+// inline methods can't change from this tree. Encoders of this tree use this
+// class in its place.
+class DirectBitWordEncoder {
+ public:
+  DirectBitWordEncoder();
+
+  // Must be called before any Encode* function is called.
+  void StartEncoding();
+
+  // Encode one bit. If |bit| is true encode a 1, otherwise encode a 0.
+  void EncodeBit(bool bit) { EncodeLeastSignificantBits32(1, bit ? 1 : 0); }
+
+  // Encode |nbits| of |value|, starting from the least significant bit.
+  // |nbits| must be > 0 and <= 32.
+  void EncodeLeastSignificantBits32(int nbits, uint32_t value) {
+    DRACO_DCHECK_EQ(true, nbits <= 32);
+    DRACO_DCHECK_EQ(true, nbits > 0);
+    local_bits_ |= (static_cast<uint64_t>(value) << (64 - nbits)) >>
+                   num_local_bits_;
+    num_local_bits_ += nbits;
+    if (num_local_bits_ >= 32) {
+      words_.push_back(static_cast<uint32_t>(local_bits_ >> 32));
+      local_bits_ <<= 32;
+      num_local_bits_ -= 32;
+    }
+  }
+
+  // Ends the bit encoding and stores the result into the target_buffer.
+  void EndEncoding(EncoderBuffer *target_buffer);
+
+ private:
+  std::vector<uint32_t> words_;
+  // Pending bits, starting from the most significant bit.
+  uint64_t local_bits_;
+  uint32_t num_local_bits_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_BIT_CODERS_DIRECT_BIT_WORD_ENCODER_H_
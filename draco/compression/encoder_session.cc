@@ -0,0 +1,126 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/encoder_session.h"
+
+namespace draco {
+
+EncoderSession::EncoderSession()
+    : position_attribute_(nullptr),
+      options_changed_(true),
+      num_encoded_frames_(0) {}
+
+void EncoderSession::SetSpeedOptions(int encoding_speed, int decoding_speed) {
+  const EncoderOptionsBase<GeometryAttribute::Type> &options =
+      encoder_.options();
+  if (options.IsSpeedSet() && options.GetEncodingSpeed() == encoding_speed &&
+      options.GetDecodingSpeed() == decoding_speed) {
+    return;
+  }
+  encoder_.SetSpeedOptions(encoding_speed, decoding_speed);
+  options_changed_ = true;
+}
+
+void EncoderSession::SetAttributeQuantization(GeometryAttribute::Type type,
+                                              int quantization_bits) {
+  if (encoder_.options().GetAttributeInt(type, "quantization_bits", -1) ==
+      quantization_bits) {
+    return;
+  }
+  encoder_.SetAttributeQuantization(type, quantization_bits);
+  options_changed_ = true;
+}
+
+void EncoderSession::SetEncodingMethod(int encoding_method) {
+  if (encoder_.options().GetGlobalInt("encoding_method", -1) ==
+      encoding_method) {
+    return;
+  }
+  encoder_.SetEncodingMethod(encoding_method);
+  options_changed_ = true;
+}
+
+void EncoderSession::Reserve(PointIndex::ValueType max_num_points,
+                             int64_t max_encoded_size) {
+  InitPointCloud(max_num_points);
+  // Growing the attribute to the maximum size and shrinking it back keeps the
+  // capacity of the underlying storage.
+  const PointIndex::ValueType num_points = point_cloud_.num_points();
+  if (position_attribute_->size() < max_num_points) {
+    position_attribute_->Reset(max_num_points);
+    position_attribute_->Reset(num_points);
+  }
+  if (max_encoded_size <= 0) {
+    max_encoded_size =
+        static_cast<int64_t>(max_num_points) * 3 * sizeof(float);
+  }
+  if (static_cast<int64_t>(buffer_.size()) < max_encoded_size) {
+    buffer_.Resize(max_encoded_size);
+    buffer_.Clear();
+  }
+}
+
+Status EncoderSession::EncodePositions(const float *positions,
+                                       PointIndex::ValueType num_points,
+                                       int64_t byte_stride) {
+  return EncodePositions(positions, num_points, byte_stride, &buffer_);
+}
+
+Status EncoderSession::EncodePositions(const float *positions,
+                                       PointIndex::ValueType num_points,
+                                       int64_t byte_stride,
+                                       EncoderBuffer *out_buffer) {
+  if (positions == nullptr || num_points == 0) {
+    return Status(Status::INVALID_PARAMETER, "Empty frame.");
+  }
+  InitPointCloud(num_points);
+  point_cloud_.set_num_points(num_points);
+  if (!position_attribute_->SetValuesFromInterleavedData(
+          positions, byte_stride, num_points)) {
+    return Status(Status::INVALID_PARAMETER, "Invalid position data.");
+  }
+  if (options_changed_ || expert_encoder_ == nullptr) {
+    // Option parsing is done only once per option change. The expert encoder
+    // keeps a reference to |point_cloud_| that stays valid for the lifetime
+    // of the session.
+    expert_encoder_.reset(new ExpertEncoder(point_cloud_));
+    expert_encoder_->Reset(encoder_.CreateExpertEncoderOptions(point_cloud_));
+    options_changed_ = false;
+  }
+  out_buffer->Clear();
+  DRACO_RETURN_IF_ERROR(expert_encoder_->EncodeToBuffer(out_buffer));
+  ++num_encoded_frames_;
+  return OkStatus();
+}
+
+Status EncoderSession::EncodePointCloud(const PointCloud &pc) {
+  buffer_.Clear();
+  DRACO_RETURN_IF_ERROR(encoder_.EncodePointCloudToBuffer(pc, &buffer_));
+  ++num_encoded_frames_;
+  return OkStatus();
+}
+
+void EncoderSession::InitPointCloud(PointIndex::ValueType num_points) {
+  if (position_attribute_ != nullptr) {
+    return;
+  }
+  GeometryAttribute va;
+  va.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+          sizeof(float) * 3, 0);
+  const int att_id = point_cloud_.AddAttribute(va, true, num_points);
+  position_attribute_ = point_cloud_.attribute(att_id);
+  point_cloud_.set_num_points(num_points);
+}
+
+}  // namespace draco
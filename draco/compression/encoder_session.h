@@ -0,0 +1,115 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ENCODER_SESSION_H_
+#define DRACO_COMPRESSION_ENCODER_SESSION_H_
+
+#include <memory>
+
+#include "compression/encode.h"
+#include "compression/expert_encode.h"
+#include "core/encoder_buffer.h"
+#include "core/status.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Long-lived helper for encoding a sequence of point cloud frames with the
+// same set of options, e.g. frames of a depth camera stream. Unlike the
+// Encoder that is typically created for each frame, the session keeps all of
+// its state alive between frames:
+//
+//   - The input point cloud and the storage of its position attribute.
+//   - The ExpertEncoder together with the options derived from the basic
+//     options. The options are re-derived only after they are changed.
+//   - The output EncoderBuffer.
+//
+// Once the storage has grown to the size of the largest frame (or after an
+// explicit call to Reserve()), the session itself does not allocate any
+// memory while encoding a frame.
+//
+// Usage:
+//   EncoderSession session;
+//   session.SetAttributeQuantization(GeometryAttribute::POSITION, 11);
+//   session.Reserve(max_num_points);
+//   for (each frame) {
+//     DRACO_RETURN_IF_ERROR(
+//         session.EncodePositions(positions, num_points, byte_stride));
+//     Write(session.buffer().data(), session.buffer().size());
+//   }
+//
+// The class is not thread safe. Use one session per encoding thread.
+class EncoderSession {
+ public:
+  EncoderSession();
+  EncoderSession(const EncoderSession &) = delete;
+  EncoderSession &operator=(const EncoderSession &) = delete;
+
+  // Option setters with the same meaning as the methods of the Encoder class.
+  // Setting an option to its current value is free, so the options can be
+  // updated before each frame.
+  void SetSpeedOptions(int encoding_speed, int decoding_speed);
+  void SetAttributeQuantization(GeometryAttribute::Type type,
+                                int quantization_bits);
+  void SetEncodingMethod(int encoding_method);
+
+  // Grows the internal storage so that frames with up to |max_num_points|
+  // points and encoded frames of up to |max_encoded_size| bytes can be
+  // processed without any further allocation. If |max_encoded_size| is 0,
+  // the size of the raw position data is used as an upper estimate.
+  void Reserve(PointIndex::ValueType max_num_points,
+               int64_t max_encoded_size = 0);
+
+  // Encodes a frame of float positions. Consecutive points in |positions| are
+  // |byte_stride| bytes apart (0 means tightly packed float triplets). The
+  // encoded frame is available in buffer() until the next call.
+  Status EncodePositions(const float *positions,
+                         PointIndex::ValueType num_points,
+                         int64_t byte_stride);
+
+  // Same as above, but the frame is encoded into |out_buffer| instead of
+  // buffer(). Encoding directly into the storage of the consumer of the data,
+  // e.g. a frame queue, saves copying the finished frame out of buffer().
+  Status EncodePositions(const float *positions,
+                         PointIndex::ValueType num_points,
+                         int64_t byte_stride, EncoderBuffer *out_buffer);
+
+  // Encodes an arbitrary point cloud using the options of the session. Only
+  // the output buffer is reused in this case.
+  Status EncodePointCloud(const PointCloud &pc);
+
+  // Encoded data of the last frame.
+  const EncoderBuffer &buffer() const { return buffer_; }
+
+  // Number of frames encoded by the session.
+  int64_t num_encoded_frames() const { return num_encoded_frames_; }
+
+ private:
+  // Adds the position attribute to |point_cloud_| on first use.
+  void InitPointCloud(PointIndex::ValueType num_points);
+
+  Encoder encoder_;
+  PointCloud point_cloud_;
+  PointAttribute *position_attribute_;
+  // Encoder of |point_cloud_| configured from the options of |encoder_|. The
+  // instance is re-created only when the options change.
+  std::unique_ptr<ExpertEncoder> expert_encoder_;
+  bool options_changed_;
+  EncoderBuffer buffer_;
+  int64_t num_encoded_frames_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ENCODER_SESSION_H_
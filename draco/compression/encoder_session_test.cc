@@ -0,0 +1,194 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/encoder_session.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "compression/decode.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class EncoderSessionTest : public ::testing::Test {
+ protected:
+  EncoderSessionTest() : rng_(5) {}
+
+  std::vector<float> CreatePositions(size_t num_points) {
+    std::uniform_real_distribution<float> dist(-2.f, 2.f);
+    std::vector<float> positions(3 * num_points);
+    for (float &value : positions) {
+      value = dist(rng_);
+    }
+    return positions;
+  }
+
+  // Encodes |positions| with a new Encoder, as if there was no session.
+  static std::string EncodeWithEncoder(const std::vector<float> &positions,
+                                       int quantization_bits,
+                                       int encoding_speed, int decoding_speed,
+                                       int encoding_method) {
+    const PointIndex::ValueType num_points =
+        static_cast<PointIndex::ValueType>(positions.size() / 3);
+    PointCloud pc;
+    pc.set_num_points(num_points);
+    GeometryAttribute va;
+    va.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+            sizeof(float) * 3, 0);
+    const int att_id = pc.AddAttribute(va, true, num_points);
+    EXPECT_TRUE(pc.attribute(att_id)->SetValuesFromInterleavedData(
+        positions.data(), 0, num_points));
+    Encoder encoder;
+    encoder.SetAttributeQuantization(GeometryAttribute::POSITION,
+                                     quantization_bits);
+    encoder.SetSpeedOptions(encoding_speed, decoding_speed);
+    encoder.SetEncodingMethod(encoding_method);
+    EncoderBuffer buffer;
+    EXPECT_TRUE(encoder.EncodePointCloudToBuffer(pc, &buffer).ok());
+    return std::string(buffer.data(), buffer.size());
+  }
+
+  static std::string GetData(const EncoderBuffer &buffer) {
+    return std::string(buffer.data(), buffer.size());
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(EncoderSessionTest, TestOptionChanges) {
+  // Every frame must be encoded exactly like a new Encoder with the same
+  // options would do it, also right after the options were changed.
+  const struct {
+    int quantization_bits;
+    int encoding_speed;
+    int decoding_speed;
+    int encoding_method;
+  } frames[] = {
+      {11, 5, 5, POINT_CLOUD_KD_TREE_ENCODING},
+      {11, 5, 5, POINT_CLOUD_KD_TREE_ENCODING},
+      {14, 5, 5, POINT_CLOUD_KD_TREE_ENCODING},
+      {14, 10, 10, POINT_CLOUD_KD_TREE_ENCODING},
+      {14, 10, 10, POINT_CLOUD_SEQUENTIAL_ENCODING},
+      {8, 0, 3, POINT_CLOUD_SEQUENTIAL_ENCODING},
+      {11, 5, 5, POINT_CLOUD_KD_TREE_ENCODING},
+  };
+  EncoderSession session;
+  int64_t num_frames = 0;
+  for (const auto &frame : frames) {
+    session.SetAttributeQuantization(GeometryAttribute::POSITION,
+                                     frame.quantization_bits);
+    session.SetSpeedOptions(frame.encoding_speed, frame.decoding_speed);
+    session.SetEncodingMethod(frame.encoding_method);
+    const std::vector<float> positions = CreatePositions(500);
+    ASSERT_TRUE(session.EncodePositions(positions.data(), 500, 0).ok());
+    EXPECT_EQ(session.num_encoded_frames(), ++num_frames);
+    EXPECT_EQ(GetData(session.buffer()),
+              EncodeWithEncoder(positions, frame.quantization_bits,
+                                frame.encoding_speed, frame.decoding_speed,
+                                frame.encoding_method))
+        << num_frames;
+  }
+}
+
+TEST_F(EncoderSessionTest, TestFrameSizes) {
+  // Frames of growing and shrinking sizes, some after a Reserve().
+  EncoderSession session;
+  session.SetAttributeQuantization(GeometryAttribute::POSITION, 12);
+  session.SetSpeedOptions(5, 5);
+  session.SetEncodingMethod(POINT_CLOUD_KD_TREE_ENCODING);
+  for (const PointIndex::ValueType num_points : {100, 1000, 10, 1, 300}) {
+    if (num_points == 10) {
+      session.Reserve(5000);
+    }
+    const std::vector<float> positions = CreatePositions(num_points);
+    ASSERT_TRUE(session.EncodePositions(positions.data(), num_points, 0).ok());
+    EXPECT_EQ(GetData(session.buffer()),
+              EncodeWithEncoder(positions, 12, 5, 5,
+                                POINT_CLOUD_KD_TREE_ENCODING))
+        << num_points;
+
+    DecoderBuffer in_buffer;
+    in_buffer.Init(session.buffer().data(), session.buffer().size());
+    Decoder decoder;
+    StatusOr<std::unique_ptr<PointCloud>> pc =
+        decoder.DecodePointCloudFromBuffer(&in_buffer);
+    ASSERT_TRUE(pc.ok());
+    EXPECT_EQ(pc.value()->num_points(), num_points);
+  }
+}
+
+TEST_F(EncoderSessionTest, TestByteStride) {
+  // Points padded to 16 bytes, like simd_float3, are encoded like tightly
+  // packed points.
+  const std::vector<float> positions = CreatePositions(200);
+  std::vector<float> padded;
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    padded.insert(padded.end(), positions.begin() + i,
+                  positions.begin() + i + 3);
+    padded.push_back(100.f);
+  }
+  EncoderSession session;
+  session.SetAttributeQuantization(GeometryAttribute::POSITION, 11);
+  ASSERT_TRUE(session.EncodePositions(positions.data(), 200, 0).ok());
+  const std::string packed_data = GetData(session.buffer());
+  ASSERT_TRUE(
+      session.EncodePositions(padded.data(), 200, 4 * sizeof(float)).ok());
+  EXPECT_EQ(GetData(session.buffer()), packed_data);
+}
+
+TEST_F(EncoderSessionTest, TestOutBuffer) {
+  EncoderSession session;
+  session.SetAttributeQuantization(GeometryAttribute::POSITION, 11);
+  session.SetSpeedOptions(5, 5);
+  session.SetEncodingMethod(POINT_CLOUD_KD_TREE_ENCODING);
+  const std::vector<float> positions = CreatePositions(300);
+  ASSERT_TRUE(session.EncodePositions(positions.data(), 300, 0).ok());
+  const std::string data = GetData(session.buffer());
+
+  // Encoding into a caller buffer replaces its content and leaves buffer()
+  // unchanged.
+  const std::vector<float> other_positions = CreatePositions(400);
+  EncoderBuffer out_buffer;
+  out_buffer.Encode(static_cast<uint32_t>(0xdeadbeef));
+  ASSERT_TRUE(
+      session.EncodePositions(other_positions.data(), 400, 0, &out_buffer)
+          .ok());
+  EXPECT_EQ(GetData(out_buffer),
+            EncodeWithEncoder(other_positions, 11, 5, 5,
+                              POINT_CLOUD_KD_TREE_ENCODING));
+  EXPECT_EQ(GetData(session.buffer()), data);
+  EXPECT_EQ(session.num_encoded_frames(), 2);
+}
+
+TEST_F(EncoderSessionTest, TestInvalidInput) {
+  EncoderSession session;
+  session.SetAttributeQuantization(GeometryAttribute::POSITION, 11);
+  const std::vector<float> positions = CreatePositions(10);
+  EXPECT_EQ(session.EncodePositions(nullptr, 10, 0).code(),
+            Status::INVALID_PARAMETER);
+  EXPECT_EQ(session.EncodePositions(positions.data(), 0, 0).code(),
+            Status::INVALID_PARAMETER);
+  // The points would overlap.
+  EXPECT_EQ(session.EncodePositions(positions.data(), 3, 8).code(),
+            Status::INVALID_PARAMETER);
+  EXPECT_EQ(session.num_encoded_frames(), 0);
+
+  // The session is still usable.
+  ASSERT_TRUE(session.EncodePositions(positions.data(), 10, 0).ok());
+  EXPECT_EQ(session.num_encoded_frames(), 1);
+}
+
+}  // namespace draco
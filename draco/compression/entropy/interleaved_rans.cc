@@ -0,0 +1,822 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/entropy/interleaved_rans.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#define DRACO_INTERLEAVED_RANS_SSE41
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#include <arm_neon.h>
+#define DRACO_INTERLEAVED_RANS_NEON
+#endif
+
+#include "compression/entropy/rans_symbol_coding.h"
+#include "core/bit_utils.h"
+#include "core/varint_decoding.h"
+#include "core/varint_encoding.h"
+
+namespace draco {
+
+namespace {
+
+// Lower bound of the states. A state is renormalized when it drops below.
+constexpr uint32_t kStateLowerBound = 1u << 16;
+
+// Symbols of EncodeInterleavedSymbols() are limited to this alphabet, larger
+// values are coded as the last symbol followed by a varint.
+constexpr uint32_t kMaxAlphabetSize = 4096;
+constexpr uint32_t kEscapeSymbol = kMaxAlphabetSize - 1;
+
+uint16_t ReadWord(const uint8_t *words, size_t index) {
+  return static_cast<uint16_t>(words[2 * index] |
+                               (words[2 * index + 1] << 8));
+}
+
+#if defined(DRACO_INTERLEAVED_RANS_SSE41) || \
+    defined(DRACO_INTERLEAVED_RANS_NEON)
+
+// For each mask of the states that need a renormalization word, the byte
+// shuffle that moves the next words to those states. The words are consumed
+// in state order, like in the scalar decoder.
+struct RenormalizationShuffles {
+  RenormalizationShuffles() {
+    for (int mask = 0; mask < 16; ++mask) {
+      int word = 0;
+      for (int lane = 0; lane < 4; ++lane) {
+        uint8_t *const lane_bytes = bytes[mask] + 4 * lane;
+        if (mask & (1 << lane)) {
+          lane_bytes[0] = static_cast<uint8_t>(2 * word);
+          lane_bytes[1] = static_cast<uint8_t>(2 * word + 1);
+          ++word;
+        } else {
+          lane_bytes[0] = 0x80;
+          lane_bytes[1] = 0x80;
+        }
+        // Out of range indices produce zero bytes.
+        lane_bytes[2] = 0x80;
+        lane_bytes[3] = 0x80;
+      }
+      num_words[mask] = word;
+    }
+  }
+
+  uint8_t bytes[16][16];
+  int num_words[16];
+};
+
+const RenormalizationShuffles &GetRenormalizationShuffles() {
+  static const RenormalizationShuffles shuffles;
+  return shuffles;
+}
+
+#endif
+
+// Decoding table with a single entry per slot holding
+// symbol << 24 | (slot - cumulative frequency) << 12 | (frequency - 1) of the
+// symbol covering the slot. Used for up to 256 symbols and 12 precision bits,
+// the table then takes 16KB and a single load gives all values of a symbol.
+struct PackedSlotTable {
+  const uint32_t *slots;
+
+  // Returns the symbol of |slot| and its |frequency| and the |offset| of the
+  // slot from its cumulative frequency.
+  uint32_t Lookup(uint32_t slot, uint32_t *frequency, uint32_t *offset) const {
+    const uint32_t entry = slots[slot];
+    *frequency = (entry & 0xfff) + 1;
+    *offset = (entry >> 12) & 0xfff;
+    return entry >> 24;
+  }
+
+#if defined(DRACO_INTERLEAVED_RANS_SSE41)
+  void LookupGroup(__m128i slot, uint32_t *out_values, __m128i *frequency,
+                   __m128i *offset) const {
+    alignas(16) uint32_t slot_indices[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(slot_indices), slot);
+    const __m128i entry =
+        _mm_setr_epi32(slots[slot_indices[0]], slots[slot_indices[1]],
+                       slots[slot_indices[2]], slots[slot_indices[3]]);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out_values),
+                     _mm_srli_epi32(entry, 24));
+    const __m128i mask = _mm_set1_epi32(0xfff);
+    *frequency =
+        _mm_add_epi32(_mm_and_si128(entry, mask), _mm_set1_epi32(1));
+    *offset = _mm_and_si128(_mm_srli_epi32(entry, 12), mask);
+  }
+#elif defined(DRACO_INTERLEAVED_RANS_NEON)
+  void LookupGroup(uint32x4_t slot, uint32_t *out_values,
+                   uint32x4_t *frequency, uint32x4_t *offset) const {
+    uint32_t slot_indices[4];
+    vst1q_u32(slot_indices, slot);
+    const uint32_t entries[4] = {slots[slot_indices[0]],
+                                 slots[slot_indices[1]],
+                                 slots[slot_indices[2]],
+                                 slots[slot_indices[3]]};
+    const uint32x4_t entry = vld1q_u32(entries);
+    vst1q_u32(out_values, vshrq_n_u32(entry, 24));
+    const uint32x4_t mask = vdupq_n_u32(0xfff);
+    *frequency = vaddq_u32(vandq_u32(entry, mask), vdupq_n_u32(1));
+    *offset = vandq_u32(vshrq_n_u32(entry, 12), mask);
+  }
+#endif
+};
+
+// Decoding table with (slot - cumulative frequency) << 16 | (frequency - 1)
+// and the symbol of each slot in two arrays. Takes 6 bytes per slot, but both
+// loads only depend on the slot.
+struct SlotEntryTable {
+  const uint32_t *slot_entries;
+  const uint16_t *slot_symbols;
+
+  uint32_t Lookup(uint32_t slot, uint32_t *frequency, uint32_t *offset) const {
+    const uint32_t entry = slot_entries[slot];
+    *frequency = (entry & 0xffff) + 1;
+    *offset = entry >> 16;
+    return slot_symbols[slot];
+  }
+
+#if defined(DRACO_INTERLEAVED_RANS_SSE41)
+  void LookupGroup(__m128i slot, uint32_t *out_values, __m128i *frequency,
+                   __m128i *offset) const {
+    alignas(16) uint32_t slot_indices[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(slot_indices), slot);
+    const __m128i entry = _mm_setr_epi32(
+        slot_entries[slot_indices[0]], slot_entries[slot_indices[1]],
+        slot_entries[slot_indices[2]], slot_entries[slot_indices[3]]);
+    for (int i = 0; i < 4; ++i) {
+      out_values[i] = slot_symbols[slot_indices[i]];
+    }
+    *frequency = _mm_add_epi32(_mm_and_si128(entry, _mm_set1_epi32(0xffff)),
+                               _mm_set1_epi32(1));
+    *offset = _mm_srli_epi32(entry, 16);
+  }
+#elif defined(DRACO_INTERLEAVED_RANS_NEON)
+  void LookupGroup(uint32x4_t slot, uint32_t *out_values,
+                   uint32x4_t *frequency, uint32x4_t *offset) const {
+    uint32_t slot_indices[4];
+    vst1q_u32(slot_indices, slot);
+    const uint32_t entries[4] = {
+        slot_entries[slot_indices[0]], slot_entries[slot_indices[1]],
+        slot_entries[slot_indices[2]], slot_entries[slot_indices[3]]};
+    for (int i = 0; i < 4; ++i) {
+      out_values[i] = slot_symbols[slot_indices[i]];
+    }
+    const uint32x4_t entry = vld1q_u32(entries);
+    *frequency =
+        vaddq_u32(vandq_u32(entry, vdupq_n_u32(0xffff)), vdupq_n_u32(1));
+    *offset = vshrq_n_u32(entry, 16);
+  }
+#endif
+};
+
+// Decodes one symbol with |state| and renormalizes the state. Returns false
+// if the renormalization runs out of words.
+template <class TableT>
+inline bool DecodeScalar(const TableT &table, int precision_bits,
+                         const uint8_t *words, size_t num_words,
+                         size_t *word_index, uint32_t *state,
+                         uint32_t *out_value) {
+  uint32_t x = *state;
+  uint32_t frequency;
+  uint32_t offset;
+  *out_value =
+      table.Lookup(x & ((1u << precision_bits) - 1), &frequency, &offset);
+  x = frequency * (x >> precision_bits) + offset;
+  if (x < kStateLowerBound) {
+    if (*word_index >= num_words) {
+      return false;
+    }
+    x = (x << 16) | ReadWord(words, (*word_index)++);
+  }
+  *state = x;
+  return true;
+}
+
+#if defined(DRACO_INTERLEAVED_RANS_SSE41)
+
+// Decodes a symbol with each of the 4 |states|. At least 4 words must be
+// readable at |words|. Returns the number of consumed words.
+template <class TableT>
+inline int DecodeGroup(const TableT &table, int precision_bits,
+                       const RenormalizationShuffles &shuffles,
+                       const uint8_t *words, uint32_t *states,
+                       uint32_t *out_values) {
+  __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(states));
+  __m128i frequency;
+  __m128i offset;
+  table.LookupGroup(
+      _mm_and_si128(x, _mm_set1_epi32((1 << precision_bits) - 1)),
+      out_values, &frequency, &offset);
+  x = _mm_add_epi32(
+      _mm_mullo_epi32(frequency,
+                      _mm_srl_epi32(x, _mm_cvtsi32_si128(precision_bits))),
+      offset);
+  const __m128i renormalize =
+      _mm_cmpeq_epi32(_mm_srli_epi32(x, 16), _mm_setzero_si128());
+  const int mask = _mm_movemask_ps(_mm_castsi128_ps(renormalize));
+  const __m128i next_words = _mm_shuffle_epi8(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i *>(words)),
+      _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(shuffles.bytes[mask])));
+  x = _mm_blendv_epi8(x, _mm_or_si128(_mm_slli_epi32(x, 16), next_words),
+                      renormalize);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(states), x);
+  return shuffles.num_words[mask];
+}
+
+#elif defined(DRACO_INTERLEAVED_RANS_NEON)
+
+// Decodes a symbol with each of the 4 |states|. At least 4 words must be
+// readable at |words|. Returns the number of consumed words.
+template <class TableT>
+inline int DecodeGroup(const TableT &table, int precision_bits,
+                       const RenormalizationShuffles &shuffles,
+                       const uint8_t *words, uint32_t *states,
+                       uint32_t *out_values) {
+  uint32x4_t x = vld1q_u32(states);
+  uint32x4_t frequency;
+  uint32x4_t offset;
+  table.LookupGroup(vandq_u32(x, vdupq_n_u32((1u << precision_bits) - 1)),
+                    out_values, &frequency, &offset);
+  x = vmlaq_u32(offset, frequency,
+                vshlq_u32(x, vdupq_n_s32(-precision_bits)));
+  const uint32x4_t renormalize = vceqq_u32(vshrq_n_u32(x, 16), vdupq_n_u32(0));
+  const uint32x4_t lane_bits = {1, 2, 4, 8};
+  const int mask =
+      static_cast<int>(vaddvq_u32(vandq_u32(renormalize, lane_bits)));
+  const uint8x16_t next_words =
+      vqtbl1q_u8(vcombine_u8(vld1_u8(words), vdup_n_u8(0)),
+                 vld1q_u8(shuffles.bytes[mask]));
+  x = vbslq_u32(renormalize,
+                vorrq_u32(vshlq_n_u32(x, 16), vreinterpretq_u32_u8(next_words)),
+                x);
+  vst1q_u32(states, x);
+  return shuffles.num_words[mask];
+}
+
+#endif
+
+// Decodes |num_values| symbols with |num_states| interleaved |states| from
+// |num_words| renormalization words.
+template <class TableT>
+bool DecodeStates(const TableT &table, int precision_bits, size_t num_states,
+                  const uint8_t *words, size_t num_words, size_t num_values,
+                  uint32_t *states, uint32_t *out_values) {
+  size_t word_index = 0;
+  size_t i = 0;
+#if defined(DRACO_INTERLEAVED_RANS_SSE41) || \
+    defined(DRACO_INTERLEAVED_RANS_NEON)
+  // Each group of 4 states reads up to 4 words, the remaining symbols are
+  // decoded by the scalar loop below.
+  const RenormalizationShuffles &shuffles = GetRenormalizationShuffles();
+  while (i + num_states <= num_values &&
+         word_index + num_states <= num_words) {
+    for (size_t lane = 0; lane < num_states; lane += 4) {
+      word_index += DecodeGroup(table, precision_bits, shuffles,
+                                words + 2 * word_index, states + lane,
+                                out_values + i + lane);
+    }
+    i += num_states;
+  }
+#endif
+  for (; i < num_values; ++i) {
+    if (!DecodeScalar(table, precision_bits, words, num_words, &word_index,
+                      &states[i & (num_states - 1)], &out_values[i])) {
+      return false;
+    }
+  }
+  // The encoder started with all states at the lower bound and used all
+  // words.
+  if (word_index != num_words) {
+    return false;
+  }
+  for (size_t lane = 0; lane < num_states; ++lane) {
+    if (states[lane] != kStateLowerBound) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Scales |frequencies| to probabilities that sum up to 1 << |precision_bits|.
+// Symbols with a nonzero frequency keep a nonzero probability.
+bool ComputeProbabilities(const uint64_t *frequencies, int num_symbols,
+                          int precision_bits,
+                          std::vector<uint32_t> *probabilities) {
+  const uint32_t total_probability = 1u << precision_bits;
+  uint64_t total_frequency = 0;
+  uint32_t num_used_symbols = 0;
+  for (int i = 0; i < num_symbols; ++i) {
+    total_frequency += frequencies[i];
+    num_used_symbols += frequencies[i] > 0;
+  }
+  if (num_used_symbols == 0 || num_used_symbols > total_probability) {
+    return false;
+  }
+  probabilities->assign(num_symbols, 0);
+  uint64_t sum = 0;
+  int most_frequent = 0;
+  for (int i = 0; i < num_symbols; ++i) {
+    if (frequencies[i] == 0) {
+      continue;
+    }
+    const double scaled = static_cast<double>(frequencies[i]) /
+                          static_cast<double>(total_frequency) *
+                          total_probability;
+    (*probabilities)[i] =
+        std::max<uint32_t>(static_cast<uint32_t>(scaled + 0.5), 1);
+    sum += (*probabilities)[i];
+    if (frequencies[i] > frequencies[most_frequent]) {
+      most_frequent = i;
+    }
+  }
+  if (sum < total_probability) {
+    (*probabilities)[most_frequent] += total_probability - sum;
+    return true;
+  }
+  // Rounding and the minimum probability of rare symbols over-allocated the
+  // precision. Take it back from the most probable symbols, which changes
+  // their relative probability the least.
+  std::vector<int> order;
+  for (int i = 0; i < num_symbols; ++i) {
+    if ((*probabilities)[i] > 1) {
+      order.push_back(i);
+    }
+  }
+  std::sort(order.begin(), order.end(), [probabilities](int a, int b) {
+    return (*probabilities)[a] > (*probabilities)[b];
+  });
+  while (sum > total_probability) {
+    for (const int i : order) {
+      if (sum == total_probability) {
+        break;
+      }
+      uint32_t &probability = (*probabilities)[i];
+      // Reduce by up to 1/8th of the probability per pass.
+      const uint64_t fix = std::min<uint64_t>(
+          sum - total_probability, std::max<uint32_t>(probability / 8, 1));
+      if (probability > fix) {
+        probability -= static_cast<uint32_t>(fix);
+        sum -= fix;
+      }
+    }
+  }
+  return true;
+}
+
+// Returns the precision of a table with |num_symbols| symbols.
+int ComputePrecisionBits(uint32_t num_symbols) {
+  return std::max(kInterleavedRAnsMinPrecisionBits,
+                  std::min(kInterleavedRAnsMaxPrecisionBits,
+                           ComputeRAnsPrecisionFromUniqueSymbolsBitLength(
+                               MostSignificantBit(num_symbols) + 1)));
+}
+
+}  // namespace
+
+InterleavedRAnsTable::InterleavedRAnsTable()
+    : num_states_(0), precision_bits_(0), checksum_(0) {}
+
+bool InterleavedRAnsTable::Create(const uint64_t *frequencies,
+                                  int num_symbols, int num_states,
+                                  int precision_bits) {
+  if ((num_states != 4 && num_states != 8) ||
+      precision_bits < kInterleavedRAnsMinPrecisionBits ||
+      precision_bits > kInterleavedRAnsMaxPrecisionBits) {
+    return false;
+  }
+  if (!ComputeProbabilities(frequencies, num_symbols, precision_bits,
+                            &probabilities_)) {
+    probabilities_.clear();
+    return false;
+  }
+  num_states_ = num_states;
+  precision_bits_ = precision_bits;
+  UpdateChecksum();
+  return true;
+}
+
+void InterleavedRAnsTable::Encode(EncoderBuffer *buffer) const {
+  const int num_symbols = static_cast<int>(probabilities_.size());
+  buffer->Encode(static_cast<uint8_t>(num_states_));
+  buffer->Encode(static_cast<uint8_t>(precision_bits_));
+  EncodeVarint(static_cast<uint32_t>(num_symbols), buffer);
+  for (int i = 0; i < num_symbols; ++i) {
+    EncodeVarint(probabilities_[i], buffer);
+    if (probabilities_[i] == 0) {
+      int run = 0;
+      while (i + 1 < num_symbols && probabilities_[i + 1] == 0) {
+        ++run;
+        ++i;
+      }
+      EncodeVarint(static_cast<uint32_t>(run), buffer);
+    }
+  }
+}
+
+bool InterleavedRAnsTable::Decode(DecoderBuffer *buffer) {
+  probabilities_.clear();
+  uint8_t num_states;
+  uint8_t precision_bits;
+  uint32_t num_symbols;
+  if (!buffer->Decode(&num_states) || !buffer->Decode(&precision_bits) ||
+      !DecodeVarint(&num_symbols, buffer)) {
+    return false;
+  }
+  if ((num_states != 4 && num_states != 8) ||
+      precision_bits < kInterleavedRAnsMinPrecisionBits ||
+      precision_bits > kInterleavedRAnsMaxPrecisionBits ||
+      num_symbols == 0 || num_symbols > (1u << precision_bits)) {
+    return false;
+  }
+  const uint32_t total_probability = 1u << precision_bits;
+  probabilities_.resize(num_symbols, 0);
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < num_symbols; ++i) {
+    uint32_t probability;
+    if (!DecodeVarint(&probability, buffer)) {
+      probabilities_.clear();
+      return false;
+    }
+    if (probability == 0) {
+      uint32_t run;
+      if (!DecodeVarint(&run, buffer) || run >= num_symbols - i) {
+        probabilities_.clear();
+        return false;
+      }
+      i += run;
+      continue;
+    }
+    if (probability > total_probability - sum) {
+      probabilities_.clear();
+      return false;
+    }
+    probabilities_[i] = probability;
+    sum += probability;
+  }
+  if (sum != total_probability) {
+    probabilities_.clear();
+    return false;
+  }
+  num_states_ = num_states;
+  precision_bits_ = precision_bits;
+  UpdateChecksum();
+  return true;
+}
+
+void InterleavedRAnsTable::UpdateChecksum() {
+  // FNV-1a of the parameters and the probabilities.
+  uint32_t hash = 2166136261u;
+  const auto add = [&hash](uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+      hash = (hash ^ ((value >> (8 * i)) & 0xff)) * 16777619u;
+    }
+  };
+  add(static_cast<uint32_t>(num_states_));
+  add(static_cast<uint32_t>(precision_bits_));
+  add(static_cast<uint32_t>(probabilities_.size()));
+  for (const uint32_t probability : probabilities_) {
+    add(probability);
+  }
+  checksum_ = hash;
+}
+
+InterleavedRAnsEncoder::InterleavedRAnsEncoder()
+    : num_states_(0), precision_bits_(0) {}
+
+bool InterleavedRAnsEncoder::Create(const uint64_t *frequencies,
+                                    int num_symbols, int num_states,
+                                    int precision_bits,
+                                    EncoderBuffer *buffer) {
+  InterleavedRAnsTable table;
+  if (!table.Create(frequencies, num_symbols, num_states, precision_bits)) {
+    return false;
+  }
+  table.Encode(buffer);
+  return Create(table);
+}
+
+bool InterleavedRAnsEncoder::Create(const InterleavedRAnsTable &table) {
+  if (table.num_symbols() == 0) {
+    return false;
+  }
+  num_states_ = table.num_states();
+  precision_bits_ = table.precision_bits();
+  symbols_.resize(table.num_symbols());
+  uint32_t cumulative_frequency = 0;
+  for (uint32_t i = 0; i < table.num_symbols(); ++i) {
+    symbols_[i].frequency = table.probabilities()[i];
+    symbols_[i].cumulative_frequency = cumulative_frequency;
+    cumulative_frequency += table.probabilities()[i];
+  }
+  return true;
+}
+
+void InterleavedRAnsEncoder::EncodeSymbols(const uint32_t *symbols,
+                                           size_t num_values,
+                                           EncoderBuffer *buffer) {
+  uint32_t states[kInterleavedRAnsMaxNumStates];
+  std::fill(states, states + num_states_, kStateLowerBound);
+  words_.ResizeUninitialized(num_values * sizeof(uint16_t));
+  uint16_t *const words_end = reinterpret_cast<uint16_t *>(words_.data()) +
+                              num_values;
+  uint16_t *words = words_end;
+  const size_t lane_mask = num_states_ - 1;
+  const int renormalization_shift = 32 - precision_bits_;
+  // The symbols are encoded in reverse order so that the decoder reads them
+  // forward, together with the words in the order they were emitted.
+  for (size_t i = num_values; i-- > 0;) {
+    uint32_t &x = states[i & lane_mask];
+    const Symbol &symbol = symbols_[symbols[i]];
+    if (x >= static_cast<uint64_t>(symbol.frequency) << renormalization_shift) {
+      *--words = static_cast<uint16_t>(x);
+      x >>= 16;
+    }
+    x = ((x / symbol.frequency) << precision_bits_) + x % symbol.frequency +
+        symbol.cumulative_frequency;
+  }
+  const size_t num_words = words_end - words;
+  EncodeVarint(static_cast<uint64_t>(num_words), buffer);
+  for (int i = 0; i < num_states_; ++i) {
+    buffer->Encode(states[i]);
+  }
+  if (num_words > 0) {
+    buffer->Encode(words, num_words * sizeof(uint16_t));
+  }
+}
+
+InterleavedRAnsDecoder::InterleavedRAnsDecoder()
+    : num_states_(0),
+      precision_bits_(0),
+      num_symbols_(0),
+      table_layout_(INTERLEAVED_RANS_TABLE_AUTO) {}
+
+bool InterleavedRAnsDecoder::Create(DecoderBuffer *buffer) {
+  InterleavedRAnsTable table;
+  return table.Decode(buffer) && Create(table);
+}
+
+bool InterleavedRAnsDecoder::Create(const InterleavedRAnsTable &table) {
+  return Create(table, INTERLEAVED_RANS_TABLE_AUTO);
+}
+
+bool InterleavedRAnsDecoder::Create(const InterleavedRAnsTable &table,
+                                    InterleavedRAnsTableLayout layout) {
+  if (table.num_symbols() == 0) {
+    return false;
+  }
+  const bool fits_packed = table.num_symbols() <= 256 &&
+                           table.precision_bits() <= 12;
+  if (layout == INTERLEAVED_RANS_TABLE_AUTO) {
+    // Measured with interleaved_rans_benchmark.cc: the packed entries are
+    // the fastest where they fit.
+    layout = fits_packed ? INTERLEAVED_RANS_TABLE_PACKED
+                         : INTERLEAVED_RANS_TABLE_SLOT_ENTRIES;
+  } else if (layout == INTERLEAVED_RANS_TABLE_PACKED && !fits_packed) {
+    return false;
+  }
+  num_states_ = table.num_states();
+  precision_bits_ = table.precision_bits();
+  num_symbols_ = table.num_symbols();
+  table_layout_ = layout;
+  const uint32_t total_probability = 1u << precision_bits_;
+  const bool packed = layout == INTERLEAVED_RANS_TABLE_PACKED;
+  packed_slots_.ResizeUninitialized(packed ? 4 * total_probability : 0);
+  slot_entries_.ResizeUninitialized(packed ? 0 : 4 * total_probability);
+  slot_symbols_.ResizeUninitialized(packed ? 0 : 2 * total_probability);
+  uint32_t *const packed_slots =
+      reinterpret_cast<uint32_t *>(packed_slots_.data());
+  uint32_t *const slot_entries =
+      reinterpret_cast<uint32_t *>(slot_entries_.data());
+  uint16_t *const slot_symbols =
+      reinterpret_cast<uint16_t *>(slot_symbols_.data());
+  uint32_t cumulative_frequency = 0;
+  for (uint32_t i = 0; i < num_symbols_; ++i) {
+    const uint32_t probability = table.probabilities()[i];
+    if (probability == 0) {
+      continue;
+    }
+    if (packed) {
+      for (uint32_t slot = 0; slot < probability; ++slot) {
+        packed_slots[cumulative_frequency + slot] =
+            (i << 24) | (slot << 12) | (probability - 1);
+      }
+    } else {
+      for (uint32_t slot = 0; slot < probability; ++slot) {
+        slot_entries[cumulative_frequency + slot] =
+            (slot << 16) | (probability - 1);
+      }
+      std::fill_n(slot_symbols + cumulative_frequency, probability,
+                  static_cast<uint16_t>(i));
+    }
+    cumulative_frequency += probability;
+  }
+  return true;
+}
+
+bool InterleavedRAnsDecoder::DecodeSymbols(size_t num_values,
+                                           DecoderBuffer *buffer,
+                                           uint32_t *out_values) {
+  if (num_states_ == 0) {
+    return false;
+  }
+  uint64_t num_words;
+  if (!DecodeVarint(&num_words, buffer)) {
+    return false;
+  }
+  const int64_t states_size = num_states_ * sizeof(uint32_t);
+  if (num_words > static_cast<uint64_t>(buffer->remaining_size()) / 2 ||
+      2 * static_cast<int64_t>(num_words) + states_size >
+          buffer->remaining_size()) {
+    return false;
+  }
+  uint32_t states[kInterleavedRAnsMaxNumStates];
+  for (int i = 0; i < num_states_; ++i) {
+    buffer->Decode(&states[i]);
+    if (states[i] < kStateLowerBound) {
+      return false;
+    }
+  }
+  const uint8_t *const words =
+      reinterpret_cast<const uint8_t *>(buffer->data_head());
+  buffer->Advance(2 * num_words);
+
+  if (table_layout_ == INTERLEAVED_RANS_TABLE_PACKED) {
+    return DecodeStates(
+        PackedSlotTable{
+            reinterpret_cast<const uint32_t *>(packed_slots_.data())},
+        precision_bits_, num_states_, words, num_words, num_values, states,
+        out_values);
+  }
+  return DecodeStates(
+      SlotEntryTable{
+          reinterpret_cast<const uint32_t *>(slot_entries_.data()),
+          reinterpret_cast<const uint16_t *>(slot_symbols_.data())},
+      precision_bits_, num_states_, words, num_words, num_values, states,
+      out_values);
+}
+
+bool EncodeInterleavedSymbols(const uint32_t *symbols, size_t num_values,
+                              int num_states, EncoderBuffer *target_buffer) {
+  if (num_values == 0) {
+    return true;
+  }
+  uint32_t max_value = 0;
+  for (size_t i = 0; i < num_values; ++i) {
+    max_value = std::max(max_value, symbols[i]);
+  }
+  const uint32_t num_symbols = std::min(max_value, kEscapeSymbol) + 1;
+  AlignedBuffer coded_symbols_buffer;
+  const uint32_t *input_symbols = symbols;
+  if (num_symbols == kMaxAlphabetSize) {
+    coded_symbols_buffer.ResizeUninitialized(num_values * sizeof(uint32_t));
+    uint32_t *const coded_symbols =
+        reinterpret_cast<uint32_t *>(coded_symbols_buffer.data());
+    for (size_t i = 0; i < num_values; ++i) {
+      coded_symbols[i] = std::min(symbols[i], kEscapeSymbol);
+    }
+    input_symbols = coded_symbols;
+  }
+  std::vector<uint64_t> frequencies(num_symbols, 0);
+  for (size_t i = 0; i < num_values; ++i) {
+    ++frequencies[input_symbols[i]];
+  }
+  InterleavedRAnsEncoder encoder;
+  if (!encoder.Create(frequencies.data(), num_symbols, num_states,
+                      ComputePrecisionBits(num_symbols), target_buffer)) {
+    return false;
+  }
+  encoder.EncodeSymbols(input_symbols, num_values, target_buffer);
+  if (num_symbols == kMaxAlphabetSize) {
+    for (size_t i = 0; i < num_values; ++i) {
+      if (symbols[i] >= kEscapeSymbol) {
+        EncodeVarint(symbols[i] - kEscapeSymbol, target_buffer);
+      }
+    }
+  }
+  return true;
+}
+
+bool DecodeInterleavedSymbols(size_t num_values, DecoderBuffer *src_buffer,
+                              uint32_t *out_values) {
+  if (num_values == 0) {
+    return true;
+  }
+  InterleavedRAnsDecoder decoder;
+  if (!decoder.Create(src_buffer) ||
+      !decoder.DecodeSymbols(num_values, src_buffer, out_values)) {
+    return false;
+  }
+  if (decoder.num_symbols() == kMaxAlphabetSize) {
+    for (size_t i = 0; i < num_values; ++i) {
+      if (out_values[i] == kEscapeSymbol) {
+        uint32_t offset;
+        if (!DecodeVarint(&offset, src_buffer) ||
+            offset > UINT32_MAX - kEscapeSymbol) {
+          return false;
+        }
+        out_values[i] += offset;
+      }
+    }
+  }
+  return true;
+}
+
+void InterleavedSymbolHistogram::AddSymbols(const uint32_t *symbols,
+                                            size_t num_values) {
+  for (size_t i = 0; i < num_values; ++i) {
+    const uint32_t symbol = std::min(symbols[i], kEscapeSymbol);
+    if (symbol >= frequencies_.size()) {
+      frequencies_.resize(symbol + 1, 0);
+    }
+    ++frequencies_[symbol];
+  }
+}
+
+bool InterleavedSymbolHistogram::CreateTable(
+    int num_states, InterleavedRAnsTable *out_table) const {
+  // The escape follows the seen symbols. It also takes the place of the large
+  // symbols, which were counted at kEscapeSymbol.
+  const uint32_t escape_symbol =
+      std::min(static_cast<uint32_t>(frequencies_.size()), kEscapeSymbol);
+  std::vector<uint64_t> frequencies(escape_symbol + 1, 0);
+  std::copy(frequencies_.begin(), frequencies_.begin() + escape_symbol,
+            frequencies.begin());
+  frequencies[escape_symbol] =
+      1 + (frequencies_.size() > kEscapeSymbol ? frequencies_[kEscapeSymbol]
+                                               : 0);
+  return out_table->Create(frequencies.data(),
+                           static_cast<int>(frequencies.size()), num_states,
+                           ComputePrecisionBits(escape_symbol + 1));
+}
+
+bool EncodeInterleavedSymbols(const uint32_t *symbols, size_t num_values,
+                              InterleavedRAnsEncoder *encoder,
+                              EncoderBuffer *target_buffer) {
+  if (encoder->num_symbols() == 0) {
+    return false;
+  }
+  const uint32_t escape_symbol = encoder->num_symbols() - 1;
+  if (!encoder->HasSymbol(escape_symbol)) {
+    return false;
+  }
+  if (num_values == 0) {
+    return true;
+  }
+  AlignedBuffer coded_symbols_buffer;
+  coded_symbols_buffer.ResizeUninitialized(num_values * sizeof(uint32_t));
+  uint32_t *const coded_symbols =
+      reinterpret_cast<uint32_t *>(coded_symbols_buffer.data());
+  for (size_t i = 0; i < num_values; ++i) {
+    coded_symbols[i] = symbols[i] < escape_symbol &&
+                               encoder->HasSymbol(symbols[i])
+                           ? symbols[i]
+                           : escape_symbol;
+  }
+  encoder->EncodeSymbols(coded_symbols, num_values, target_buffer);
+  for (size_t i = 0; i < num_values; ++i) {
+    if (coded_symbols[i] == escape_symbol) {
+      EncodeVarint(symbols[i], target_buffer);
+    }
+  }
+  return true;
+}
+
+bool DecodeInterleavedSymbols(size_t num_values,
+                              InterleavedRAnsDecoder *decoder,
+                              DecoderBuffer *src_buffer,
+                              uint32_t *out_values) {
+  if (decoder->num_symbols() == 0) {
+    return false;
+  }
+  if (num_values == 0) {
+    return true;
+  }
+  if (!decoder->DecodeSymbols(num_values, src_buffer, out_values)) {
+    return false;
+  }
+  const uint32_t escape_symbol = decoder->num_symbols() - 1;
+  for (size_t i = 0; i < num_values; ++i) {
+    if (out_values[i] == escape_symbol &&
+        !DecodeVarint(&out_values[i], src_buffer)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,241 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ENTROPY_INTERLEAVED_RANS_H_
+#define DRACO_COMPRESSION_ENTROPY_INTERLEAVED_RANS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/aligned_buffer.h"
+#include "core/decoder_buffer.h"
+#include "core/encoder_buffer.h"
+
+namespace draco {
+
+// rANS coder with several interleaved states (see ans.h for the single state
+// coder used by RAnsSymbolEncoder). Symbol i is coded by state i % N, so the
+// decoder updates N independent states instead of a single long dependency
+// chain, and N consecutive symbols can be decoded with SIMD instructions.
+//
+// States are 32 bits in range [2^16, 2^32) and are renormalized by 16-bit
+// words that all states share in the order they are read by the decoder.
+// This limits the probability precision to 16 bits but guarantees that a
+// state reads at most one word per symbol. The SSE4.1 and NEON decoders
+// decode 4 states at once and produce the same output as the scalar
+// decoder.
+//
+// Bitstream of the coded symbols:
+//
+//   varint  number of 16-bit words
+//   uint32  initial state of each decoder state
+//   uint16  renormalization words
+//
+// The probability table is written by InterleavedRAnsTable::Encode(), either
+// before the symbols or once for all frames of a sequence:
+//
+//   uint8   number of states
+//   uint8   precision bits
+//   varint  number of symbols
+//   varint  probability of each symbol, a zero probability is followed by
+//           the number of additional symbols with zero probability
+
+// Supported numbers of interleaved states.
+constexpr int kInterleavedRAnsMaxNumStates = 8;
+constexpr int kInterleavedRAnsMinPrecisionBits = 12;
+constexpr int kInterleavedRAnsMaxPrecisionBits = 16;
+
+// Probability table of the interleaved rANS coders. A table can be created
+// once and shared by the encoders and decoders of many streams with the same
+// statistics, which then don't rebuild and transmit it.
+class InterleavedRAnsTable {
+ public:
+  InterleavedRAnsTable();
+
+  // Creates the table for the symbols [0, |num_symbols|) from their
+  // |frequencies|. |num_states| must be 4 or 8 and |precision_bits| in range
+  // [12, 16]. Returns false if the frequencies can't be represented with the
+  // precision.
+  bool Create(const uint64_t *frequencies, int num_symbols, int num_states,
+              int precision_bits);
+
+  void Encode(EncoderBuffer *buffer) const;
+  bool Decode(DecoderBuffer *buffer);
+
+  int num_states() const { return num_states_; }
+  int precision_bits() const { return precision_bits_; }
+  uint32_t num_symbols() const {
+    return static_cast<uint32_t>(probabilities_.size());
+  }
+  // Probabilities of the symbols, they sum up to 1 << precision_bits().
+  const std::vector<uint32_t> &probabilities() const {
+    return probabilities_;
+  }
+  // Checksum of the table contents, used to verify that a stream is decoded
+  // with the table it was encoded with.
+  uint32_t checksum() const { return checksum_; }
+
+ private:
+  void UpdateChecksum();
+
+  int num_states_;
+  int precision_bits_;
+  std::vector<uint32_t> probabilities_;
+  uint32_t checksum_;
+};
+
+class InterleavedRAnsEncoder {
+ public:
+  InterleavedRAnsEncoder();
+
+  // Creates a probability table for the symbols [0, |num_symbols|) from
+  // their |frequencies| and encodes it into |buffer|. See
+  // InterleavedRAnsTable::Create().
+  bool Create(const uint64_t *frequencies, int num_symbols, int num_states,
+              int precision_bits, EncoderBuffer *buffer);
+
+  // Uses |table| without encoding it. The table is copied.
+  bool Create(const InterleavedRAnsTable &table);
+
+  // Returns true if |symbol| has a nonzero probability, i.e. can be encoded.
+  bool HasSymbol(uint32_t symbol) const {
+    return symbol < symbols_.size() && symbols_[symbol].frequency > 0;
+  }
+  uint32_t num_symbols() const {
+    return static_cast<uint32_t>(symbols_.size());
+  }
+
+  // Encodes |num_values| symbols. Each symbol must have a nonzero frequency.
+  void EncodeSymbols(const uint32_t *symbols, size_t num_values,
+                     EncoderBuffer *buffer);
+
+ private:
+  struct Symbol {
+    uint32_t frequency;
+    // Sum of the frequencies of the preceding symbols.
+    uint32_t cumulative_frequency;
+  };
+
+  int num_states_;
+  int precision_bits_;
+  std::vector<Symbol> symbols_;
+  // Renormalization words, reused between calls. Each symbol emits at most
+  // one word, so they are written backwards from the end of a buffer of one
+  // word per symbol and end up in decoding order.
+  AlignedBuffer words_;
+};
+
+// Layouts of the decoding table of InterleavedRAnsDecoder. Both are indexed
+// by the low precision bits of a state (a slot) and decode the same symbols.
+enum InterleavedRAnsTableLayout {
+  // Chosen by the decoder from the size of the alphabet and the precision.
+  INTERLEAVED_RANS_TABLE_AUTO = 0,
+  // One 4-byte entry per slot holding the symbol, its frequency and the
+  // offset of the slot. Limited to 256 symbols and 12 precision bits.
+  INTERLEAVED_RANS_TABLE_PACKED,
+  // One 4-byte (offset, frequency) entry and one 2-byte symbol per slot, two
+  // independent loads per symbol.
+  INTERLEAVED_RANS_TABLE_SLOT_ENTRIES,
+};
+
+class InterleavedRAnsDecoder {
+ public:
+  InterleavedRAnsDecoder();
+
+  // Decodes the probability table written by InterleavedRAnsEncoder.
+  bool Create(DecoderBuffer *buffer);
+
+  // Builds the decoding table of |table|. A decoder created once from a
+  // shared table can decode any number of streams.
+  bool Create(const InterleavedRAnsTable &table);
+
+  // Same as above with the given decoding table |layout|, used to compare
+  // the layouts (see interleaved_rans_benchmark.cc). Returns false if the
+  // table does not fit into the layout.
+  bool Create(const InterleavedRAnsTable &table,
+              InterleavedRAnsTableLayout layout);
+
+  InterleavedRAnsTableLayout table_layout() const { return table_layout_; }
+
+  uint32_t num_symbols() const { return num_symbols_; }
+
+  // Decodes |num_values| symbols into |out_values|. The buffer is advanced
+  // past the coded symbols. Returns false if the data is corrupted.
+  bool DecodeSymbols(size_t num_values, DecoderBuffer *buffer,
+                     uint32_t *out_values);
+
+ private:
+  int num_states_;
+  int precision_bits_;
+  uint32_t num_symbols_;
+  InterleavedRAnsTableLayout table_layout_;
+  // Decoding tables indexed by the low |precision_bits_| bits of a state,
+  // only the ones of |table_layout_| are used.
+  //   PACKED: |packed_slots_| of uint32_t.
+  //   SLOT_ENTRIES: |slot_entries_| of uint32_t holding
+  //       (offset << 16) | (frequency - 1) and |slot_symbols_| of uint16_t.
+  // Every slot is written by Create(), so the tables are not zero-filled.
+  AlignedBuffer packed_slots_;
+  AlignedBuffer slot_entries_;
+  AlignedBuffer slot_symbols_;
+};
+
+// Encodes |num_values| symbols with InterleavedRAnsEncoder using
+// |num_states| states (4 or 8). Large symbols are coded as an escape symbol
+// followed by a varint, so arbitrary values are supported but the coder is
+// most efficient for small symbols such as prediction residuals.
+bool EncodeInterleavedSymbols(const uint32_t *symbols, size_t num_values,
+                              int num_states, EncoderBuffer *target_buffer);
+
+// Decodes symbols encoded by EncodeInterleavedSymbols().
+bool DecodeInterleavedSymbols(size_t num_values, DecoderBuffer *src_buffer,
+                              uint32_t *out_values);
+
+// Collects the symbol frequencies of streams coded by
+// EncodeInterleavedSymbols() to create a table that is shared by all of
+// them, e.g. by all frames of a sequence.
+class InterleavedSymbolHistogram {
+ public:
+  void AddSymbols(const uint32_t *symbols, size_t num_values);
+  void Clear() { frequencies_.clear(); }
+  bool empty() const { return frequencies_.empty(); }
+
+  // Creates a table with |num_states| states (4 or 8) for the symbols seen so
+  // far. The last symbol of the table is an escape for symbols that were not
+  // seen or are too large, so the table can code any stream.
+  bool CreateTable(int num_states, InterleavedRAnsTable *out_table) const;
+
+ private:
+  // Large symbols are counted together in the last entry.
+  std::vector<uint64_t> frequencies_;
+};
+
+// Encodes |num_values| symbols with |encoder|, which was created from a
+// shared table of InterleavedSymbolHistogram::CreateTable(). Only the coded
+// symbols are written, symbols that can't be coded with the table are coded
+// as the escape symbol followed by their varint.
+bool EncodeInterleavedSymbols(const uint32_t *symbols, size_t num_values,
+                              InterleavedRAnsEncoder *encoder,
+                              EncoderBuffer *target_buffer);
+
+// Decodes symbols encoded with a shared table. |decoder| must be created from
+// the same table.
+bool DecodeInterleavedSymbols(size_t num_values,
+                              InterleavedRAnsDecoder *decoder,
+                              DecoderBuffer *src_buffer, uint32_t *out_values);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ENTROPY_INTERLEAVED_RANS_H_
@@ -0,0 +1,152 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Measures the decoding speed of InterleavedRAnsDecoder with each decoding
+// table layout, to check the layout chosen by INTERLEAVED_RANS_TABLE_AUTO on
+// a given core. The benchmark is not part of the app target. Build it with
+// the entropy coder and a Draco library for the host, e.g.:
+//
+//   c++ -std=c++17 -O2 -I draco
+//       draco/compression/entropy/interleaved_rans_benchmark.cc
+//       draco/compression/entropy/interleaved_rans.cc -ldraco
+//
+// Add -msse4.1 on x86 to measure the SIMD decoder, NEON is used on arm64.
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "compression/entropy/interleaved_rans.h"
+
+namespace {
+
+struct BenchmarkConfig {
+  int num_symbols;
+  int precision_bits;
+  int num_states;
+};
+
+// Decoded symbols per configuration and run.
+constexpr size_t kNumValues = 1 << 22;
+constexpr int kNumRuns = 15;
+
+const char *GetLayoutName(draco::InterleavedRAnsTableLayout layout) {
+  switch (layout) {
+    case draco::INTERLEAVED_RANS_TABLE_PACKED:
+      return "packed";
+    case draco::INTERLEAVED_RANS_TABLE_SLOT_ENTRIES:
+      return "slot entries";
+    default:
+      return "auto";
+  }
+}
+
+// Returns symbols with a geometric distribution, which is how prediction
+// residuals are distributed, that use most of the |num_symbols| alphabet.
+std::vector<uint32_t> GenerateSymbols(int num_symbols) {
+  std::mt19937 generator(num_symbols);
+  std::geometric_distribution<uint32_t> distribution(
+      std::min(0.5, 8.0 / num_symbols));
+  std::vector<uint32_t> symbols(kNumValues);
+  for (uint32_t &symbol : symbols) {
+    symbol = std::min<uint32_t>(distribution(generator), num_symbols - 1);
+  }
+  return symbols;
+}
+
+// Returns the decoding speed in million symbols per second, the best of
+// kNumRuns runs, or a negative value if the layout does not fit the table.
+double MeasureDecoding(const draco::InterleavedRAnsTable &table,
+                       const draco::EncoderBuffer &encoded,
+                       draco::InterleavedRAnsTableLayout layout,
+                       const std::vector<uint32_t> &symbols) {
+  draco::InterleavedRAnsDecoder decoder;
+  if (!decoder.Create(table, layout)) {
+    return -1.0;
+  }
+  std::vector<uint32_t> decoded(symbols.size());
+  double best_seconds = 0.0;
+  for (int run = 0; run < kNumRuns; ++run) {
+    draco::DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    const auto start = std::chrono::steady_clock::now();
+    if (!decoder.DecodeSymbols(decoded.size(), &buffer, decoded.data())) {
+      return -1.0;
+    }
+    const std::chrono::duration<double> seconds =
+        std::chrono::steady_clock::now() - start;
+    if (run == 0 || seconds.count() < best_seconds) {
+      best_seconds = seconds.count();
+    }
+  }
+  if (decoded != symbols) {
+    printf("Decoded symbols differ with the %s layout.\n",
+           GetLayoutName(layout));
+    return -1.0;
+  }
+  return symbols.size() / best_seconds * 1e-6;
+}
+
+}  // namespace
+
+int main() {
+  const BenchmarkConfig configs[] = {
+      {42, 12, 8},   {200, 12, 8},   {200, 14, 8}, {200, 16, 8},
+      {734, 15, 8},  {734, 16, 4},   {4096, 16, 8},
+  };
+  const draco::InterleavedRAnsTableLayout layouts[] = {
+      draco::INTERLEAVED_RANS_TABLE_PACKED,
+      draco::INTERLEAVED_RANS_TABLE_SLOT_ENTRIES,
+      draco::INTERLEAVED_RANS_TABLE_AUTO,
+  };
+  printf("Decoding speed in Msym/s (%zu symbols, best of %d runs)\n",
+         kNumValues, kNumRuns);
+  printf("%8s %9s %7s", "symbols", "precision", "states");
+  for (const draco::InterleavedRAnsTableLayout layout : layouts) {
+    printf(" %13s", GetLayoutName(layout));
+  }
+  printf("\n");
+  for (const BenchmarkConfig &config : configs) {
+    const std::vector<uint32_t> symbols = GenerateSymbols(config.num_symbols);
+    std::vector<uint64_t> frequencies(config.num_symbols, 0);
+    for (const uint32_t symbol : symbols) {
+      ++frequencies[symbol];
+    }
+    draco::InterleavedRAnsTable table;
+    draco::InterleavedRAnsEncoder encoder;
+    if (!table.Create(frequencies.data(), config.num_symbols,
+                      config.num_states, config.precision_bits) ||
+        !encoder.Create(table)) {
+      printf("Failed to create the table.\n");
+      return 1;
+    }
+    draco::EncoderBuffer encoded;
+    encoder.EncodeSymbols(symbols.data(), symbols.size(), &encoded);
+    printf("%8d %9d %7d", config.num_symbols, config.precision_bits,
+           config.num_states);
+    for (const draco::InterleavedRAnsTableLayout layout : layouts) {
+      const double speed = MeasureDecoding(table, encoded, layout, symbols);
+      if (speed < 0.0) {
+        printf(" %13s", "-");
+      } else {
+        printf(" %13.0f", speed);
+      }
+    }
+    printf("\n");
+  }
+  return 0;
+}
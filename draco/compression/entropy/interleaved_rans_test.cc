@@ -0,0 +1,387 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/entropy/interleaved_rans.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class InterleavedRAnsTest : public ::testing::Test {
+ protected:
+  InterleavedRAnsTest() : rng_(13) {}
+
+  // Returns |num_values| geometrically distributed symbols, like prediction
+  // residuals.
+  std::vector<uint32_t> CreateSymbols(size_t num_values, double p) {
+    std::geometric_distribution<uint32_t> dist(p);
+    std::vector<uint32_t> symbols(num_values);
+    for (uint32_t &symbol : symbols) {
+      symbol = dist(rng_);
+    }
+    return symbols;
+  }
+
+  static std::vector<uint64_t> CountSymbols(
+      const std::vector<uint32_t> &symbols, uint32_t num_symbols) {
+    std::vector<uint64_t> frequencies(num_symbols, 0);
+    for (const uint32_t symbol : symbols) {
+      ++frequencies[symbol];
+    }
+    return frequencies;
+  }
+
+  // Encodes |symbols| with EncodeInterleavedSymbols() and expects them to be
+  // decoded exactly, consuming all of the data.
+  void TestRoundTrip(const std::vector<uint32_t> &symbols, int num_states) {
+    EncoderBuffer buffer;
+    ASSERT_TRUE(EncodeInterleavedSymbols(symbols.data(), symbols.size(),
+                                         num_states, &buffer));
+    DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), buffer.size());
+    std::vector<uint32_t> decoded(symbols.size());
+    ASSERT_TRUE(
+        DecodeInterleavedSymbols(decoded.size(), &in_buffer, decoded.data()));
+    EXPECT_EQ(decoded, symbols);
+    EXPECT_EQ(in_buffer.remaining_size(), 0);
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(InterleavedRAnsTest, TestRoundTrip) {
+  for (const int num_states : {4, 8}) {
+    // Sizes that are not a multiple of the number of states.
+    for (const size_t num_values : {1, 3, 4, 7, 9, 1000, 100003}) {
+      TestRoundTrip(CreateSymbols(num_values, 0.3), num_states);
+    }
+    // A single symbol, a highly skewed and a flat distribution.
+    TestRoundTrip(std::vector<uint32_t>(1000, 5), num_states);
+    TestRoundTrip(CreateSymbols(10000, 0.95), num_states);
+    std::vector<uint32_t> flat(10000);
+    for (uint32_t &symbol : flat) {
+      symbol = rng_() % 4000;
+    }
+    TestRoundTrip(flat, num_states);
+    TestRoundTrip({}, num_states);
+  }
+}
+
+TEST_F(InterleavedRAnsTest, TestEscapeSymbols) {
+  // Symbols outside of the alphabet of the coder are coded as varints.
+  std::vector<uint32_t> symbols = CreateSymbols(5000, 0.2);
+  for (size_t i = 0; i < symbols.size(); i += 97) {
+    symbols[i] = 4095 + static_cast<uint32_t>(rng_() % 3);
+  }
+  symbols[1] = 100000;
+  symbols[2] = std::numeric_limits<uint32_t>::max();
+  TestRoundTrip(symbols, 4);
+  TestRoundTrip(symbols, 8);
+}
+
+TEST_F(InterleavedRAnsTest, TestTable) {
+  const std::vector<uint32_t> symbols = CreateSymbols(10000, 0.1);
+  const uint32_t num_symbols =
+      *std::max_element(symbols.begin(), symbols.end()) + 1;
+  const std::vector<uint64_t> frequencies = CountSymbols(symbols, num_symbols);
+  InterleavedRAnsTable table;
+  ASSERT_TRUE(table.Create(frequencies.data(), num_symbols, 8, 14));
+  EXPECT_EQ(table.num_states(), 8);
+  EXPECT_EQ(table.precision_bits(), 14);
+  ASSERT_EQ(table.num_symbols(), num_symbols);
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < num_symbols; ++i) {
+    // Symbols that occur keep a nonzero probability.
+    EXPECT_EQ(table.probabilities()[i] > 0, frequencies[i] > 0);
+    sum += table.probabilities()[i];
+  }
+  EXPECT_EQ(sum, 1u << 14);
+
+  EncoderBuffer buffer;
+  table.Encode(&buffer);
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  InterleavedRAnsTable decoded_table;
+  ASSERT_TRUE(decoded_table.Decode(&in_buffer));
+  EXPECT_EQ(decoded_table.num_states(), 8);
+  EXPECT_EQ(decoded_table.precision_bits(), 14);
+  EXPECT_EQ(decoded_table.probabilities(), table.probabilities());
+  EXPECT_EQ(decoded_table.checksum(), table.checksum());
+
+  // Invalid parameters.
+  InterleavedRAnsTable invalid_table;
+  EXPECT_FALSE(invalid_table.Create(frequencies.data(), num_symbols, 3, 14));
+  EXPECT_FALSE(invalid_table.Create(frequencies.data(), num_symbols, 4, 11));
+  EXPECT_FALSE(invalid_table.Create(frequencies.data(), num_symbols, 4, 17));
+  // More symbols than slots.
+  const std::vector<uint64_t> many_frequencies(5000, 1);
+  EXPECT_FALSE(invalid_table.Create(many_frequencies.data(), 5000, 4, 12));
+}
+
+TEST_F(InterleavedRAnsTest, TestTableLayouts) {
+  // Both layouts decode the same symbols, with the SIMD decoder where it is
+  // available.
+  const struct {
+    uint32_t num_symbols;
+    int precision_bits;
+  } configs[] = {{16, 12}, {256, 12}, {300, 12}, {200, 16}, {3000, 15}};
+  for (const auto &config : configs) {
+    std::vector<uint32_t> symbols(20001);
+    std::geometric_distribution<uint32_t> dist(8.0 / config.num_symbols);
+    for (uint32_t &symbol : symbols) {
+      symbol = std::min(dist(rng_), config.num_symbols - 1);
+    }
+    const std::vector<uint64_t> frequencies =
+        CountSymbols(symbols, config.num_symbols);
+    for (const int num_states : {4, 8}) {
+      InterleavedRAnsTable table;
+      ASSERT_TRUE(table.Create(frequencies.data(), config.num_symbols,
+                               num_states, config.precision_bits));
+      InterleavedRAnsEncoder encoder;
+      ASSERT_TRUE(encoder.Create(table));
+      EncoderBuffer buffer;
+      encoder.EncodeSymbols(symbols.data(), symbols.size(), &buffer);
+
+      const bool fits_packed =
+          config.num_symbols <= 256 && config.precision_bits <= 12;
+      for (const InterleavedRAnsTableLayout layout :
+           {INTERLEAVED_RANS_TABLE_AUTO, INTERLEAVED_RANS_TABLE_PACKED,
+            INTERLEAVED_RANS_TABLE_SLOT_ENTRIES}) {
+        InterleavedRAnsDecoder decoder;
+        if (layout == INTERLEAVED_RANS_TABLE_PACKED && !fits_packed) {
+          EXPECT_FALSE(decoder.Create(table, layout));
+          continue;
+        }
+        ASSERT_TRUE(decoder.Create(table, layout));
+        if (layout == INTERLEAVED_RANS_TABLE_AUTO) {
+          EXPECT_EQ(decoder.table_layout(),
+                    fits_packed ? INTERLEAVED_RANS_TABLE_PACKED
+                                : INTERLEAVED_RANS_TABLE_SLOT_ENTRIES);
+        } else {
+          EXPECT_EQ(decoder.table_layout(), layout);
+        }
+        // The decoder can be used for several streams.
+        for (int i = 0; i < 2; ++i) {
+          DecoderBuffer in_buffer;
+          in_buffer.Init(buffer.data(), buffer.size());
+          std::vector<uint32_t> decoded(symbols.size());
+          ASSERT_TRUE(decoder.DecodeSymbols(decoded.size(), &in_buffer,
+                                            decoded.data()));
+          EXPECT_EQ(decoded, symbols)
+              << config.num_symbols << " " << layout;
+          EXPECT_EQ(in_buffer.remaining_size(), 0);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(InterleavedRAnsTest, TestSharedTable) {
+  InterleavedSymbolHistogram histogram;
+  EXPECT_TRUE(histogram.empty());
+  const std::vector<uint32_t> training_symbols = CreateSymbols(10000, 0.2);
+  histogram.AddSymbols(training_symbols.data(), training_symbols.size());
+  EXPECT_FALSE(histogram.empty());
+  InterleavedRAnsTable table;
+  ASSERT_TRUE(histogram.CreateTable(4, &table));
+
+  InterleavedRAnsEncoder encoder;
+  ASSERT_TRUE(encoder.Create(table));
+  InterleavedRAnsDecoder decoder;
+  ASSERT_TRUE(decoder.Create(table));
+  for (int stream = 0; stream < 3; ++stream) {
+    // Symbols that were not seen or are too large are escaped.
+    std::vector<uint32_t> symbols = CreateSymbols(5000, 0.2);
+    symbols[0] = 1000;
+    symbols[10] = std::numeric_limits<uint32_t>::max();
+    symbols[20] = table.num_symbols() - 1;
+    EncoderBuffer buffer;
+    ASSERT_TRUE(EncodeInterleavedSymbols(symbols.data(), symbols.size(),
+                                         &encoder, &buffer));
+    DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), buffer.size());
+    std::vector<uint32_t> decoded(symbols.size());
+    ASSERT_TRUE(DecodeInterleavedSymbols(decoded.size(), &decoder, &in_buffer,
+                                         decoded.data()));
+    EXPECT_EQ(decoded, symbols);
+    EXPECT_EQ(in_buffer.remaining_size(), 0);
+  }
+
+  // Encoders and decoders without a table are rejected.
+  InterleavedRAnsEncoder empty_encoder;
+  EncoderBuffer buffer;
+  EXPECT_FALSE(EncodeInterleavedSymbols(training_symbols.data(), 1,
+                                        &empty_encoder, &buffer));
+  InterleavedRAnsDecoder empty_decoder;
+  DecoderBuffer in_buffer;
+  uint32_t value;
+  EXPECT_FALSE(
+      DecodeInterleavedSymbols(1, &empty_decoder, &in_buffer, &value));
+}
+
+TEST_F(InterleavedRAnsTest, TestSharedTableTransmission) {
+  // A shared table is transmitted once, e.g. in the header of a sequence, and
+  // the decoder is created from the decoded table.
+  InterleavedSymbolHistogram histogram;
+  const std::vector<uint32_t> training_symbols = CreateSymbols(10000, 0.3);
+  histogram.AddSymbols(training_symbols.data(), training_symbols.size());
+  InterleavedRAnsTable table;
+  ASSERT_TRUE(histogram.CreateTable(8, &table));
+  EncoderBuffer table_buffer;
+  table.Encode(&table_buffer);
+  DecoderBuffer in_table_buffer;
+  in_table_buffer.Init(table_buffer.data(), table_buffer.size());
+  InterleavedRAnsTable decoded_table;
+  ASSERT_TRUE(decoded_table.Decode(&in_table_buffer));
+  EXPECT_EQ(decoded_table.checksum(), table.checksum());
+
+  InterleavedRAnsEncoder encoder;
+  ASSERT_TRUE(encoder.Create(table));
+  InterleavedRAnsDecoder decoder;
+  ASSERT_TRUE(decoder.Create(decoded_table));
+  // Streams of any size, decoded by the same decoder.
+  for (const size_t num_values : {200, 0, 1, 13, 5000}) {
+    const std::vector<uint32_t> symbols = CreateSymbols(num_values, 0.3);
+    EncoderBuffer buffer;
+    ASSERT_TRUE(EncodeInterleavedSymbols(symbols.data(), symbols.size(),
+                                         &encoder, &buffer));
+    DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), buffer.size());
+    std::vector<uint32_t> decoded(symbols.size());
+    ASSERT_TRUE(DecodeInterleavedSymbols(decoded.size(), &decoder, &in_buffer,
+                                         decoded.data()));
+    EXPECT_EQ(decoded, symbols) << num_values;
+    EXPECT_EQ(in_buffer.remaining_size(), 0);
+
+    if (num_values == 200) {
+      // Small streams are smaller without the table of each stream.
+      EncoderBuffer table_stream_buffer;
+      ASSERT_TRUE(EncodeInterleavedSymbols(symbols.data(), symbols.size(), 8,
+                                           &table_stream_buffer));
+      EXPECT_LT(buffer.size(), table_stream_buffer.size());
+    }
+  }
+
+  // Truncated tables are rejected.
+  for (size_t size = 0; size < table_buffer.size(); ++size) {
+    DecoderBuffer in_buffer;
+    in_buffer.Init(table_buffer.data(), size);
+    InterleavedRAnsTable truncated_table;
+    ASSERT_FALSE(truncated_table.Decode(&in_buffer)) << size;
+  }
+}
+
+TEST_F(InterleavedRAnsTest, TestSharedTableChecksum) {
+  InterleavedSymbolHistogram histogram;
+  const std::vector<uint32_t> symbols = CreateSymbols(10000, 0.3);
+  histogram.AddSymbols(symbols.data(), symbols.size());
+  InterleavedRAnsTable table;
+  ASSERT_TRUE(histogram.CreateTable(4, &table));
+
+  // The same statistics give the same table.
+  InterleavedRAnsTable same_table;
+  ASSERT_TRUE(histogram.CreateTable(4, &same_table));
+  EXPECT_EQ(same_table.checksum(), table.checksum());
+
+  // Tables with other parameters or statistics have other checksums.
+  InterleavedRAnsTable other_states_table;
+  ASSERT_TRUE(histogram.CreateTable(8, &other_states_table));
+  EXPECT_NE(other_states_table.checksum(), table.checksum());
+  histogram.AddSymbols(symbols.data(), 100);
+  InterleavedRAnsTable other_statistics_table;
+  ASSERT_TRUE(histogram.CreateTable(4, &other_statistics_table));
+  EXPECT_NE(other_statistics_table.probabilities(), table.probabilities());
+  EXPECT_NE(other_statistics_table.checksum(), table.checksum());
+}
+
+TEST_F(InterleavedRAnsTest, TestSharedTableWithoutEscape) {
+  // A table that was not created by InterleavedSymbolHistogram has no escape
+  // symbol and can't be used to code arbitrary streams.
+  const std::vector<uint64_t> frequencies = {10, 5, 1, 0};
+  InterleavedRAnsTable table;
+  ASSERT_TRUE(table.Create(frequencies.data(), 4, 4, 12));
+  InterleavedRAnsEncoder encoder;
+  ASSERT_TRUE(encoder.Create(table));
+  const std::vector<uint32_t> symbols = {0, 1, 2, 0};
+  EncoderBuffer buffer;
+  EXPECT_FALSE(EncodeInterleavedSymbols(symbols.data(), symbols.size(),
+                                        &encoder, &buffer));
+  EXPECT_EQ(buffer.size(), 0u);
+}
+
+TEST_F(InterleavedRAnsTest, TestTruncatedData) {
+  std::vector<uint32_t> symbols = CreateSymbols(2000, 0.3);
+  symbols[100] = 5000;
+  symbols.back() = 70000;
+  for (const int num_states : {4, 8}) {
+    EncoderBuffer buffer;
+    ASSERT_TRUE(EncodeInterleavedSymbols(symbols.data(), symbols.size(),
+                                         num_states, &buffer));
+    for (size_t size = 0; size < buffer.size(); ++size) {
+      DecoderBuffer in_buffer;
+      in_buffer.Init(buffer.data(), size);
+      std::vector<uint32_t> decoded(symbols.size());
+      ASSERT_FALSE(DecodeInterleavedSymbols(decoded.size(), &in_buffer,
+                                            decoded.data()))
+          << size;
+    }
+  }
+}
+
+TEST_F(InterleavedRAnsTest, TestCorruptedData) {
+  const std::vector<uint32_t> symbols = CreateSymbols(2000, 0.3);
+  EncoderBuffer buffer;
+  ASSERT_TRUE(
+      EncodeInterleavedSymbols(symbols.data(), symbols.size(), 4, &buffer));
+  const std::vector<char> data(buffer.data(), buffer.data() + buffer.size());
+
+  // Invalid number of states and precision of the table.
+  for (const char value : {0, 3, 9}) {
+    std::vector<char> corrupted = data;
+    corrupted[0] = value;
+    DecoderBuffer in_buffer;
+    in_buffer.Init(corrupted.data(), corrupted.size());
+    std::vector<uint32_t> decoded(symbols.size());
+    EXPECT_FALSE(
+        DecodeInterleavedSymbols(decoded.size(), &in_buffer, decoded.data()));
+  }
+  for (const char value : {0, 11, 17}) {
+    std::vector<char> corrupted = data;
+    corrupted[1] = value;
+    DecoderBuffer in_buffer;
+    in_buffer.Init(corrupted.data(), corrupted.size());
+    std::vector<uint32_t> decoded(symbols.size());
+    EXPECT_FALSE(
+        DecodeInterleavedSymbols(decoded.size(), &in_buffer, decoded.data()));
+  }
+
+  // Flipped bits must not crash the decoder or make it read past the data.
+  // They are not always detected.
+  for (int i = 0; i < 2000; ++i) {
+    std::vector<char> corrupted = data;
+    corrupted[rng_() % corrupted.size()] ^=
+        static_cast<char>(1 << (rng_() % 8));
+    DecoderBuffer in_buffer;
+    in_buffer.Init(corrupted.data(), corrupted.size());
+    std::vector<uint32_t> decoded(symbols.size());
+    DecodeInterleavedSymbols(decoded.size(), &in_buffer, decoded.data());
+  }
+}
+
+}  // namespace draco
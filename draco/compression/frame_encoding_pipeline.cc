@@ -0,0 +1,344 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/frame_encoding_pipeline.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "compression/encoder_session.h"
+#include "compression/point_cloud/point_cloud_sequence_encoder.h"
+
+namespace draco {
+
+struct FrameEncodingPipeline::WorkerState {
+  EncoderSession session;
+  PointCloudSequenceEncoder sequence_encoder;
+};
+
+FrameEncodingPipeline::FrameEncodingPipeline(
+    const FrameEncodingPipelineOptions &options, Sink sink)
+    : options_(options),
+      sink_(std::move(sink)),
+      max_frames_in_flight_(0),
+      num_pending_submissions_(0),
+      next_frame_index_(0),
+      next_write_index_(0),
+      closing_(false),
+      workers_done_(false),
+      closed_(false) {
+  const int num_workers =
+      options_.temporal_prediction ? 1 : std::max(options_.num_workers, 1);
+  // Each worker may run one frame ahead of the writer while another one is
+  // waiting to be written.
+  max_frames_in_flight_ = 2 * num_workers;
+  for (int i = 0; i < num_workers; ++i) {
+    std::unique_ptr<WorkerState> state(new WorkerState());
+    state->session.SetSpeedOptions(options_.encoding_speed,
+                                   options_.decoding_speed);
+    state->session.SetAttributeQuantization(
+        GeometryAttribute::POSITION, options_.position_quantization_bits);
+    state->sequence_encoder.SetQuantizationBits(
+        options_.position_quantization_bits);
+    state->sequence_encoder.SetKeyFrameInterval(options_.key_frame_interval);
+    state->sequence_encoder.SetSubtreeDepth(options_.subtree_depth);
+    state->sequence_encoder.SetNumThreads(std::max(options_.num_workers, 1));
+    worker_states_.push_back(std::move(state));
+  }
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.emplace_back(&FrameEncodingPipeline::WorkerLoop, this,
+                          worker_states_[i].get());
+  }
+  writer_ = std::thread(&FrameEncodingPipeline::WriterLoop, this);
+}
+
+FrameEncodingPipeline::~FrameEncodingPipeline() { Close(); }
+
+bool FrameEncodingPipeline::SubmitFrame(const float *positions,
+                                        size_t num_points,
+                                        int64_t byte_stride,
+                                        int64_t timestamp_us) {
+  if (byte_stride == 0) {
+    byte_stride = 3 * sizeof(float);
+  }
+  if ((positions == nullptr && num_points > 0) ||
+      byte_stride < static_cast<int64_t>(3 * sizeof(float))) {
+    return false;
+  }
+  const size_t capacity = std::max(options_.queue_capacity, 1);
+  std::unique_ptr<Job> job;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closing_) {
+      return false;
+    }
+    ++stats_.num_submitted_frames;
+    if (queue_.size() + num_pending_submissions_ >= capacity) {
+      if (options_.queue_policy == FRAME_ENCODING_QUEUE_BLOCK) {
+        queue_not_full_.wait(lock, [this, capacity] {
+          return queue_.size() + num_pending_submissions_ < capacity ||
+                 closing_;
+        });
+        if (closing_) {
+          ++stats_.num_dropped_frames;
+          return false;
+        }
+      } else if (options_.queue_policy == FRAME_ENCODING_QUEUE_DROP_OLDEST &&
+                 !queue_.empty()) {
+        free_jobs_.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+        ++stats_.num_dropped_frames;
+      } else {
+        ++stats_.num_dropped_frames;
+        return false;
+      }
+    }
+    ++num_pending_submissions_;
+    job = AcquireJob();
+  }
+
+  // The input is copied without holding the lock, the queue slot is
+  // reserved by |num_pending_submissions_|.
+  job->num_points = num_points;
+  job->timestamp_us = timestamp_us;
+  job->positions.resize(3 * num_points);
+  if (byte_stride == static_cast<int64_t>(3 * sizeof(float))) {
+    if (num_points > 0) {
+      memcpy(job->positions.data(), positions, 3 * sizeof(float) * num_points);
+    }
+  } else {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(positions);
+    for (size_t i = 0; i < num_points; ++i) {
+      memcpy(&job->positions[3 * i], src + byte_stride * i,
+             3 * sizeof(float));
+    }
+  }
+  job->submit_time = Clock::now();
+
+  bool closing;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --num_pending_submissions_;
+    queue_.push_back(std::move(job));
+    stats_.max_queue_depth =
+        std::max(stats_.max_queue_depth, static_cast<int>(queue_.size()));
+    closing = closing_;
+  }
+  // While closing, idle workers wait for the last pending submission before
+  // they exit.
+  if (closing) {
+    job_available_.notify_all();
+  } else {
+    job_available_.notify_one();
+  }
+  return true;
+}
+
+Status FrameEncodingPipeline::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  frame_written_.wait(lock, [this] {
+    return (queue_.empty() && num_pending_submissions_ == 0 &&
+            next_write_index_ == next_frame_index_) ||
+           workers_done_;
+  });
+  return error_;
+}
+
+Status FrameEncodingPipeline::Close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return error_;
+    }
+    closed_ = true;
+    closing_ = true;
+  }
+  // Workers drain the queue before they exit.
+  job_available_.notify_all();
+  queue_not_full_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    workers_done_ = true;
+  }
+  result_available_.notify_all();
+  writer_.join();
+  frame_written_.notify_all();
+  std::lock_guard<std::mutex> lock(mutex_);
+  return error_;
+}
+
+FrameEncodingPipelineStats FrameEncodingPipeline::GetStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  FrameEncodingPipelineStats stats = stats_;
+  stats.queue_depth = static_cast<int>(queue_.size());
+  stats.num_frames_in_flight =
+      static_cast<int>(next_frame_index_ - next_write_index_);
+  return stats;
+}
+
+void FrameEncodingPipeline::WorkerLoop(WorkerState *state) {
+  while (true) {
+    std::unique_ptr<Job> job;
+    std::unique_ptr<Result> result;
+    int64_t frame_index;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // New frames are taken only while the writer keeps up, otherwise the
+      // input queue fills up and the queue policy applies. Submissions that
+      // are still copying their input when the pipeline closes are encoded
+      // too.
+      job_available_.wait(lock, [this] {
+        return (!queue_.empty() && next_frame_index_ - next_write_index_ <
+                                       max_frames_in_flight_) ||
+               (closing_ && queue_.empty() && num_pending_submissions_ == 0);
+      });
+      if (queue_.empty()) {
+        return;
+      }
+      job = std::move(queue_.front());
+      queue_.pop_front();
+      frame_index = next_frame_index_++;
+      result = AcquireResult();
+      AddLatency(&stats_.queue_wait, job->submit_time, Clock::now());
+    }
+    queue_not_full_.notify_one();
+
+    const Clock::time_point encode_start = Clock::now();
+    result->timestamp_us = job->timestamp_us;
+    result->buffer.Clear();
+    Status status;
+    if (options_.temporal_prediction) {
+      status = state->sequence_encoder.EncodeFrame(
+          job->positions.data(), job->num_points, 0, &result->buffer);
+      result->is_key_frame = state->sequence_encoder.last_frame_is_key_frame();
+    } else {
+      // Encoded directly into the result, which is passed to the sink.
+      status = state->session.EncodePositions(
+          job->positions.data(),
+          static_cast<PointIndex::ValueType>(job->num_points), 0,
+          &result->buffer);
+      result->is_key_frame = true;
+    }
+    result->ok = status.ok();
+    result->done_time = Clock::now();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      AddLatency(&stats_.encode, encode_start, result->done_time);
+      if (!status.ok()) {
+        ++stats_.num_failed_frames;
+        SetError(status);
+      }
+      free_jobs_.push_back(std::move(job));
+      completed_[frame_index] = std::move(result);
+    }
+    result_available_.notify_one();
+  }
+}
+
+void FrameEncodingPipeline::WriterLoop() {
+  while (true) {
+    std::unique_ptr<Result> result;
+    int64_t frame_index;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      result_available_.wait(lock, [this] {
+        return completed_.count(next_write_index_) > 0 || workers_done_;
+      });
+      const auto it = completed_.find(next_write_index_);
+      if (it == completed_.end()) {
+        // All workers finished and every frame was written.
+        return;
+      }
+      result = std::move(it->second);
+      completed_.erase(it);
+      frame_index = next_write_index_;
+      AddLatency(&stats_.reorder_wait, result->done_time, Clock::now());
+    }
+
+    // The sink is called without holding the lock so that the workers can
+    // continue with the following frames.
+    const Clock::time_point write_start = Clock::now();
+    Status status;
+    if (result->ok) {
+      EncodedFrame frame;
+      frame.frame_index = frame_index;
+      frame.timestamp_us = result->timestamp_us;
+      frame.is_key_frame = result->is_key_frame;
+      frame.data = result->buffer.data();
+      frame.size = result->buffer.size();
+      status = sink_(frame);
+    }
+    const Clock::time_point write_end = Clock::now();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (result->ok) {
+        AddLatency(&stats_.write, write_start, write_end);
+        if (status.ok()) {
+          ++stats_.num_written_frames;
+        } else {
+          SetError(status);
+        }
+      }
+      ++next_write_index_;
+      free_results_.push_back(std::move(result));
+    }
+    job_available_.notify_all();
+    frame_written_.notify_all();
+  }
+}
+
+void FrameEncodingPipeline::SetError(const Status &status) {
+  if (error_.ok()) {
+    error_ = status;
+  }
+}
+
+std::unique_ptr<FrameEncodingPipeline::Job>
+FrameEncodingPipeline::AcquireJob() {
+  if (free_jobs_.empty()) {
+    return std::unique_ptr<Job>(new Job());
+  }
+  std::unique_ptr<Job> job = std::move(free_jobs_.back());
+  free_jobs_.pop_back();
+  return job;
+}
+
+std::unique_ptr<FrameEncodingPipeline::Result>
+FrameEncodingPipeline::AcquireResult() {
+  if (free_results_.empty()) {
+    return std::unique_ptr<Result>(new Result());
+  }
+  std::unique_ptr<Result> result = std::move(free_results_.back());
+  free_results_.pop_back();
+  return result;
+}
+
+void FrameEncodingPipeline::AddLatency(FrameEncodingStageLatency *latency,
+                                       Clock::time_point start,
+                                       Clock::time_point end) {
+  const int64_t us =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+          .count();
+  ++latency->count;
+  latency->total_us += us;
+  latency->max_us = std::max(latency->max_us, us);
+}
+
+}  // namespace draco
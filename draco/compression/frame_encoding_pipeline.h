@@ -0,0 +1,231 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_FRAME_ENCODING_PIPELINE_H_
+#define DRACO_COMPRESSION_FRAME_ENCODING_PIPELINE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/encoder_buffer.h"
+#include "core/status.h"
+
+namespace draco {
+
+// What FrameEncodingPipeline::SubmitFrame() does when the input queue is full.
+enum FrameEncodingQueuePolicy {
+  // Wait until a worker takes a frame from the queue.
+  FRAME_ENCODING_QUEUE_BLOCK = 0,
+  // Drop the submitted frame.
+  FRAME_ENCODING_QUEUE_DROP_NEWEST,
+  // Drop the oldest queued frame to make room for the submitted frame.
+  FRAME_ENCODING_QUEUE_DROP_OLDEST,
+};
+
+// Options used by the FrameEncodingPipeline class.
+struct FrameEncodingPipelineOptions {
+  // Number of encoding threads. With |temporal_prediction| each frame is
+  // coded against the previous one, so the frames are encoded by a single
+  // worker that uses the threads for the subtrees of a frame instead.
+  int num_workers = 2;
+
+  // Maximum number of frames waiting for a worker.
+  int queue_capacity = 4;
+  FrameEncodingQueuePolicy queue_policy = FRAME_ENCODING_QUEUE_BLOCK;
+
+  // If true, frames are coded by PointCloudSequenceEncoder with a key frame
+  // every |key_frame_interval| frames. Otherwise each frame is an
+  // independent Draco point cloud.
+  bool temporal_prediction = false;
+  int key_frame_interval = 30;
+  // See PointCloudSequenceEncoder::SetSubtreeDepth().
+  int subtree_depth = 0;
+
+  // Encoder options, see Encoder::SetSpeedOptions() and
+  // Encoder::SetAttributeQuantization().
+  int encoding_speed = 5;
+  int decoding_speed = 5;
+  int position_quantization_bits = 11;
+};
+
+// Frame passed to the sink of the pipeline. The data is valid only during the
+// call of the sink.
+struct EncodedFrame {
+  // Index of the frame among all frames that were not dropped.
+  int64_t frame_index;
+  int64_t timestamp_us;
+  bool is_key_frame;
+  const char *data;
+  size_t size;
+};
+
+// Number of events and their duration in microseconds.
+struct FrameEncodingStageLatency {
+  int64_t count = 0;
+  int64_t total_us = 0;
+  int64_t max_us = 0;
+
+  double average_us() const {
+    return count == 0 ? 0.0 : static_cast<double>(total_us) / count;
+  }
+};
+
+// Snapshot of the counters of a FrameEncodingPipeline.
+struct FrameEncodingPipelineStats {
+  int64_t num_submitted_frames = 0;
+  int64_t num_dropped_frames = 0;
+  int64_t num_failed_frames = 0;
+  int64_t num_written_frames = 0;
+  int queue_depth = 0;
+  int max_queue_depth = 0;
+  // Frames taken by a worker but not yet passed to the sink.
+  int num_frames_in_flight = 0;
+  // Time from submission until a worker takes the frame.
+  FrameEncodingStageLatency queue_wait;
+  FrameEncodingStageLatency encode;
+  // Time from the end of encoding until all preceding frames were written.
+  FrameEncodingStageLatency reorder_wait;
+  FrameEncodingStageLatency write;
+};
+
+// Encodes a stream of point cloud frames on a fixed pool of worker threads
+// and passes the encoded frames to a sink in submission order.
+//
+// Submitted positions are copied into a bounded input queue, so the caller
+// can reuse its buffers immediately. When the queue is full the frame is
+// handled according to FrameEncodingQueuePolicy, which keeps memory bounded
+// under sustained load. Each worker owns its encoder state (EncoderSession or
+// PointCloudSequenceEncoder) and reuses it for all of its frames. Frames that
+// finish out of order are held back until all preceding frames were written.
+// The number of frames ahead of the writer is limited as well, so a slow sink
+// eventually fills the input queue instead of growing the reorder buffer.
+//
+// Usage:
+//   FrameEncodingPipeline pipeline(options,
+//       [&](const EncodedFrame &frame) {
+//         return writer->AppendFrame(frame.data, frame.size,
+//                                    frame.timestamp_us);
+//       });
+//   for (each frame) {
+//     pipeline.SubmitFrame(positions, num_points, byte_stride, timestamp_us);
+//   }
+//   DRACO_RETURN_IF_ERROR(pipeline.Close());
+class FrameEncodingPipeline {
+ public:
+  // Called on the writer thread of the pipeline for each encoded frame, in
+  // order of submission. An error is reported by Flush() and Close().
+  typedef std::function<Status(const EncodedFrame &)> Sink;
+
+  FrameEncodingPipeline(const FrameEncodingPipelineOptions &options,
+                        Sink sink);
+  FrameEncodingPipeline(const FrameEncodingPipeline &) = delete;
+  FrameEncodingPipeline &operator=(const FrameEncodingPipeline &) = delete;
+
+  // Closes the pipeline if Close() was not called.
+  ~FrameEncodingPipeline();
+
+  // Queues a frame of |num_points| float triplets that are |byte_stride|
+  // bytes apart (0 means tightly packed). Returns false if the frame was
+  // dropped or the pipeline is closed. With FRAME_ENCODING_QUEUE_BLOCK the
+  // call waits for space in the queue.
+  bool SubmitFrame(const float *positions, size_t num_points,
+                   int64_t byte_stride, int64_t timestamp_us);
+
+  // Waits until all queued frames were passed to the sink. Returns the first
+  // error of the sink or of the encoders.
+  Status Flush();
+
+  // Flushes the pipeline and stops all threads. No more frames can be
+  // submitted afterwards.
+  Status Close();
+
+  FrameEncodingPipelineStats GetStats() const;
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  struct Job {
+    std::vector<float> positions;
+    size_t num_points = 0;
+    int64_t timestamp_us = 0;
+    Clock::time_point submit_time;
+  };
+
+  struct Result {
+    int64_t timestamp_us = 0;
+    bool is_key_frame = false;
+    bool ok = false;
+    EncoderBuffer buffer;
+    Clock::time_point done_time;
+  };
+
+  // Encoder state owned by a worker thread.
+  struct WorkerState;
+
+  void WorkerLoop(WorkerState *state);
+  void WriterLoop();
+  // Records the first error of the pipeline.
+  void SetError(const Status &status);
+
+  // Pools of objects reused between frames. Must be called with |mutex_|
+  // held.
+  std::unique_ptr<Job> AcquireJob();
+  std::unique_ptr<Result> AcquireResult();
+
+  static void AddLatency(FrameEncodingStageLatency *latency,
+                         Clock::time_point start, Clock::time_point end);
+
+  const FrameEncodingPipelineOptions options_;
+  const Sink sink_;
+  // Maximum number of frames that were taken by workers but not written.
+  int64_t max_frames_in_flight_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable job_available_;
+  std::condition_variable queue_not_full_;
+  std::condition_variable result_available_;
+  std::condition_variable frame_written_;
+
+  std::deque<std::unique_ptr<Job>> queue_;
+  // Queue slots reserved by SubmitFrame() calls that are copying their input.
+  int num_pending_submissions_;
+  std::vector<std::unique_ptr<Job>> free_jobs_;
+  std::vector<std::unique_ptr<Result>> free_results_;
+  // Encoded frames waiting for their predecessors, keyed by frame index.
+  std::map<int64_t, std::unique_ptr<Result>> completed_;
+  // Index assigned to the next frame taken from the queue.
+  int64_t next_frame_index_;
+  // Index of the next frame to be passed to the sink.
+  int64_t next_write_index_;
+  bool closing_;
+  bool workers_done_;
+  bool closed_;
+  Status error_;
+  FrameEncodingPipelineStats stats_;
+
+  std::vector<std::unique_ptr<WorkerState>> worker_states_;
+  std::vector<std::thread> workers_;
+  std::thread writer_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_FRAME_ENCODING_PIPELINE_H_
@@ -0,0 +1,251 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/frame_encoding_pipeline.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "compression/point_cloud/point_cloud_sequence_decoder.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+// The frames are coded with temporal prediction, which allows verifying them
+// with PointCloudSequenceDecoder.
+class FrameEncodingPipelineTest : public ::testing::Test {
+ protected:
+  FrameEncodingPipelineTest() : sink_blocked_(false) {
+    options_.temporal_prediction = true;
+    options_.key_frame_interval = 4;
+  }
+
+  // Positions of frame |index|, a static grid and a point moving along x.
+  static std::vector<float> CreateFrame(int index) {
+    std::vector<float> positions;
+    for (int i = 0; i < 100; ++i) {
+      positions.push_back(static_cast<float>(i % 10));
+      positions.push_back(static_cast<float>(i / 10));
+      positions.push_back(0.f);
+    }
+    positions.push_back(0.25f + 0.5f * (index % 16));
+    positions.push_back(4.5f);
+    positions.push_back(0.f);
+    return positions;
+  }
+
+  FrameEncodingPipeline::Sink CreateSink() {
+    return [this](const EncodedFrame &frame) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      sink_released_.wait(lock, [this] { return !sink_blocked_; });
+      frames_.push_back(frame);
+      frame_data_.emplace_back(frame.data, frame.data + frame.size);
+      return OkStatus();
+    };
+  }
+
+  // While blocked, the sink waits before it takes the next frame.
+  void BlockSink(bool blocked) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      sink_blocked_ = blocked;
+    }
+    sink_released_.notify_all();
+  }
+
+  bool SubmitFrame(FrameEncodingPipeline *pipeline, int index) {
+    const std::vector<float> positions = CreateFrame(index);
+    return pipeline->SubmitFrame(positions.data(), positions.size() / 3, 0,
+                                 1000 * index);
+  }
+
+  // Expects consecutive frame indices and decodes all written frames.
+  void ExpectFrames() {
+    PointCloudSequenceDecoder decoder;
+    for (size_t i = 0; i < frames_.size(); ++i) {
+      EXPECT_EQ(frames_[i].frame_index, static_cast<int64_t>(i));
+      if (i > 0) {
+        EXPECT_GT(frames_[i].timestamp_us, frames_[i - 1].timestamp_us);
+      }
+      DecoderBuffer buffer;
+      buffer.Init(frame_data_[i].data(), frame_data_[i].size());
+      EXPECT_EQ(PointCloudSequenceDecoder::IsKeyFrame(buffer),
+                frames_[i].is_key_frame);
+      ASSERT_TRUE(decoder.DecodeFrame(&buffer).ok());
+      const std::vector<float> expected =
+          CreateFrame(static_cast<int>(frames_[i].timestamp_us / 1000));
+      ASSERT_EQ(decoder.num_points(), expected.size() / 3);
+      std::vector<float> decoded(expected.size());
+      decoder.GetPositions(decoded.data(), 0, decoder.num_points());
+      std::vector<float> sorted_decoded = SortPoints(decoded);
+      std::vector<float> sorted_expected = SortPoints(expected);
+      for (size_t j = 0; j < decoded.size(); ++j) {
+        // The frames span about 10 units on a grid of 2^11 steps.
+        EXPECT_NEAR(sorted_decoded[j], sorted_expected[j], 0.01f);
+      }
+    }
+  }
+
+  static std::vector<float> SortPoints(const std::vector<float> &positions) {
+    std::vector<std::vector<float>> points;
+    for (size_t i = 0; i < positions.size(); i += 3) {
+      points.push_back({positions[i], positions[i + 1], positions[i + 2]});
+    }
+    std::sort(points.begin(), points.end());
+    std::vector<float> sorted;
+    for (const std::vector<float> &point : points) {
+      sorted.insert(sorted.end(), point.begin(), point.end());
+    }
+    return sorted;
+  }
+
+  FrameEncodingPipelineOptions options_;
+  std::mutex mutex_;
+  std::condition_variable sink_released_;
+  bool sink_blocked_;
+  // Frames passed to the sink. The data pointers are not valid anymore,
+  // the data is kept in |frame_data_|.
+  std::vector<EncodedFrame> frames_;
+  std::vector<std::vector<char>> frame_data_;
+};
+
+TEST_F(FrameEncodingPipelineTest, TestRoundTrip) {
+  FrameEncodingPipeline pipeline(options_, CreateSink());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(SubmitFrame(&pipeline, i));
+  }
+  ASSERT_TRUE(pipeline.Flush().ok());
+  EXPECT_EQ(frames_.size(), 10u);
+  for (int i = 10; i < 20; ++i) {
+    ASSERT_TRUE(SubmitFrame(&pipeline, i));
+  }
+  ASSERT_TRUE(pipeline.Close().ok());
+  ASSERT_EQ(frames_.size(), 20u);
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(frames_[i].timestamp_us, 1000 * i);
+    EXPECT_EQ(frames_[i].is_key_frame, i % 4 == 0);
+  }
+  ExpectFrames();
+
+  const FrameEncodingPipelineStats stats = pipeline.GetStats();
+  EXPECT_EQ(stats.num_submitted_frames, 20);
+  EXPECT_EQ(stats.num_written_frames, 20);
+  EXPECT_EQ(stats.num_dropped_frames, 0);
+  EXPECT_EQ(stats.num_failed_frames, 0);
+  EXPECT_EQ(stats.queue_depth, 0);
+  EXPECT_EQ(stats.num_frames_in_flight, 0);
+  EXPECT_EQ(stats.encode.count, 20);
+  EXPECT_EQ(stats.write.count, 20);
+
+  // No frames are accepted after closing.
+  EXPECT_FALSE(SubmitFrame(&pipeline, 20));
+  EXPECT_TRUE(pipeline.Close().ok());
+}
+
+TEST_F(FrameEncodingPipelineTest, TestCloseWritesQueuedFrames) {
+  options_.queue_capacity = 16;
+  BlockSink(true);
+  FrameEncodingPipeline pipeline(options_, CreateSink());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(SubmitFrame(&pipeline, i));
+  }
+  BlockSink(false);
+  ASSERT_TRUE(pipeline.Close().ok());
+  EXPECT_EQ(frames_.size(), 10u);
+  ExpectFrames();
+}
+
+TEST_F(FrameEncodingPipelineTest, TestDropNewest) {
+  options_.queue_capacity = 2;
+  options_.queue_policy = FRAME_ENCODING_QUEUE_DROP_NEWEST;
+  BlockSink(true);
+  FrameEncodingPipeline pipeline(options_, CreateSink());
+  std::vector<int> accepted;
+  for (int i = 0; i < 20; ++i) {
+    if (SubmitFrame(&pipeline, i)) {
+      accepted.push_back(i);
+    }
+  }
+  // The sink holds at most a few frames in flight besides the queue.
+  EXPECT_LT(accepted.size(), 20u);
+  EXPECT_EQ(accepted[0], 0);
+  BlockSink(false);
+  ASSERT_TRUE(pipeline.Close().ok());
+  ASSERT_EQ(frames_.size(), accepted.size());
+  for (size_t i = 0; i < accepted.size(); ++i) {
+    EXPECT_EQ(frames_[i].timestamp_us, 1000 * accepted[i]);
+  }
+  ExpectFrames();
+
+  const FrameEncodingPipelineStats stats = pipeline.GetStats();
+  EXPECT_EQ(stats.num_submitted_frames, 20);
+  EXPECT_EQ(stats.num_dropped_frames,
+            static_cast<int64_t>(20 - accepted.size()));
+  EXPECT_LE(stats.max_queue_depth, 2);
+}
+
+TEST_F(FrameEncodingPipelineTest, TestDropOldest) {
+  options_.queue_capacity = 2;
+  options_.queue_policy = FRAME_ENCODING_QUEUE_DROP_OLDEST;
+  BlockSink(true);
+  FrameEncodingPipeline pipeline(options_, CreateSink());
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_TRUE(SubmitFrame(&pipeline, i));
+  }
+  BlockSink(false);
+  ASSERT_TRUE(pipeline.Close().ok());
+  // The newest frames are kept.
+  ASSERT_LT(frames_.size(), 20u);
+  EXPECT_EQ(frames_.back().timestamp_us, 1000 * 19);
+  EXPECT_EQ(frames_[frames_.size() - 2].timestamp_us, 1000 * 18);
+  ExpectFrames();
+
+  const FrameEncodingPipelineStats stats = pipeline.GetStats();
+  EXPECT_EQ(stats.num_submitted_frames, 20);
+  EXPECT_EQ(stats.num_written_frames + stats.num_dropped_frames, 20);
+}
+
+TEST_F(FrameEncodingPipelineTest, TestSinkError) {
+  int num_calls = 0;
+  FrameEncodingPipeline pipeline(options_, [&](const EncodedFrame &frame) {
+    ++num_calls;
+    if (frame.frame_index == 2) {
+      return Status(Status::IO_ERROR, "Sink failed.");
+    }
+    return OkStatus();
+  });
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_TRUE(SubmitFrame(&pipeline, i));
+  }
+  EXPECT_EQ(pipeline.Flush().code(), Status::IO_ERROR);
+  EXPECT_EQ(pipeline.Close().code(), Status::IO_ERROR);
+  // The following frames are still passed to the sink.
+  EXPECT_EQ(num_calls, 5);
+  EXPECT_EQ(pipeline.GetStats().num_written_frames, 4);
+}
+
+TEST_F(FrameEncodingPipelineTest, TestInvalidInput) {
+  FrameEncodingPipeline pipeline(options_, CreateSink());
+  const float position[4] = {0.f, 0.f, 0.f, 0.f};
+  EXPECT_FALSE(pipeline.SubmitFrame(nullptr, 1, 0, 0));
+  EXPECT_FALSE(pipeline.SubmitFrame(position, 1, 8, 0));
+  // A padded stride is accepted.
+  EXPECT_TRUE(pipeline.SubmitFrame(position, 1, 16, 0));
+  ASSERT_TRUE(pipeline.Close().ok());
+  EXPECT_EQ(frames_.size(), 1u);
+}
+
+}  // namespace draco
@@ -0,0 +1,127 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_DEQUANTIZING_POINTS_OUTPUT_ITERATOR_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_DEQUANTIZING_POINTS_OUTPUT_ITERATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "core/quantization_utils.h"
+
+namespace draco {
+
+// Memory layout of float positions written by the decoders. Coordinate c of
+// point i is stored |byte_stride| * i bytes after |components[c]|.
+struct PositionsOutputLayout {
+  // Float triplets that are |byte_stride| bytes apart (0 means tightly
+  // packed), e.g. an array of simd_float3 with a stride of 16 bytes.
+  static PositionsOutputLayout Interleaved(float *positions,
+                                           int64_t byte_stride) {
+    PositionsOutputLayout layout;
+    for (int c = 0; c < 3; ++c) {
+      layout.components[c] = positions + c;
+    }
+    layout.byte_stride = byte_stride == 0 ? 3 * sizeof(float) : byte_stride;
+    return layout;
+  }
+
+  // One tightly packed array per coordinate.
+  static PositionsOutputLayout Planar(float *x, float *y, float *z) {
+    PositionsOutputLayout layout;
+    layout.components[0] = x;
+    layout.components[1] = y;
+    layout.components[2] = z;
+    layout.byte_stride = sizeof(float);
+    return layout;
+  }
+
+  float *components[3];
+  int64_t byte_stride;
+};
+
+// Output iterator that dequantizes integer points on a grid starting at
+// |origin| with a cell size of |range| / |max_quantized_value| and writes
+// them to a PositionsOutputLayout. It can be passed to the kd-tree decoders,
+// e.g. DynamicIntegerPointsKdTreeDecoder::DecodePoints(), which then write
+// the positions while the tree is expanded, in the order of its leaves.
+//
+// Points beyond |capacity| are counted but not written, so the caller can
+// detect a too small output with index() > capacity.
+class DequantizingPointsOutputIterator {
+ public:
+  DequantizingPointsOutputIterator(const PositionsOutputLayout &layout,
+                                   size_t capacity, const float *origin,
+                                   float range, uint32_t max_quantized_value)
+      : layout_(layout), capacity_(capacity), index_(0) {
+    for (int c = 0; c < 3; ++c) {
+      origin_[c] = origin[c];
+    }
+    dequantizer_.Init(range, static_cast<int32_t>(max_quantized_value));
+  }
+
+  DequantizingPointsOutputIterator &operator*() { return *this; }
+  DequantizingPointsOutputIterator &operator++() { return *this; }
+  DequantizingPointsOutputIterator &operator++(int) { return *this; }
+
+  DequantizingPointsOutputIterator &operator=(
+      const std::vector<uint32_t> &point) {
+    Write(point[0], point[1], point[2]);
+    return *this;
+  }
+  DequantizingPointsOutputIterator &operator=(const Point3ui &point) {
+    Write(point[0], point[1], point[2]);
+    return *this;
+  }
+
+  // Writes the point at the current index and advances to the next one.
+  void Write(uint32_t x, uint32_t y, uint32_t z) {
+    if (index_ < capacity_) {
+      const int64_t offset =
+          layout_.byte_stride * static_cast<int64_t>(index_);
+      Store(0, offset, x);
+      Store(1, offset, y);
+      Store(2, offset, z);
+    }
+    ++index_;
+  }
+
+  // Leaves |num_points| points unwritten, e.g. for points written by a copy
+  // of this iterator.
+  void Skip(size_t num_points) { index_ += num_points; }
+
+  // Index of the next written point.
+  size_t index() const { return index_; }
+
+ private:
+  void Store(int c, int64_t offset, uint32_t value) {
+    *reinterpret_cast<float *>(
+        reinterpret_cast<uint8_t *>(layout_.components[c]) + offset) =
+        dequantizer_.DequantizeFloat(static_cast<int32_t>(value)) +
+        origin_[c];
+  }
+
+  PositionsOutputLayout layout_;
+  size_t capacity_;
+  size_t index_;
+  float origin_[3];
+  Dequantizer dequantizer_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_DEQUANTIZING_POINTS_OUTPUT_ITERATOR_H_
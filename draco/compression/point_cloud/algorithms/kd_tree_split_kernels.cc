@@ -0,0 +1,123 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/kd_tree_split_kernels.h"
+
+#include <algorithm>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DRACO_KD_TREE_SPLIT_NEON
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DRACO_KD_TREE_SPLIT_SSE2
+#endif
+
+namespace draco {
+
+void CountPointsBelowSplits3(const uint32_t *const coords[3],
+                             size_t num_points, const uint32_t splits[3],
+                             uint32_t out_counts[3]) {
+  uint32_t counts[3] = {0, 0, 0};
+  size_t i = 0;
+#if defined(DRACO_KD_TREE_SPLIT_NEON)
+  // The comparison masks are all ones (-1) for points below the split, so
+  // subtracting them counts the points in each lane.
+  uint32x4_t split_v[3];
+  uint32x4_t count_v[3];
+  for (int c = 0; c < 3; ++c) {
+    split_v[c] = vdupq_n_u32(splits[c]);
+    count_v[c] = vdupq_n_u32(0);
+  }
+  for (; i + 4 <= num_points; i += 4) {
+    for (int c = 0; c < 3; ++c) {
+      count_v[c] = vsubq_u32(
+          count_v[c], vcltq_u32(vld1q_u32(coords[c] + i), split_v[c]));
+    }
+  }
+  for (int c = 0; c < 3; ++c) {
+    uint32_t lanes[4];
+    vst1q_u32(lanes, count_v[c]);
+    counts[c] = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  }
+#elif defined(DRACO_KD_TREE_SPLIT_SSE2)
+  // SSE2 has no unsigned comparison. Flipping the sign bit of both operands
+  // maps it to the signed one.
+  const __m128i sign_v = _mm_set1_epi32(INT32_MIN);
+  __m128i split_v[3];
+  __m128i count_v[3];
+  for (int c = 0; c < 3; ++c) {
+    split_v[c] = _mm_xor_si128(
+        _mm_set1_epi32(static_cast<int32_t>(splits[c])), sign_v);
+    count_v[c] = _mm_setzero_si128();
+  }
+  for (; i + 4 <= num_points; i += 4) {
+    for (int c = 0; c < 3; ++c) {
+      const __m128i value = _mm_xor_si128(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(coords[c] + i)),
+          sign_v);
+      count_v[c] =
+          _mm_sub_epi32(count_v[c], _mm_cmplt_epi32(value, split_v[c]));
+    }
+  }
+  for (int c = 0; c < 3; ++c) {
+    uint32_t lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), count_v[c]);
+    counts[c] = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  }
+#endif
+  for (; i < num_points; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      counts[c] += coords[c][i] < splits[c];
+    }
+  }
+  std::copy(counts, counts + 3, out_counts);
+}
+
+size_t PartitionPoints3(uint32_t *const coords[3], size_t num_points,
+                        uint32_t axis, uint32_t value, uint32_t *scratch) {
+  const uint32_t *const keys = coords[axis];
+  // Splits of densely populated cells often leave one half empty, in which
+  // case nothing needs to be moved.
+  size_t num_keys_below = 0;
+  for (size_t i = 0; i < num_points; ++i) {
+    num_keys_below += keys[i] < value;
+  }
+  if (num_keys_below == 0 || num_keys_below == num_points) {
+    return num_keys_below;
+  }
+  // The coordinates of the first half are compacted in place, the ones of the
+  // second half go to |scratch|. Every value is written to both places and
+  // only the matching position advances. The key plane is moved last because
+  // all planes are split by its original content.
+  const uint32_t planes[3] = {(axis + 1) % 3, (axis + 2) % 3, axis};
+  for (const uint32_t plane : planes) {
+    uint32_t *const values = coords[plane];
+    size_t below = 0;
+    size_t above = 0;
+    for (size_t i = 0; i < num_points; ++i) {
+      const uint32_t v = values[i];
+      const size_t is_below = keys[i] < value;
+      values[below] = v;
+      scratch[above] = v;
+      below += is_below;
+      above += 1 - is_below;
+    }
+    std::copy(scratch, scratch + above, values + below);
+  }
+  return num_keys_below;
+}
+
+}  // namespace draco
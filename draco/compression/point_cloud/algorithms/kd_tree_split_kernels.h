@@ -0,0 +1,44 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_KD_TREE_SPLIT_KERNELS_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_KD_TREE_SPLIT_KERNELS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace draco {
+
+// Kernels for splitting kd-tree nodes of 3D integer points, used by
+// PlanarPointsKdTreeEncoder. The points are stored in planar layout, i.e.
+// |coords[c][i]| is coordinate c of point i. Counting processes four points
+// per SSE2 or NEON register when available and falls back to scalar code
+// otherwise. The results are identical on all code paths.
+
+// Counts the points whose coordinate along each axis c is less than
+// |splits[c]| in a single pass over the coordinates.
+void CountPointsBelowSplits3(const uint32_t *const coords[3],
+                             size_t num_points, const uint32_t splits[3],
+                             uint32_t out_counts[3]);
+
+// Moves the points whose coordinate along |axis| is less than |value| in
+// front of the other points without branching on the coordinates. The order
+// of the points within both halves is preserved. |scratch| must hold
+// |num_points| values. Returns the number of points in the first half.
+size_t PartitionPoints3(uint32_t *const coords[3], size_t num_points,
+                        uint32_t axis, uint32_t value, uint32_t *scratch);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_KD_TREE_SPLIT_KERNELS_H_
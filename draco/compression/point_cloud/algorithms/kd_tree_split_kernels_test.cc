@@ -0,0 +1,109 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/kd_tree_split_kernels.h"
+
+#include <random>
+#include <vector>
+
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class KdTreeSplitKernelsTest : public ::testing::Test {
+ protected:
+  KdTreeSplitKernelsTest() : rng_(29) {}
+
+  // Fills |planes| with |num_points| random coordinates per axis. The
+  // vectors end right after the last point, so reads past them are caught by
+  // the address sanitizer.
+  void CreatePlanes(size_t num_points, uint32_t max_value,
+                    std::vector<uint32_t> planes[3]) {
+    std::uniform_int_distribution<uint32_t> dist(0, max_value);
+    for (int c = 0; c < 3; ++c) {
+      planes[c].resize(num_points);
+      for (uint32_t &value : planes[c]) {
+        value = dist(rng_);
+      }
+    }
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(KdTreeSplitKernelsTest, TestCountPointsBelowSplits) {
+  // Sizes around the vector width and the largest coordinate values, which
+  // must be compared as unsigned.
+  for (const uint32_t max_value : {15u, 0xffffffffu}) {
+    for (size_t num_points = 0; num_points < 70; ++num_points) {
+      std::vector<uint32_t> planes[3];
+      CreatePlanes(num_points, max_value, planes);
+      const uint32_t *const coords[3] = {planes[0].data(), planes[1].data(),
+                                         planes[2].data()};
+      const uint32_t splits[3] = {max_value / 2, max_value / 3 + 1,
+                                  max_value};
+      uint32_t counts[3];
+      CountPointsBelowSplits3(coords, num_points, splits, counts);
+      for (int c = 0; c < 3; ++c) {
+        uint32_t expected_count = 0;
+        for (const uint32_t value : planes[c]) {
+          expected_count += value < splits[c];
+        }
+        EXPECT_EQ(counts[c], expected_count)
+            << max_value << " " << num_points << " " << c;
+      }
+    }
+  }
+}
+
+TEST_F(KdTreeSplitKernelsTest, TestPartitionPoints) {
+  for (const uint32_t max_value : {15u, 0xffffffffu}) {
+    for (size_t num_points = 0; num_points < 70; ++num_points) {
+      for (uint32_t axis = 0; axis < 3; ++axis) {
+        std::vector<uint32_t> planes[3];
+        CreatePlanes(num_points, max_value, planes);
+        const uint32_t value = max_value / 2 + 1;
+
+        // Stable partition of the points by the coordinate along |axis|.
+        std::vector<uint32_t> expected_planes[3];
+        for (const bool below : {true, false}) {
+          for (size_t i = 0; i < num_points; ++i) {
+            if ((planes[axis][i] < value) == below) {
+              for (int c = 0; c < 3; ++c) {
+                expected_planes[c].push_back(planes[c][i]);
+              }
+            }
+          }
+        }
+        size_t expected_num_below = 0;
+        for (const uint32_t coord : planes[axis]) {
+          expected_num_below += coord < value;
+        }
+
+        uint32_t *const coords[3] = {planes[0].data(), planes[1].data(),
+                                     planes[2].data()};
+        std::vector<uint32_t> scratch(num_points);
+        EXPECT_EQ(
+            PartitionPoints3(coords, num_points, axis, value, scratch.data()),
+            expected_num_below);
+        for (int c = 0; c < 3; ++c) {
+          EXPECT_EQ(planes[c], expected_planes[c])
+              << max_value << " " << num_points << " " << axis << " " << c;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace draco
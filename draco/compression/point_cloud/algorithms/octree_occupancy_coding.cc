@@ -0,0 +1,79 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/octree_occupancy_coding.h"
+
+namespace draco {
+
+void OctreeNeighbors::Descend(const std::vector<uint8_t> &occupancy) {
+  const size_t num_nodes = occupancy.size();
+  first_child_.resize(num_nodes);
+  uint32_t num_children = 0;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    first_child_[i] = num_children;
+    num_children += CountOneBits32(occupancy[i]);
+  }
+  next_neighbors_.resize(6 * static_cast<size_t>(num_children));
+  next_only_child_.resize(num_children);
+  uint32_t *out = next_neighbors_.data();
+  uint8_t *out_only_child = next_only_child_.data();
+  for (size_t i = 0; i < num_nodes; ++i) {
+    const uint32_t node_occupancy = occupancy[i];
+    if (node_occupancy == 0) {
+      continue;
+    }
+    // The occupancy and the first child of the neighbors are loaded once for
+    // all children of the node. Unoccupied neighbors have no children.
+    uint32_t occupancies[6];
+    uint32_t first_children[6];
+    const uint32_t *const node_neighbors = &neighbors_[6 * i];
+    for (int k = 0; k < 6; ++k) {
+      const uint32_t neighbor = node_neighbors[k];
+      occupancies[k] = neighbor == kNoNeighbor ? 0 : occupancy[neighbor];
+      first_children[k] = neighbor == kNoNeighbor ? 0 : first_child_[neighbor];
+    }
+    const uint8_t only_child = (node_occupancy & (node_occupancy - 1)) == 0;
+    for (int octant = 0; octant < 8; ++octant) {
+      if (!((node_occupancy >> octant) & 1)) {
+        continue;
+      }
+      for (int axis = 0; axis < 3; ++axis) {
+        const int axis_bit = 1 << (2 - axis);
+        const int sibling = octant ^ axis_bit;
+        // Upper half: the neighbor below is a sibling, the one above a child
+        // of the neighbor above the parent. Lower half: the other way round.
+        const int outer = 2 * axis + ((octant & axis_bit) ? 1 : 0);
+        const int inner = outer ^ 1;
+        out[outer] = GetChild(occupancies[outer], first_children[outer],
+                              sibling);
+        out[inner] = GetChild(node_occupancy, first_child_[i], sibling);
+      }
+      out += 6;
+      *out_only_child++ = only_child;
+    }
+  }
+  neighbors_.swap(next_neighbors_);
+  only_child_.swap(next_only_child_);
+}
+
+OctreeOccupancyContextTable::OctreeOccupancyContextTable() {
+  for (uint32_t neighbor_mask = 0; neighbor_mask < 64; ++neighbor_mask) {
+    for (int octant = 0; octant < 8; ++octant) {
+      contexts_[neighbor_mask][octant] = static_cast<uint16_t>(
+          GetOctreeOccupancyContext(neighbor_mask, octant, 0));
+    }
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,220 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_CODING_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_CODING_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "compression/bit_coders/adaptive_range_bit_coding_shared.h"
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "core/bit_utils.h"
+
+namespace draco {
+
+// Shared definitions of OctreeOccupancyEncoder and OctreeOccupancyDecoder.
+//
+// Nodes of the octree are identified by Morton codes that interleave the bits
+// of their coordinates as ...x1y1z1x0y0z0, so the children of node m are
+// 8 * m + octant with octant = 4 * x + 2 * y + z. Sorting the nodes of a level
+// by their codes puts the children of each node next to each other, in the
+// order in which they are coded.
+//
+// Each node of a level is coded as follows:
+//   - If the node is eligible for direct coding (see OctreeNeighbors), a bit
+//     tells whether all points of the node share a single position. In that
+//     case the remaining bits of the Morton code of that position and the
+//     number of points follow, and the node has no children.
+//   - Otherwise its occupancy byte, with one bit per child.
+//
+// The bits of an occupancy byte are coded in octant order with an adaptive
+// probability selected by:
+//   - the octant and the number of occupied children before it,
+//   - which of the three face neighbors of the parent that touch the child
+//     are occupied,
+//   - the number of occupied face neighbors of the parent (0 to 6).
+// The neighbors are nodes of the same level as the parent, which the decoder
+// knows before it decodes the level. In dense surface scans the occupancy of
+// the neighbors predicts well which children are occupied. Isolated points
+// are cheaper to code directly than by a chain of nodes with a single child,
+// which is what direct coding is for (like the direct mode of MPEG G-PCC).
+
+constexpr int kOctreeMaxBitLength = 21;
+
+constexpr int kOctreeNumOccupancyContexts = 8 * 8 * 8 * 7;
+
+// Contexts of the number of points of a leaf, which is larger than one when
+// points share a cell of the quantization grid: whether there is more than
+// one point, followed by the contexts of the Elias gamma code of the number
+// of points - 1, i.e. its bit length in unary and its bits below the most
+// significant one.
+constexpr int kOctreeNumCountContexts = 1 + 32 + 32;
+
+// Adaptive probabilities of all contexts, kept across the levels of a tree.
+struct OctreeOccupancyContexts {
+  OctreeOccupancyContexts() { Reset(); }
+
+  void Reset() {
+    std::fill(std::begin(occupancy), std::end(occupancy),
+              kAdaptiveRangeBitProbabilityScale / 2);
+    std::fill(std::begin(count), std::end(count),
+              kAdaptiveRangeBitProbabilityScale / 2);
+    direct = kAdaptiveRangeBitProbabilityScale / 2;
+    std::fill(std::begin(direct_position), std::end(direct_position),
+              kAdaptiveRangeBitProbabilityScale / 2);
+  }
+
+  uint16_t occupancy[kOctreeNumOccupancyContexts];
+  uint16_t count[kOctreeNumCountContexts];
+  // Whether an eligible node is coded directly.
+  uint16_t direct;
+  // Bits of directly coded positions, one context per axis.
+  uint16_t direct_position[3];
+};
+
+// Interleaves the lowest 21 bits of |value| with two zero bits each.
+inline uint64_t SpreadOctreeBits(uint32_t value) {
+  uint64_t x = value & 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffull;
+  x = (x | x << 16) & 0x1f0000ff0000ffull;
+  x = (x | x << 8) & 0x100f00f00f00f00full;
+  x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+  x = (x | x << 2) & 0x1249249249249249ull;
+  return x;
+}
+
+// Inverse of SpreadOctreeBits().
+inline uint32_t CompactOctreeBits(uint64_t x) {
+  x &= 0x1249249249249249ull;
+  x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3ull;
+  x = (x ^ (x >> 4)) & 0x100f00f00f00f00full;
+  x = (x ^ (x >> 8)) & 0x1f0000ff0000ffull;
+  x = (x ^ (x >> 16)) & 0x1f00000000ffffull;
+  x = (x ^ (x >> 32)) & 0x1fffffull;
+  return static_cast<uint32_t>(x);
+}
+
+inline uint64_t GetOctreeMortonCode(const Point3ui &point) {
+  return (SpreadOctreeBits(point[0]) << 2) |
+         (SpreadOctreeBits(point[1]) << 1) | SpreadOctreeBits(point[2]);
+}
+
+inline Point3ui GetOctreePoint(uint64_t code) {
+  return Point3ui(CompactOctreeBits(code >> 2), CompactOctreeBits(code >> 1),
+                  CompactOctreeBits(code));
+}
+
+// Face neighbors of the occupied nodes of an octree level, nodes being
+// indexed in Morton order. The encoder and the decoder move it down the tree
+// level by level. The neighbors of a child are either its siblings or
+// children of the neighbors of its parent, so each level is derived from the
+// previous one in linear time.
+class OctreeNeighbors {
+ public:
+  OctreeNeighbors() { Reset(); }
+
+  // Starts at the root, which has no neighbors.
+  void Reset() {
+    neighbors_.assign(6, kNoNeighbor);
+    only_child_.assign(1, 0);
+  }
+
+  // Returns a mask of the occupied face neighbors of node |i|. Bit 2 * axis
+  // is set for the neighbor below the node along the axis, bit 2 * axis + 1
+  // for the neighbor above it.
+  uint32_t GetMask(size_t i) const {
+    const uint32_t *const neighbors = &neighbors_[6 * i];
+    uint32_t mask = 0;
+    for (int k = 0; k < 6; ++k) {
+      mask |= static_cast<uint32_t>(neighbors[k] != kNoNeighbor) << k;
+    }
+    return mask;
+  }
+
+  // Returns true if node |i| may be coded directly: it is the only child of
+  // its parent and has no occupied neighbors, which is typical for the nodes
+  // of isolated points.
+  bool IsDirectCodingEligible(size_t i, uint32_t neighbor_mask) const {
+    return only_child_[i] && neighbor_mask == 0;
+  }
+
+  // Moves to the next level. |occupancy| holds the occupancy bytes of all
+  // nodes of the current level, 0 for directly coded nodes.
+  void Descend(const std::vector<uint8_t> &occupancy);
+
+ private:
+  static constexpr uint32_t kNoNeighbor = 0xffffffff;
+
+  // Returns the index of child |octant| of a node with |occupancy| whose
+  // first child has index |first_child|, or kNoNeighbor if the child is not
+  // occupied.
+  static uint32_t GetChild(uint32_t occupancy, uint32_t first_child,
+                           int octant) {
+    if (!((occupancy >> octant) & 1)) {
+      return kNoNeighbor;
+    }
+    return first_child + CountOneBits32(occupancy & ((1u << octant) - 1));
+  }
+
+  // Six neighbor indices per node, ordered like the bits of GetMask().
+  std::vector<uint32_t> neighbors_;
+  std::vector<uint8_t> only_child_;
+  std::vector<uint32_t> next_neighbors_;
+  std::vector<uint8_t> next_only_child_;
+  std::vector<uint32_t> first_child_;
+};
+
+// Returns the context of the occupancy bit of child |octant| of a node with
+// the occupied face neighbors in |neighbor_mask|. |num_occupied| children
+// with smaller octants are occupied.
+inline int GetOctreeOccupancyContext(uint32_t neighbor_mask, int octant,
+                                     int num_occupied) {
+  // Face neighbors of the parent that touch the child.
+  uint32_t touching = 0;
+  for (int axis = 0; axis < 3; ++axis) {
+    const int side = (octant >> (2 - axis)) & 1;
+    touching |= ((neighbor_mask >> (2 * axis + side)) & 1) << axis;
+  }
+  const int num_neighbors = CountOneBits32(neighbor_mask);
+  return ((octant * 8 + num_occupied) * 8 + touching) * 7 + num_neighbors;
+}
+
+// Difference between the contexts of an occupancy bit with |num_occupied| + 1
+// and |num_occupied| occupied children before it.
+constexpr int kOctreeOccupiedChildContextStep = 8 * 7;
+
+// GetOctreeOccupancyContext() for all neighbor masks and octants, so that
+// the contexts of a node are looked up instead of computed bit by bit.
+class OctreeOccupancyContextTable {
+ public:
+  OctreeOccupancyContextTable();
+
+  // Returns the contexts of the children of a node with the occupied face
+  // neighbors in |neighbor_mask| when no child with a smaller octant is
+  // occupied, indexed by octant. Each occupied child before an octant adds
+  // kOctreeOccupiedChildContextStep to its context.
+  const uint16_t *GetContexts(uint32_t neighbor_mask) const {
+    return contexts_[neighbor_mask];
+  }
+
+ private:
+  uint16_t contexts_[64][8];
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_CODING_H_
@@ -0,0 +1,220 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/octree_occupancy_decoder.h"
+
+#include "core/varint_decoding.h"
+
+namespace draco {
+
+OctreeOccupancyDecoder::OctreeOccupancyDecoder()
+    : bit_length_(0), num_points_(0), depth_(0), num_direct_points_(0) {}
+
+bool OctreeOccupancyDecoder::DecodePoints(DecoderBuffer *buffer,
+                                          int max_depth,
+                                          int64_t max_num_bytes,
+                                          std::vector<Point3ui> *out_points) {
+  out_points->clear();
+  depth_ = 0;
+  const int64_t start_pos = buffer->decoded_size();
+  uint8_t bit_length;
+  if (!buffer->Decode(&bit_length) || !DecodeVarint(&num_points_, buffer)) {
+    return false;
+  }
+  if (bit_length < 1 || bit_length > kOctreeMaxBitLength) {
+    return false;
+  }
+  bit_length_ = bit_length;
+  if (num_points_ == 0) {
+    depth_ = num_levels();
+    return true;
+  }
+  if (max_depth < 0 || max_depth > num_levels()) {
+    max_depth = num_levels();
+  }
+
+  nodes_.assign(1, 0);
+  counts_.clear();
+  direct_points_.clear();
+  direct_counts_.clear();
+  num_direct_points_ = 0;
+  contexts_.Reset();
+  neighbors_.Reset();
+  for (int level = 0; level < num_levels(); ++level) {
+    // The coded data of a level starts with its size.
+    DecoderBuffer level_buffer = *buffer;
+    uint32_t level_size;
+    if (!DecodeVarint(&level_size, &level_buffer) ||
+        level_size > static_cast<uint64_t>(level_buffer.remaining_size())) {
+      // A missing level is an error only if it was requested without a byte
+      // budget.
+      if (depth_ < max_depth && max_num_bytes < 0) {
+        return false;
+      }
+      break;
+    }
+    const int64_t level_end =
+        level_buffer.decoded_size() + static_cast<int64_t>(level_size);
+    if (depth_ < max_depth &&
+        (max_num_bytes < 0 || level_end - start_pos <= max_num_bytes)) {
+      if (!DecodeLevel(buffer)) {
+        return false;
+      }
+      ++depth_;
+    } else {
+      // The contexts of the following levels depend on this one, so no
+      // further levels can be decoded.
+      max_depth = depth_;
+    }
+    buffer->StartDecodingFrom(level_end);
+  }
+
+  if (is_complete()) {
+    // |num_points_| is not reserved up front: it is read from the input and a
+    // few bytes of counts can claim billions of duplicate points. The output
+    // grows with the points that are actually produced.
+    out_points->reserve(nodes_.size() + direct_points_.size());
+    if (counts_.empty()) {
+      for (const uint64_t code : nodes_) {
+        out_points->push_back(GetOctreePoint(code));
+      }
+    } else {
+      for (size_t i = 0; i < nodes_.size(); ++i) {
+        out_points->insert(out_points->end(), counts_[i],
+                           GetOctreePoint(nodes_[i]));
+      }
+    }
+    for (size_t i = 0; i < direct_points_.size(); ++i) {
+      out_points->insert(out_points->end(), direct_counts_[i],
+                         GetOctreePoint(direct_points_[i]));
+    }
+    return true;
+  }
+  // Bits of each coordinate that are not resolved by the decoded levels.
+  const uint32_t num_remaining_bits = bit_length_ - depth_;
+  const uint32_t center_offset = 1u << (num_remaining_bits - 1);
+  out_points->reserve(nodes_.size() + direct_points_.size());
+  for (const uint64_t code : nodes_) {
+    Point3ui p = GetOctreePoint(code);
+    for (int c = 0; c < 3; ++c) {
+      p[c] = (p[c] << num_remaining_bits) + center_offset;
+    }
+    out_points->push_back(p);
+  }
+  for (const uint64_t code : direct_points_) {
+    out_points->push_back(GetOctreePoint(code));
+  }
+  return true;
+}
+
+bool OctreeOccupancyDecoder::DecodeLevel(DecoderBuffer *buffer) {
+  if (!bit_decoder_.StartDecoding(buffer)) {
+    return false;
+  }
+  next_nodes_.clear();
+  occupancy_.resize(nodes_.size());
+  // Number of bits of the Morton codes below the nodes of this level.
+  const int num_remaining_bits = 3 * (num_levels() - depth_);
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    const uint64_t code = nodes_[i];
+    const uint32_t neighbor_mask = neighbors_.GetMask(i);
+    if (neighbors_.IsDirectCodingEligible(i, neighbor_mask) &&
+        bit_decoder_.DecodeBit(&contexts_.direct)) {
+      direct_points_.push_back(DecodeDirectPoint(code, num_remaining_bits));
+      const uint32_t count = DecodeCount();
+      direct_counts_.push_back(count);
+      num_direct_points_ += count;
+      occupancy_[i] = 0;
+    } else {
+      const uint32_t occupancy = DecodeOccupancy(neighbor_mask);
+      occupancy_[i] = static_cast<uint8_t>(occupancy);
+      for (int octant = 0; octant < 8; ++octant) {
+        if ((occupancy >> octant) & 1) {
+          next_nodes_.push_back((code << 3) | octant);
+        }
+      }
+    }
+    // Each node holds at least one point.
+    if (next_nodes_.size() + num_direct_points_ > num_points_) {
+      return false;
+    }
+  }
+  nodes_.swap(next_nodes_);
+  // The leaves have no children whose neighbors would be needed.
+  if (depth_ + 1 < num_levels()) {
+    neighbors_.Descend(occupancy_);
+  }
+  const uint64_t num_tree_points = num_points_ - num_direct_points_;
+  if (depth_ + 1 == num_levels() && nodes_.size() < num_tree_points) {
+    counts_.resize(nodes_.size());
+    uint64_t total = 0;
+    for (uint32_t &count : counts_) {
+      count = DecodeCount();
+      total += count;
+    }
+    if (total != num_tree_points) {
+      return false;
+    }
+  } else if (depth_ + 1 == num_levels() &&
+             nodes_.size() != num_tree_points) {
+    return false;
+  }
+  bit_decoder_.EndDecoding();
+  return true;
+}
+
+uint32_t OctreeOccupancyDecoder::DecodeOccupancy(uint32_t neighbor_mask) {
+  const uint16_t *const contexts = context_table_.GetContexts(neighbor_mask);
+  uint32_t occupancy = 0;
+  int num_occupied = 0;
+  for (int octant = 0; octant < 8; ++octant) {
+    // Occupied nodes have at least one occupied child.
+    if (octant == 7 && num_occupied == 0) {
+      return occupancy | 0x80;
+    }
+    const bool bit = bit_decoder_.DecodeBit(
+        &contexts_.occupancy[contexts[octant] +
+                             num_occupied * kOctreeOccupiedChildContextStep]);
+    occupancy |= static_cast<uint32_t>(bit) << octant;
+    num_occupied += bit;
+  }
+  return occupancy;
+}
+
+uint64_t OctreeOccupancyDecoder::DecodeDirectPoint(uint64_t code,
+                                                   int num_bits) {
+  // Bit 3 * k + 2 - c of a Morton code belongs to coordinate c.
+  for (int i = num_bits - 1; i >= 0; --i) {
+    code = (code << 1) |
+           bit_decoder_.DecodeBit(&contexts_.direct_position[2 - i % 3]);
+  }
+  return code;
+}
+
+uint32_t OctreeOccupancyDecoder::DecodeCount() {
+  if (!bit_decoder_.DecodeBit(&contexts_.count[0])) {
+    return 1;
+  }
+  int msb = 0;
+  while (msb < 31 && bit_decoder_.DecodeBit(&contexts_.count[1 + msb])) {
+    ++msb;
+  }
+  uint32_t value = 1;
+  for (int i = msb - 1; i >= 0; --i) {
+    value = (value << 1) | bit_decoder_.DecodeBit(&contexts_.count[33 + i]);
+  }
+  return value + 1;
+}
+
+}  // namespace draco
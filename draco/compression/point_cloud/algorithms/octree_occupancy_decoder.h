@@ -0,0 +1,94 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_DECODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_DECODER_H_
+
+#include <vector>
+
+#include "compression/bit_coders/adaptive_range_bit_decoder.h"
+#include "compression/point_cloud/algorithms/octree_occupancy_coding.h"
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "core/decoder_buffer.h"
+
+namespace draco {
+
+// Decodes points encoded by OctreeOccupancyEncoder. Decoding can stop after
+// any level of the octree, either at a given depth or when the next level
+// does not fit into a byte budget. The result is then one point in the
+// center of each occupied node of the last decoded level, and one point at
+// the position of each directly coded node. When all levels are decoded the
+// exact encoded points are returned.
+class OctreeOccupancyDecoder {
+ public:
+  OctreeOccupancyDecoder();
+
+  // Decodes at most |max_depth| levels of the tree (all if negative) and
+  // stores the points in |out_points|. At most |max_num_bytes| bytes of
+  // |buffer| are used (no limit if negative), so |buffer| may hold just a
+  // prefix of the encoded data. Levels that are not decoded are skipped if
+  // they are present in |buffer|.
+  bool DecodePoints(DecoderBuffer *buffer, int max_depth,
+                    int64_t max_num_bytes, std::vector<Point3ui> *out_points);
+
+  // Decodes all levels of the tree.
+  bool DecodePoints(DecoderBuffer *buffer,
+                    std::vector<Point3ui> *out_points) {
+    return DecodePoints(buffer, -1, -1, out_points);
+  }
+
+  uint32_t bit_length() const { return bit_length_; }
+  // Number of encoded points, which is larger than the number of decoded
+  // points unless all levels were decoded.
+  uint32_t num_encoded_points() const { return num_points_; }
+  // Number of levels of the encoded tree.
+  int num_levels() const { return bit_length_; }
+  // Number of decoded levels.
+  int depth() const { return depth_; }
+  bool is_complete() const { return depth_ == num_levels(); }
+
+ private:
+  bool DecodeLevel(DecoderBuffer *buffer);
+  uint32_t DecodeOccupancy(uint32_t neighbor_mask);
+  // Appends the lowest |num_bits| bits of a Morton code to |code|.
+  uint64_t DecodeDirectPoint(uint64_t code, int num_bits);
+  uint32_t DecodeCount();
+
+  uint32_t bit_length_;
+  uint32_t num_points_;
+  int depth_;
+
+  OctreeOccupancyContexts contexts_;
+  const OctreeOccupancyContextTable context_table_;
+  AdaptiveRangeBitDecoder bit_decoder_;
+
+  // Morton codes of the occupied nodes of the last decoded level in
+  // ascending order, excluding the ones coded directly.
+  std::vector<uint64_t> nodes_;
+  std::vector<uint64_t> next_nodes_;
+  // Occupancy bytes of the nodes of the last decoded level.
+  std::vector<uint8_t> occupancy_;
+  OctreeNeighbors neighbors_;
+  // Number of points of each leaf, only used if a leaf holds more than one
+  // point.
+  std::vector<uint32_t> counts_;
+  // Morton codes and number of points of the directly coded nodes.
+  std::vector<uint64_t> direct_points_;
+  std::vector<uint32_t> direct_counts_;
+  uint64_t num_direct_points_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_DECODER_H_
@@ -0,0 +1,156 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/octree_occupancy_encoder.h"
+
+#include <algorithm>
+
+#include "core/bit_utils.h"
+#include "core/varint_encoding.h"
+
+namespace draco {
+
+bool OctreeOccupancyEncoder::EncodePoints(const std::vector<Point3ui> &points,
+                                          uint32_t bit_length,
+                                          EncoderBuffer *buffer) {
+  if (bit_length < 1 || bit_length > kOctreeMaxBitLength) {
+    return false;
+  }
+  const uint32_t max_value = (1u << bit_length) - 1;
+  codes_.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const Point3ui &p = points[i];
+    if (p[0] > max_value || p[1] > max_value || p[2] > max_value) {
+      return false;
+    }
+    codes_[i] = GetOctreeMortonCode(p);
+  }
+  buffer->Encode(static_cast<uint8_t>(bit_length));
+  EncodeVarint(static_cast<uint32_t>(points.size()), buffer);
+  if (points.empty()) {
+    return true;
+  }
+
+  std::sort(codes_.begin(), codes_.end());
+  leaves_.clear();
+  counts_.clear();
+  for (const uint64_t code : codes_) {
+    if (leaves_.empty() || leaves_.back() != code) {
+      leaves_.push_back(code);
+      counts_.push_back(1);
+    } else {
+      ++counts_.back();
+    }
+  }
+
+  contexts_.Reset();
+  neighbors_.Reset();
+  nodes_.assign(1, {0, static_cast<uint32_t>(leaves_.size())});
+  // Number of points of the directly coded nodes.
+  size_t num_direct_points = 0;
+  for (uint32_t depth = 0; depth < bit_length; ++depth) {
+    // Position of the octant of the children in the Morton codes.
+    const uint32_t shift = 3 * (bit_length - depth - 1);
+    occupancy_.assign(nodes_.size(), 0);
+    next_nodes_.clear();
+    bit_encoder_.StartEncoding();
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+      const NodeRange &node = nodes_[i];
+      const uint32_t neighbor_mask = neighbors_.GetMask(i);
+      if (neighbors_.IsDirectCodingEligible(i, neighbor_mask)) {
+        const bool direct = node.end - node.begin == 1;
+        bit_encoder_.EncodeBit(direct, &contexts_.direct);
+        if (direct) {
+          EncodeDirectPoint(leaves_[node.begin], shift + 3);
+          EncodeCount(counts_[node.begin]);
+          num_direct_points += counts_[node.begin];
+          continue;
+        }
+      }
+      // The leaves of each child are adjacent.
+      uint32_t occupancy = 0;
+      for (uint32_t begin = node.begin; begin < node.end;) {
+        const uint32_t octant = (leaves_[begin] >> shift) & 7;
+        uint32_t end = begin + 1;
+        while (end < node.end && ((leaves_[end] >> shift) & 7) == octant) {
+          ++end;
+        }
+        occupancy |= 1u << octant;
+        next_nodes_.push_back({begin, end});
+        begin = end;
+      }
+      occupancy_[i] = static_cast<uint8_t>(occupancy);
+      EncodeOccupancy(occupancy, neighbor_mask);
+    }
+    nodes_.swap(next_nodes_);
+    if (depth + 1 == bit_length &&
+        nodes_.size() + num_direct_points < points.size()) {
+      for (const NodeRange &node : nodes_) {
+        EncodeCount(counts_[node.begin]);
+      }
+    }
+    bit_encoder_.EndEncoding(buffer);
+    // The leaves have no children whose neighbors would be needed.
+    if (depth + 1 < bit_length) {
+      neighbors_.Descend(occupancy_);
+    }
+  }
+  return true;
+}
+
+void OctreeOccupancyEncoder::EncodeOccupancy(uint32_t occupancy,
+                                             uint32_t neighbor_mask) {
+  const uint16_t *const contexts = context_table_.GetContexts(neighbor_mask);
+  int num_occupied = 0;
+  for (int octant = 0; octant < 8; ++octant) {
+    // Occupied nodes have at least one occupied child.
+    if (octant == 7 && num_occupied == 0) {
+      break;
+    }
+    const bool bit = (occupancy >> octant) & 1;
+    bit_encoder_.EncodeBit(
+        bit, &contexts_.occupancy[contexts[octant] +
+                                  num_occupied *
+                                      kOctreeOccupiedChildContextStep]);
+    num_occupied += bit;
+  }
+}
+
+void OctreeOccupancyEncoder::EncodeDirectPoint(uint64_t code, int num_bits) {
+  // Bit 3 * k + 2 - c of a Morton code belongs to coordinate c.
+  for (int i = num_bits - 1; i >= 0; --i) {
+    bit_encoder_.EncodeBit((code >> i) & 1,
+                           &contexts_.direct_position[2 - i % 3]);
+  }
+}
+
+void OctreeOccupancyEncoder::EncodeCount(uint32_t count) {
+  bit_encoder_.EncodeBit(count > 1, &contexts_.count[0]);
+  if (count <= 1) {
+    return;
+  }
+  const uint32_t value = count - 1;
+  const int msb = MostSignificantBit(value);
+  for (int i = 0; i < msb; ++i) {
+    bit_encoder_.EncodeBit(true, &contexts_.count[1 + i]);
+  }
+  if (msb < 31) {
+    bit_encoder_.EncodeBit(false, &contexts_.count[1 + msb]);
+  }
+  for (int i = msb - 1; i >= 0; --i) {
+    bit_encoder_.EncodeBit((value >> i) & 1, &contexts_.count[33 + i]);
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,90 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_ENCODER_H_
+
+#include <vector>
+
+#include "compression/bit_coders/adaptive_range_bit_encoder.h"
+#include "compression/point_cloud/algorithms/octree_occupancy_coding.h"
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "core/encoder_buffer.h"
+
+namespace draco {
+
+// Encodes 3D integer points with an octree that is written level by level
+// (breadth first), like the geometry coding of MPEG G-PCC. Each occupied node
+// is coded as a byte with one bit per child, which is cheaper than coding the
+// number of points of each half as ProgressiveIntegerPointsKdTreeEncoder does
+// when the points lie on surfaces. Any prefix of the levels describes the
+// whole point cloud at a lower resolution. See OctreeOccupancyDecoder.
+//
+// The octree has |bit_length| levels, each halving the nodes along all axes.
+// The leaves are the occupied cells of the integer grid.
+//
+// Bitstream:
+//
+//   uint8   bit length
+//   varint  number of points
+//   For each of the bit length levels (only if there are any points):
+//     AdaptiveRangeBit coded nodes of the level in Morton order, see
+//             octree_occupancy_coding.h. The data of the last level is
+//             followed by the number of points of each leaf if any leaf
+//             that is not coded directly holds more than one point.
+//
+// The context probabilities are kept from one level to the next. The order
+// of the points is not preserved.
+class OctreeOccupancyEncoder {
+ public:
+  OctreeOccupancyEncoder() {}
+
+  // Encodes |points| into |buffer|. |bit_length| gives the number of bits
+  // used by the coordinates and must be in [1, kOctreeMaxBitLength].
+  bool EncodePoints(const std::vector<Point3ui> &points, uint32_t bit_length,
+                    EncoderBuffer *buffer);
+
+ private:
+  void EncodeOccupancy(uint32_t occupancy, uint32_t neighbor_mask);
+  // Encodes the lowest |num_bits| bits of the Morton code |code|.
+  void EncodeDirectPoint(uint64_t code, int num_bits);
+  void EncodeCount(uint32_t count);
+
+  // Leaves [begin, end) of an octree node.
+  struct NodeRange {
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  OctreeOccupancyContexts contexts_;
+  const OctreeOccupancyContextTable context_table_;
+  AdaptiveRangeBitEncoder bit_encoder_;
+
+  // Morton codes of the points, and of the leaves in ascending order with
+  // the number of points of each leaf.
+  std::vector<uint64_t> codes_;
+  std::vector<uint64_t> leaves_;
+  std::vector<uint32_t> counts_;
+  // Occupied nodes of the current level and the next one, excluding the
+  // ones coded directly.
+  std::vector<NodeRange> nodes_;
+  std::vector<NodeRange> next_nodes_;
+  // Occupancy bytes of the nodes of the current level.
+  std::vector<uint8_t> occupancy_;
+  OctreeNeighbors neighbors_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_OCTREE_OCCUPANCY_ENCODER_H_
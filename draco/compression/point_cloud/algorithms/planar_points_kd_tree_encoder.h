@@ -0,0 +1,302 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PLANAR_POINTS_KD_TREE_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PLANAR_POINTS_KD_TREE_ENCODER_H_
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "compression/bit_coders/direct_bit_word_encoder.h"
+#include "compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_encoder.h"
+#include "compression/point_cloud/algorithms/kd_tree_split_kernels.h"
+#include "core/aligned_buffer.h"
+#include "core/bit_utils.h"
+#include "core/encoder_buffer.h"
+#include "core/math_utils.h"
+
+namespace draco {
+
+// Bit encoder used by PlanarPointsKdTreeEncoder in place of |BitEncoderT|
+// of the library policy. Both write the same data.
+template <class BitEncoderT>
+struct PlanarPointsKdTreeBitEncoder {
+  typedef BitEncoderT Type;
+};
+
+template <>
+struct PlanarPointsKdTreeBitEncoder<DirectBitEncoder> {
+  typedef DirectBitWordEncoder Type;
+};
+
+// Encodes 3D integer points into the bitstream of
+// DynamicIntegerPointsKdTreeEncoder<compression_level_t> with a dimension of
+// 3, so the points are decoded by DynamicIntegerPointsKdTreeDecoder. The
+// points are copied once into one array per coordinate. At compression level
+// 6, nodes of 64 or more points count the points below the split of all three
+// axes in a single pass, and nodes are split by a branchless stable
+// partition, see kd_tree_split_kernels.h. The node stack is a reserved
+// vector instead of a std::stack. Uncompressed bits are written by
+// DirectBitWordEncoder.
+//
+// The axis choices and the numbers of points of each half are the same as in
+// DynamicIntegerPointsKdTreeEncoder. Only the order of the points in the
+// leaves may differ, so the encoded bytes can differ too. The library
+// encoder is compiled into the prebuilt libdraco, so its template bodies
+// can't change from this tree.
+template <int compression_level_t>
+class PlanarPointsKdTreeEncoder {
+  static_assert(compression_level_t >= 0, "Compression level must in [0..6].");
+  static_assert(compression_level_t <= 6, "Compression level must in [0..6].");
+  typedef DynamicIntegerPointsKdTreeEncoderCompressionPolicy<
+      compression_level_t>
+      Policy;
+  typedef typename PlanarPointsKdTreeBitEncoder<
+      typename Policy::NumbersEncoder>::Type NumbersEncoder;
+  typedef typename PlanarPointsKdTreeBitEncoder<
+      typename Policy::AxisEncoder>::Type AxisEncoder;
+  typedef typename PlanarPointsKdTreeBitEncoder<
+      typename Policy::HalfEncoder>::Type HalfEncoder;
+  typedef typename PlanarPointsKdTreeBitEncoder<
+      typename Policy::RemainingBitsEncoder>::Type RemainingBitsEncoder;
+  typedef std::array<uint32_t, 3> Array3ui;
+
+ public:
+  PlanarPointsKdTreeEncoder()
+      : bit_length_(0), base_stack_(32 * 3 + 1), levels_stack_(32 * 3 + 1) {}
+
+  // Encodes the 3D integer points given by [begin,end) into buffer.
+  // |bit_length| gives the highest bit used for all coordinates. The points
+  // in [begin,end) are not reordered.
+  template <class RandomAccessIteratorT>
+  bool EncodePoints(RandomAccessIteratorT begin, RandomAccessIteratorT end,
+                    uint32_t bit_length, EncoderBuffer *buffer);
+
+ private:
+  // Nodes are ranges of point indices into the planar storage.
+  struct EncodingStatus {
+    uint32_t begin;
+    uint32_t end;
+    uint32_t last_axis;
+    uint32_t stack_pos;  // used to get base and levels
+  };
+
+  void EncodeInternal(uint32_t num_points);
+  // Same axis selection as DynamicIntegerPointsKdTreeEncoder, with the
+  // points below the split of all three axes counted in a single pass.
+  uint32_t GetAndEncodeAxis(const uint32_t *const coords[3],
+                            uint32_t num_points, const Array3ui &old_base,
+                            const Array3ui &levels, uint32_t last_axis);
+
+  uint32_t bit_length_;
+  NumbersEncoder numbers_encoder_;
+  RemainingBitsEncoder remaining_bits_encoder_;
+  AxisEncoder axis_encoder_;
+  HalfEncoder half_encoder_;
+  // Coordinate planes of the points followed by scratch space of the same
+  // size for the partitions, all uint32_t. The planes are overwritten for
+  // each call and the scratch space by each partition, so the storage is
+  // never zero-filled.
+  AlignedBuffer storage_;
+  std::vector<Array3ui> base_stack_;
+  std::vector<Array3ui> levels_stack_;
+  std::vector<EncodingStatus> status_stack_;
+};
+
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+bool PlanarPointsKdTreeEncoder<compression_level_t>::EncodePoints(
+    RandomAccessIteratorT begin, RandomAccessIteratorT end,
+    uint32_t bit_length, EncoderBuffer *buffer) {
+  bit_length_ = bit_length;
+  const uint32_t num_points = static_cast<uint32_t>(end - begin);
+
+  buffer->Encode(bit_length_);
+  buffer->Encode(num_points);
+  if (num_points == 0) {
+    return true;
+  }
+
+  storage_.ResizeUninitialized(4 * static_cast<size_t>(num_points) *
+                               sizeof(uint32_t));
+  uint32_t *const planes = reinterpret_cast<uint32_t *>(storage_.data());
+  for (uint32_t i = 0; i < num_points; ++i) {
+    const auto &p = *(begin + i);
+    for (int c = 0; c < 3; ++c) {
+      planes[c * static_cast<size_t>(num_points) + i] = p[c];
+    }
+  }
+
+  numbers_encoder_.StartEncoding();
+  remaining_bits_encoder_.StartEncoding();
+  axis_encoder_.StartEncoding();
+  half_encoder_.StartEncoding();
+
+  EncodeInternal(num_points);
+
+  numbers_encoder_.EndEncoding(buffer);
+  remaining_bits_encoder_.EndEncoding(buffer);
+  axis_encoder_.EndEncoding(buffer);
+  half_encoder_.EndEncoding(buffer);
+
+  return true;
+}
+
+template <int compression_level_t>
+uint32_t PlanarPointsKdTreeEncoder<compression_level_t>::GetAndEncodeAxis(
+    const uint32_t *const coords[3], uint32_t num_points,
+    const Array3ui &old_base, const Array3ui &levels, uint32_t last_axis) {
+  if (!Policy::select_axis) {
+    return DRACO_INCREMENT_MOD(last_axis, 3);
+  }
+
+  uint32_t best_axis = 0;
+  if (num_points < 64) {
+    for (uint32_t axis = 1; axis < 3; ++axis) {
+      if (levels[best_axis] > levels[axis]) {
+        best_axis = axis;
+      }
+    }
+    return best_axis;
+  }
+
+  uint32_t splits[3] = {0, 0, 0};
+  for (uint32_t i = 0; i < 3; ++i) {
+    const uint32_t num_remaining_bits = bit_length_ - levels[i];
+    if (num_remaining_bits > 0) {
+      splits[i] = old_base[i] + (1 << (num_remaining_bits - 1));
+    }
+  }
+  uint32_t counts[3];
+  CountPointsBelowSplits3(coords, num_points, splits, counts);
+  uint32_t max_value = 0;
+  for (uint32_t i = 0; i < 3; ++i) {
+    // If axis can be subdivided.
+    if (bit_length_ - levels[i] > 0) {
+      const uint32_t deviation = std::max(num_points - counts[i], counts[i]);
+      // Check if this is the better axis.
+      if (max_value < deviation) {
+        max_value = deviation;
+        best_axis = i;
+      }
+    }
+  }
+  axis_encoder_.EncodeLeastSignificantBits32(4, best_axis);
+  return best_axis;
+}
+
+template <int compression_level_t>
+void PlanarPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
+    uint32_t num_points) {
+  uint32_t *const planes = reinterpret_cast<uint32_t *>(storage_.data());
+  uint32_t *const coords[3] = {planes, planes + num_points,
+                               planes + 2 * num_points};
+  uint32_t *const scratch = planes + 3 * num_points;
+
+  base_stack_[0] = Array3ui{0, 0, 0};
+  levels_stack_[0] = Array3ui{0, 0, 0};
+  // The depth of the tree is bounded by the number of coordinate bits.
+  status_stack_.clear();
+  status_stack_.reserve(32 * 3 + 1);
+  status_stack_.push_back({0, num_points, 0, 0});
+
+  while (!status_stack_.empty()) {
+    const EncodingStatus status = status_stack_.back();
+    status_stack_.pop_back();
+
+    const uint32_t node_begin = status.begin;
+    const uint32_t node_end = status.end;
+    const uint32_t stack_pos = status.stack_pos;
+    const Array3ui &old_base = base_stack_[stack_pos];
+    const Array3ui &levels = levels_stack_[stack_pos];
+    const uint32_t num_remaining_points = node_end - node_begin;
+    uint32_t *const node_coords[3] = {coords[0] + node_begin,
+                                      coords[1] + node_begin,
+                                      coords[2] + node_begin};
+
+    const uint32_t axis =
+        GetAndEncodeAxis(node_coords, num_remaining_points, old_base, levels,
+                         status.last_axis);
+    const uint32_t level = levels[axis];
+
+    // If this happens all axis are subdivided to the end.
+    if ((bit_length_ - level) == 0) {
+      continue;
+    }
+
+    // Fast encoding of remaining bits if number of points is 1 or 2.
+    if (num_remaining_points <= 2) {
+      uint32_t axes[3];
+      axes[0] = axis;
+      for (uint32_t i = 1; i < 3; i++) {
+        axes[i] = DRACO_INCREMENT_MOD(axes[i - 1], 3);
+      }
+      for (uint32_t i = 0; i < num_remaining_points; ++i) {
+        for (uint32_t j = 0; j < 3; j++) {
+          const uint32_t num_remaining_bits = bit_length_ - levels[axes[j]];
+          if (num_remaining_bits) {
+            remaining_bits_encoder_.EncodeLeastSignificantBits32(
+                num_remaining_bits, node_coords[axes[j]][i]);
+          }
+        }
+      }
+      continue;
+    }
+
+    const uint32_t num_remaining_bits = bit_length_ - level;
+    const uint32_t modifier = 1 << (num_remaining_bits - 1);
+    base_stack_[stack_pos + 1] = old_base;  // copy
+    base_stack_[stack_pos + 1][axis] += modifier;
+    const Array3ui &new_base = base_stack_[stack_pos + 1];
+
+    const uint32_t split =
+        node_begin +
+        static_cast<uint32_t>(PartitionPoints3(node_coords,
+                                               num_remaining_points, axis,
+                                               new_base[axis], scratch));
+
+    // Encode number of points in first and second half.
+    const int required_bits = MostSignificantBit(num_remaining_points);
+
+    const uint32_t first_half = split - node_begin;
+    const uint32_t second_half = node_end - split;
+    const bool left = first_half < second_half;
+
+    if (first_half != second_half) {
+      half_encoder_.EncodeBit(left);
+    }
+
+    if (left) {
+      numbers_encoder_.EncodeLeastSignificantBits32(
+          required_bits, num_remaining_points / 2 - first_half);
+    } else {
+      numbers_encoder_.EncodeLeastSignificantBits32(
+          required_bits, num_remaining_points / 2 - second_half);
+    }
+
+    levels_stack_[stack_pos][axis] += 1;
+    levels_stack_[stack_pos + 1] = levels_stack_[stack_pos];  // copy
+    if (split != node_begin) {
+      status_stack_.push_back({node_begin, split, axis, stack_pos});
+    }
+    if (split != node_end) {
+      status_stack_.push_back({split, node_end, axis, stack_pos + 1});
+    }
+  }
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PLANAR_POINTS_KD_TREE_ENCODER_H_
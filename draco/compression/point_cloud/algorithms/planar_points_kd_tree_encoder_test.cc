@@ -0,0 +1,152 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/planar_points_kd_tree_encoder.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_decoder.h"
+#include "compression/point_cloud/algorithms/points_kd_tree_decoder_3.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class PlanarPointsKdTreeEncoderTest : public ::testing::Test {
+ protected:
+  PlanarPointsKdTreeEncoderTest() : rng_(23) {}
+
+  // Output iterator that appends the points of both decoders to a vector of
+  // Point3ui.
+  class PointsBackInserter {
+   public:
+    explicit PointsBackInserter(std::vector<Point3ui> *points)
+        : points_(points) {}
+
+    PointsBackInserter &operator*() { return *this; }
+    PointsBackInserter &operator++() { return *this; }
+
+    PointsBackInserter &operator=(const Point3ui &point) {
+      points_->push_back(point);
+      return *this;
+    }
+    PointsBackInserter &operator=(const std::vector<uint32_t> &point) {
+      points_->push_back(Point3ui(point[0], point[1], point[2]));
+      return *this;
+    }
+
+   private:
+    std::vector<Point3ui> *points_;
+  };
+
+  // Returns |num_points| random points of |bit_length| bits in clusters, so
+  // that nodes of all sizes and some duplicate points are coded.
+  std::vector<Point3ui> CreatePoints(size_t num_points, uint32_t bit_length) {
+    const uint32_t max_value =
+        bit_length == 32 ? 0xffffffff : (1u << bit_length) - 1;
+    std::uniform_int_distribution<uint32_t> dist(0, max_value);
+    std::uniform_int_distribution<uint32_t> offset_dist(0, 3);
+    std::vector<Point3ui> points(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+      for (int c = 0; c < 3; ++c) {
+        if (i % 4 == 0) {
+          points[i][c] = dist(rng_);
+        } else {
+          points[i][c] =
+              std::min(points[i - i % 4][c] + offset_dist(rng_), max_value);
+        }
+      }
+    }
+    return points;
+  }
+
+  // Decodes |data| with DynamicIntegerPointsKdTreeDecoder and with
+  // PointsKdTreeDecoder3 and expects both to return |points| in any order,
+  // consuming all of the data.
+  template <int compression_level_t>
+  static void ExpectDecodedPoints(const std::string &data,
+                                  const std::vector<Point3ui> &points) {
+    std::vector<Point3ui> expected_points = points;
+    std::sort(expected_points.begin(), expected_points.end());
+
+    std::vector<Point3ui> library_points;
+    DecoderBuffer library_buffer;
+    library_buffer.Init(data.data(), data.size());
+    DynamicIntegerPointsKdTreeDecoder<compression_level_t> library_decoder(3);
+    PointsBackInserter library_oit(&library_points);
+    ASSERT_TRUE(library_decoder.DecodePoints(&library_buffer, library_oit));
+    EXPECT_EQ(library_buffer.remaining_size(), 0);
+    std::sort(library_points.begin(), library_points.end());
+    EXPECT_EQ(library_points, expected_points);
+
+    std::vector<Point3ui> decoded_points;
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    PointsKdTreeDecoder3<compression_level_t> decoder;
+    PointsBackInserter oit(&decoded_points);
+    ASSERT_TRUE(decoder.DecodePoints(&buffer, oit));
+    EXPECT_EQ(buffer.remaining_size(), 0);
+    std::sort(decoded_points.begin(), decoded_points.end());
+    EXPECT_EQ(decoded_points, expected_points);
+  }
+
+  template <int compression_level_t>
+  void TestLevel() {
+    // One encoder for all point sets, so that its storage is reused for
+    // growing and shrinking sets.
+    PlanarPointsKdTreeEncoder<compression_level_t> encoder;
+    for (const uint32_t bit_length : {1, 5, 11, 20, 32}) {
+      for (const size_t num_points : {0, 1, 2, 3, 63, 64, 65, 1000, 5000, 7}) {
+        const std::vector<Point3ui> points =
+            CreatePoints(num_points, bit_length);
+        EncoderBuffer buffer;
+        ASSERT_TRUE(encoder.EncodePoints(points.begin(), points.end(),
+                                         bit_length, &buffer));
+        SCOPED_TRACE(std::to_string(bit_length) + " " +
+                     std::to_string(num_points));
+        ExpectDecodedPoints<compression_level_t>(
+            std::string(buffer.data(), buffer.size()), points);
+      }
+    }
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(PlanarPointsKdTreeEncoderTest, TestLevel0) { TestLevel<0>(); }
+TEST_F(PlanarPointsKdTreeEncoderTest, TestLevel2) { TestLevel<2>(); }
+TEST_F(PlanarPointsKdTreeEncoderTest, TestLevel4) { TestLevel<4>(); }
+TEST_F(PlanarPointsKdTreeEncoderTest, TestLevel6) { TestLevel<6>(); }
+
+TEST_F(PlanarPointsKdTreeEncoderTest, TestInputNotReordered) {
+  const std::vector<Point3ui> points = CreatePoints(500, 16);
+  std::vector<Point3ui> input = points;
+  PlanarPointsKdTreeEncoder<6> encoder;
+  EncoderBuffer buffer;
+  ASSERT_TRUE(encoder.EncodePoints(input.begin(), input.end(), 16, &buffer));
+  EXPECT_EQ(input, points);
+}
+
+TEST_F(PlanarPointsKdTreeEncoderTest, TestIdenticalPoints) {
+  // A single point repeated, which can't be split on any axis.
+  const std::vector<Point3ui> points(300, Point3ui(7, 1000, 3));
+  PlanarPointsKdTreeEncoder<6> encoder;
+  EncoderBuffer buffer;
+  ASSERT_TRUE(encoder.EncodePoints(points.begin(), points.end(), 10, &buffer));
+  ExpectDecodedPoints<6>(std::string(buffer.data(), buffer.size()), points);
+}
+
+}  // namespace draco
@@ -0,0 +1,298 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_POINTS_KD_TREE_DECODER_3_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_POINTS_KD_TREE_DECODER_3_H_
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "compression/bit_coders/direct_bit_word_decoder.h"
+#include "compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_decoder.h"
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "core/bit_utils.h"
+#include "core/decoder_buffer.h"
+#include "core/math_utils.h"
+
+namespace draco {
+
+// Bit decoder used by PointsKdTreeDecoder3 in place of |BitDecoderT| of the
+// library policy. Both read the same data.
+template <class BitDecoderT>
+struct PointsKdTreeDecoder3BitDecoder {
+  typedef BitDecoderT Type;
+};
+
+template <>
+struct PointsKdTreeDecoder3BitDecoder<DirectBitDecoder> {
+  typedef DirectBitWordDecoder Type;
+};
+
+// Decodes 3D integer points encoded by
+// DynamicIntegerPointsKdTreeEncoder<compression_level_t> with a dimension of
+// 3 or by PlanarPointsKdTreeEncoder. Produces the same points in the same
+// order as DynamicIntegerPointsKdTreeDecoder, and fails on the same invalid
+// data. Uncompressed bits are read by DirectBitWordDecoder, the points are
+// Point3ui instead of std::vector and the node stack is a reserved vector
+// instead of a std::stack.
+//
+// The library decoder is compiled into the prebuilt libdraco, so its
+// template bodies can't change from this tree.
+template <int compression_level_t>
+class PointsKdTreeDecoder3 {
+  static_assert(compression_level_t >= 0, "Compression level must in [0..6].");
+  static_assert(compression_level_t <= 6, "Compression level must in [0..6].");
+  typedef DynamicIntegerPointsKdTreeDecoderCompressionPolicy<
+      compression_level_t>
+      Policy;
+  typedef typename PointsKdTreeDecoder3BitDecoder<
+      typename Policy::NumbersDecoder>::Type NumbersDecoder;
+  typedef typename PointsKdTreeDecoder3BitDecoder<
+      typename Policy::AxisDecoder>::Type AxisDecoder;
+  typedef typename PointsKdTreeDecoder3BitDecoder<
+      typename Policy::HalfDecoder>::Type HalfDecoder;
+  typedef typename PointsKdTreeDecoder3BitDecoder<
+      typename Policy::RemainingBitsDecoder>::Type RemainingBitsDecoder;
+
+ public:
+  PointsKdTreeDecoder3()
+      : bit_length_(0),
+        num_points_(0),
+        num_decoded_points_(0),
+        base_stack_(32 * 3 + 1),
+        levels_stack_(32 * 3 + 1) {}
+
+  // Decodes an integer point cloud from |buffer|. The points are written to
+  // |oit| as Point3ui. Optional |oit_max_points| can be used to tell the
+  // decoder the maximum number of points accepted by the iterator.
+  template <class OutputIteratorT>
+  bool DecodePoints(DecoderBuffer *buffer, OutputIteratorT &oit,
+                    uint32_t oit_max_points);
+
+  template <class OutputIteratorT>
+  bool DecodePoints(DecoderBuffer *buffer, OutputIteratorT &oit) {
+    return DecodePoints(buffer, oit, std::numeric_limits<uint32_t>::max());
+  }
+
+  // Returns the number of decoded points. Must be called after DecodePoints().
+  uint32_t num_decoded_points() const { return num_decoded_points_; }
+
+ private:
+  struct DecodingStatus {
+    uint32_t num_remaining_points;
+    uint32_t last_axis;
+    uint32_t stack_pos;  // used to get base and levels
+  };
+
+  uint32_t GetAxis(uint32_t num_remaining_points, const Point3ui &levels,
+                   uint32_t last_axis);
+
+  template <class OutputIteratorT>
+  bool DecodeInternal(uint32_t num_points, OutputIteratorT &oit);
+
+  uint32_t bit_length_;
+  uint32_t num_points_;
+  uint32_t num_decoded_points_;
+  NumbersDecoder numbers_decoder_;
+  RemainingBitsDecoder remaining_bits_decoder_;
+  AxisDecoder axis_decoder_;
+  HalfDecoder half_decoder_;
+  std::vector<Point3ui> base_stack_;
+  std::vector<Point3ui> levels_stack_;
+  std::vector<DecodingStatus> status_stack_;
+};
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool PointsKdTreeDecoder3<compression_level_t>::DecodePoints(
+    DecoderBuffer *buffer, OutputIteratorT &oit, uint32_t oit_max_points) {
+  if (!buffer->Decode(&bit_length_)) {
+    return false;
+  }
+  if (bit_length_ > 32) {
+    return false;
+  }
+  if (!buffer->Decode(&num_points_)) {
+    return false;
+  }
+  if (num_points_ == 0) {
+    return true;
+  }
+  if (num_points_ > oit_max_points) {
+    return false;
+  }
+  num_decoded_points_ = 0;
+
+  if (!numbers_decoder_.StartDecoding(buffer)) {
+    return false;
+  }
+  if (!remaining_bits_decoder_.StartDecoding(buffer)) {
+    return false;
+  }
+  if (!axis_decoder_.StartDecoding(buffer)) {
+    return false;
+  }
+  if (!half_decoder_.StartDecoding(buffer)) {
+    return false;
+  }
+
+  if (!DecodeInternal(num_points_, oit)) {
+    return false;
+  }
+
+  numbers_decoder_.EndDecoding();
+  remaining_bits_decoder_.EndDecoding();
+  axis_decoder_.EndDecoding();
+  half_decoder_.EndDecoding();
+
+  return true;
+}
+
+template <int compression_level_t>
+uint32_t PointsKdTreeDecoder3<compression_level_t>::GetAxis(
+    uint32_t num_remaining_points, const Point3ui &levels,
+    uint32_t last_axis) {
+  if (!Policy::select_axis) {
+    return DRACO_INCREMENT_MOD(last_axis, 3);
+  }
+
+  uint32_t best_axis = 0;
+  if (num_remaining_points < 64) {
+    for (uint32_t axis = 1; axis < 3; ++axis) {
+      if (levels[best_axis] > levels[axis]) {
+        best_axis = axis;
+      }
+    }
+  } else {
+    axis_decoder_.DecodeLeastSignificantBits32(4, &best_axis);
+  }
+
+  return best_axis;
+}
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool PointsKdTreeDecoder3<compression_level_t>::DecodeInternal(
+    uint32_t num_points, OutputIteratorT &oit) {
+  base_stack_[0] = Point3ui(0, 0, 0);
+  levels_stack_[0] = Point3ui(0, 0, 0);
+  // The depth of the tree is bounded by the number of coordinate bits.
+  status_stack_.clear();
+  status_stack_.reserve(32 * 3 + 1);
+  status_stack_.push_back({num_points, 0, 0});
+
+  while (!status_stack_.empty()) {
+    const DecodingStatus status = status_stack_.back();
+    status_stack_.pop_back();
+
+    const uint32_t num_remaining_points = status.num_remaining_points;
+    const uint32_t stack_pos = status.stack_pos;
+    const Point3ui &old_base = base_stack_[stack_pos];
+    const Point3ui &levels = levels_stack_[stack_pos];
+
+    if (num_remaining_points > num_points) {
+      return false;
+    }
+
+    const uint32_t axis =
+        GetAxis(num_remaining_points, levels, status.last_axis);
+    if (axis >= 3) {
+      return false;
+    }
+
+    const uint32_t level = levels[axis];
+
+    // All axes have been fully subdivided, just output points.
+    if ((bit_length_ - level) == 0) {
+      for (uint32_t i = 0; i < num_remaining_points; i++) {
+        *oit = old_base;
+        ++oit;
+        ++num_decoded_points_;
+      }
+      continue;
+    }
+
+    DRACO_DCHECK_EQ(true, num_remaining_points != 0);
+
+    // Fast decoding of remaining bits if number of points is 1 or 2.
+    if (num_remaining_points <= 2) {
+      uint32_t axes[3];
+      axes[0] = axis;
+      for (uint32_t i = 1; i < 3; i++) {
+        axes[i] = DRACO_INCREMENT_MOD(axes[i - 1], 3);
+      }
+      for (uint32_t i = 0; i < num_remaining_points; ++i) {
+        Point3ui p;
+        for (uint32_t j = 0; j < 3; j++) {
+          uint32_t value = 0;
+          const uint32_t num_remaining_bits = bit_length_ - levels[axes[j]];
+          if (num_remaining_bits) {
+            if (!remaining_bits_decoder_.DecodeLeastSignificantBits32(
+                    num_remaining_bits, &value)) {
+              return false;
+            }
+          }
+          p[axes[j]] = old_base[axes[j]] | value;
+        }
+        *oit = p;
+        ++oit;
+        ++num_decoded_points_;
+      }
+      continue;
+    }
+
+    if (num_decoded_points_ > num_points_) {
+      return false;
+    }
+
+    const int num_remaining_bits = bit_length_ - level;
+    const uint32_t modifier = 1 << (num_remaining_bits - 1);
+    base_stack_[stack_pos + 1] = old_base;         // copy
+    base_stack_[stack_pos + 1][axis] += modifier;  // new base
+
+    const int incoming_bits = MostSignificantBit(num_remaining_points);
+
+    uint32_t number = 0;
+    numbers_decoder_.DecodeLeastSignificantBits32(incoming_bits, &number);
+
+    uint32_t first_half = num_remaining_points / 2;
+    if (first_half < number) {
+      // Invalid |number|.
+      return false;
+    }
+    first_half -= number;
+    uint32_t second_half = num_remaining_points - first_half;
+
+    if (first_half != second_half) {
+      if (!half_decoder_.DecodeNextBit()) {
+        std::swap(first_half, second_half);
+      }
+    }
+
+    levels_stack_[stack_pos][axis] += 1;
+    levels_stack_[stack_pos + 1] = levels_stack_[stack_pos];  // copy
+    if (first_half) {
+      status_stack_.push_back({first_half, axis, stack_pos});
+    }
+    if (second_half) {
+      status_stack_.push_back({second_half, axis, stack_pos + 1});
+    }
+  }
+  return true;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_POINTS_KD_TREE_DECODER_3_H_
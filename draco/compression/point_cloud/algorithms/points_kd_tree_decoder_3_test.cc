@@ -0,0 +1,164 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/points_kd_tree_decoder_3.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_encoder.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class PointsKdTreeDecoder3Test : public ::testing::Test {
+ protected:
+  PointsKdTreeDecoder3Test() : rng_(17) {}
+
+  // Output iterator that appends the points of both decoders to a vector of
+  // Point3ui.
+  class PointsBackInserter {
+   public:
+    explicit PointsBackInserter(std::vector<Point3ui> *points)
+        : points_(points) {}
+
+    PointsBackInserter &operator*() { return *this; }
+    PointsBackInserter &operator++() { return *this; }
+
+    PointsBackInserter &operator=(const Point3ui &point) {
+      points_->push_back(point);
+      return *this;
+    }
+    PointsBackInserter &operator=(const std::vector<uint32_t> &point) {
+      points_->push_back(Point3ui(point[0], point[1], point[2]));
+      return *this;
+    }
+
+   private:
+    std::vector<Point3ui> *points_;
+  };
+
+  // Returns |num_points| random points of |bit_length| bits in clusters, so
+  // that nodes of all sizes and some duplicate points are coded.
+  std::vector<Point3ui> CreatePoints(size_t num_points, uint32_t bit_length) {
+    const uint32_t max_value =
+        bit_length == 32 ? 0xffffffff : (1u << bit_length) - 1;
+    std::uniform_int_distribution<uint32_t> dist(0, max_value);
+    std::uniform_int_distribution<uint32_t> offset_dist(0, 3);
+    std::vector<Point3ui> points(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+      for (int c = 0; c < 3; ++c) {
+        if (i % 4 == 0) {
+          points[i][c] = dist(rng_);
+        } else {
+          points[i][c] =
+              std::min(points[i - i % 4][c] + offset_dist(rng_), max_value);
+        }
+      }
+    }
+    return points;
+  }
+
+  template <int compression_level_t>
+  static std::string EncodePoints(std::vector<Point3ui> points,
+                                  uint32_t bit_length) {
+    DynamicIntegerPointsKdTreeEncoder<compression_level_t> encoder(3);
+    EncoderBuffer buffer;
+    EXPECT_TRUE(
+        encoder.EncodePoints(points.begin(), points.end(), bit_length, &buffer));
+    return std::string(buffer.data(), buffer.size());
+  }
+
+  // Decodes |data| with PointsKdTreeDecoder3 and expects the same result as
+  // from DynamicIntegerPointsKdTreeDecoder. Returns the decoded points.
+  template <int compression_level_t>
+  static std::vector<Point3ui> DecodeAndCompare(const std::string &data) {
+    std::vector<Point3ui> expected_points;
+    DecoderBuffer expected_buffer;
+    expected_buffer.Init(data.data(), data.size());
+    DynamicIntegerPointsKdTreeDecoder<compression_level_t> expected_decoder(3);
+    PointsBackInserter expected_oit(&expected_points);
+    const bool expected_result =
+        expected_decoder.DecodePoints(&expected_buffer, expected_oit);
+
+    std::vector<Point3ui> points;
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    PointsKdTreeDecoder3<compression_level_t> decoder;
+    PointsBackInserter oit(&points);
+    EXPECT_EQ(decoder.DecodePoints(&buffer, oit), expected_result);
+    EXPECT_EQ(points, expected_points);
+    if (expected_result) {
+      EXPECT_EQ(decoder.num_decoded_points(),
+                expected_decoder.num_decoded_points());
+      EXPECT_EQ(buffer.decoded_size(), expected_buffer.decoded_size());
+    }
+    return points;
+  }
+
+  template <int compression_level_t>
+  void TestLevel() {
+    for (const uint32_t bit_length : {1, 5, 11, 20, 32}) {
+      for (const size_t num_points : {0, 1, 2, 3, 63, 64, 1000, 5000}) {
+        const std::vector<Point3ui> points =
+            CreatePoints(num_points, bit_length);
+        std::vector<Point3ui> decoded_points =
+            DecodeAndCompare<compression_level_t>(
+                EncodePoints<compression_level_t>(points, bit_length));
+        std::vector<Point3ui> sorted_points = points;
+        std::sort(sorted_points.begin(), sorted_points.end());
+        std::sort(decoded_points.begin(), decoded_points.end());
+        ASSERT_EQ(decoded_points, sorted_points)
+            << bit_length << " " << num_points;
+      }
+    }
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(PointsKdTreeDecoder3Test, TestLevel0) { TestLevel<0>(); }
+TEST_F(PointsKdTreeDecoder3Test, TestLevel2) { TestLevel<2>(); }
+TEST_F(PointsKdTreeDecoder3Test, TestLevel4) { TestLevel<4>(); }
+TEST_F(PointsKdTreeDecoder3Test, TestLevel6) { TestLevel<6>(); }
+
+TEST_F(PointsKdTreeDecoder3Test, TestInvalidData) {
+  // Truncated and corrupted data fails like in the library decoder.
+  const std::string data = EncodePoints<6>(CreatePoints(300, 12), 12);
+  for (size_t size = 0; size < data.size(); ++size) {
+    DecodeAndCompare<6>(data.substr(0, size));
+  }
+  std::uniform_int_distribution<size_t> pos_dist(8, data.size() - 1);
+  for (int i = 0; i < 200; ++i) {
+    std::string corrupted_data = data;
+    corrupted_data[pos_dist(rng_)] ^= static_cast<char>(1 + rng_() % 255);
+    DecodeAndCompare<6>(corrupted_data);
+  }
+}
+
+TEST_F(PointsKdTreeDecoder3Test, TestMaxPoints) {
+  const std::string data = EncodePoints<4>(CreatePoints(100, 10), 10);
+  std::vector<Point3ui> points;
+  PointsBackInserter oit(&points);
+  PointsKdTreeDecoder3<4> decoder;
+  DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  EXPECT_FALSE(decoder.DecodePoints(&buffer, oit, 99));
+  buffer.Init(data.data(), data.size());
+  EXPECT_TRUE(decoder.DecodePoints(&buffer, oit, 100));
+  EXPECT_EQ(points.size(), 100u);
+}
+
+}  // namespace draco
@@ -0,0 +1,169 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/progressive_integer_points_kd_tree_decoder.h"
+
+#include <utility>
+
+#include "compression/bit_coders/adaptive_range_bit_decoder.h"
+#include "compression/bit_coders/rans_bit_decoder.h"
+#include "compression/config/compression_shared.h"
+#include "core/bit_utils.h"
+#include "core/varint_decoding.h"
+
+namespace draco {
+
+ProgressiveIntegerPointsKdTreeDecoder::ProgressiveIntegerPointsKdTreeDecoder()
+    : bit_coding_(PROGRESSIVE_KD_TREE_ADAPTIVE_RANGE_BITS),
+      bit_length_(0),
+      num_points_(0),
+      depth_(0) {}
+
+bool ProgressiveIntegerPointsKdTreeDecoder::DecodePoints(
+    DecoderBuffer *buffer, int max_depth, int64_t max_num_bytes,
+    std::vector<Point3ui> *out_points) {
+  out_points->clear();
+  depth_ = 0;
+  const int64_t start_pos = buffer->decoded_size();
+  uint8_t bit_length;
+  if (!buffer->Decode(&bit_length) || !DecodeVarint(&num_points_, buffer)) {
+    return false;
+  }
+  if (bit_length > 32) {
+    return false;
+  }
+  bit_length_ = bit_length;
+  if (num_points_ == 0) {
+    depth_ = num_levels();
+    return true;
+  }
+  if (max_depth < 0 || max_depth > num_levels()) {
+    max_depth = num_levels();
+  }
+
+  cells_.clear();
+  cells_.push_back({num_points_, Point3ui(0, 0, 0)});
+  while (depth_ < num_levels()) {
+    DecoderBuffer level_buffer = *buffer;
+    uint64_t level_size;
+    if (!DecodeVarint(&level_size, &level_buffer) ||
+        level_size > static_cast<uint64_t>(level_buffer.remaining_size())) {
+      // A missing level is an error only if it was requested without a byte
+      // budget.
+      if (depth_ < max_depth && max_num_bytes < 0) {
+        return false;
+      }
+      break;
+    }
+    const int64_t level_end =
+        level_buffer.decoded_size() + static_cast<int64_t>(level_size);
+    if (depth_ < max_depth &&
+        (max_num_bytes < 0 || level_end - start_pos <= max_num_bytes)) {
+      level_buffer.Init(level_buffer.data_head(), level_size,
+                        kDracoPointCloudBitstreamVersion);
+      const bool ok =
+          bit_coding_ == PROGRESSIVE_KD_TREE_RANS_BITS
+              ? DecodeLevel<RAnsBitDecoder>(&level_buffer)
+              : DecodeLevel<AdaptiveRangeBitDecoder>(&level_buffer);
+      if (!ok) {
+        return false;
+      }
+      ++depth_;
+    } else {
+      max_depth = depth_;
+    }
+    buffer->StartDecodingFrom(level_end);
+  }
+
+  if (is_complete()) {
+    // Each cell holds copies of a single point. |num_points_| is not reserved
+    // up front: it is read from the input and is not bounded by its size when
+    // cells hold duplicate points. The output grows with the points that are
+    // actually produced.
+    out_points->reserve(cells_.size());
+    for (const Cell &cell : cells_) {
+      out_points->insert(out_points->end(), cell.num_points, cell.base);
+    }
+    return true;
+  }
+  // Bits of each axis that are not resolved by the decoded levels.
+  Point3ui center_offset;
+  for (int axis = 0; axis < 3; ++axis) {
+    const uint32_t num_remaining_bits =
+        bit_length_ - depth_ / 3 - (axis < depth_ % 3 ? 1 : 0);
+    center_offset[axis] =
+        num_remaining_bits > 0 ? 1u << (num_remaining_bits - 1) : 0;
+  }
+  out_points->reserve(cells_.size());
+  for (const Cell &cell : cells_) {
+    out_points->push_back(cell.base + center_offset);
+  }
+  return true;
+}
+
+template <class BitDecoderT>
+bool ProgressiveIntegerPointsKdTreeDecoder::DecodeLevel(
+    DecoderBuffer *buffer) {
+  const int axis = depth_ % 3;
+  const uint32_t num_remaining_bits = bit_length_ - depth_ / 3;
+  const uint32_t modifier = 1u << (num_remaining_bits - 1);
+
+  // The numbers are only present if a cell holds more than one point.
+  bool has_numbers = false;
+  for (const Cell &cell : cells_) {
+    if (cell.num_points > 1) {
+      has_numbers = true;
+      break;
+    }
+  }
+  BitDecoderT half_decoder;
+  BitDecoderT numbers_decoder;
+  if (!half_decoder.StartDecoding(buffer) ||
+      (has_numbers && !numbers_decoder.StartDecoding(buffer))) {
+    return false;
+  }
+
+  next_cells_.clear();
+  for (const Cell &cell : cells_) {
+    const uint32_t num_points = cell.num_points;
+    const int required_bits = MostSignificantBit(num_points);
+    uint32_t number = 0;
+    if (required_bits > 0) {
+      numbers_decoder.DecodeLeastSignificantBits32(required_bits, &number);
+    }
+    uint32_t first_half = num_points / 2;
+    if (first_half < number) {
+      // Invalid |number|.
+      return false;
+    }
+    first_half -= number;
+    uint32_t second_half = num_points - first_half;
+    if (first_half != second_half && !half_decoder.DecodeNextBit()) {
+      std::swap(first_half, second_half);
+    }
+
+    if (first_half > 0) {
+      next_cells_.push_back({first_half, cell.base});
+    }
+    if (second_half > 0) {
+      Cell second_cell = {second_half, cell.base};
+      second_cell.base[axis] += modifier;
+      next_cells_.push_back(second_cell);
+    }
+  }
+  cells_.swap(next_cells_);
+  return true;
+}
+
+}  // namespace draco
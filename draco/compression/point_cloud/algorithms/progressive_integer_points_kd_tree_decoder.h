@@ -0,0 +1,93 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PROGRESSIVE_INTEGER_POINTS_KD_TREE_DECODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PROGRESSIVE_INTEGER_POINTS_KD_TREE_DECODER_H_
+
+#include <vector>
+
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "core/decoder_buffer.h"
+
+namespace draco {
+
+// Bit coder used by the levels of the encoded kd-tree.
+enum ProgressiveKdTreeBitCoding {
+  // RAnsBitEncoder, written by the first version of the encoder.
+  PROGRESSIVE_KD_TREE_RANS_BITS = 0,
+  // AdaptiveRangeBitEncoder.
+  PROGRESSIVE_KD_TREE_ADAPTIVE_RANGE_BITS,
+};
+
+// Decodes points encoded by ProgressiveIntegerPointsKdTreeEncoder. Decoding
+// can stop after any level of the tree, either at a given depth or when the
+// next level does not fit into a byte budget. The result is then one point in
+// the center of each occupied cell of the last decoded level, which is a
+// uniformly subsampled version of the encoded points. When all levels are
+// decoded the exact encoded points are returned.
+class ProgressiveIntegerPointsKdTreeDecoder {
+ public:
+  ProgressiveIntegerPointsKdTreeDecoder();
+
+  // Sets the bit coder of the encoded levels. Defaults to
+  // PROGRESSIVE_KD_TREE_ADAPTIVE_RANGE_BITS, which is written by
+  // ProgressiveIntegerPointsKdTreeEncoder.
+  void set_bit_coding(ProgressiveKdTreeBitCoding bit_coding) {
+    bit_coding_ = bit_coding;
+  }
+
+  // Decodes at most |max_depth| levels of the tree (all if negative) and
+  // stores the points in |out_points|. At most |max_num_bytes| bytes of
+  // |buffer| are used (no limit if negative), so |buffer| may hold just a
+  // prefix of the encoded data. Levels that are not decoded are skipped if
+  // they are present in |buffer|.
+  bool DecodePoints(DecoderBuffer *buffer, int max_depth,
+                    int64_t max_num_bytes, std::vector<Point3ui> *out_points);
+
+  // Decodes all levels of the tree.
+  bool DecodePoints(DecoderBuffer *buffer,
+                    std::vector<Point3ui> *out_points) {
+    return DecodePoints(buffer, -1, -1, out_points);
+  }
+
+  uint32_t bit_length() const { return bit_length_; }
+  // Number of encoded points, which is larger than the number of decoded
+  // points unless all levels were decoded.
+  uint32_t num_encoded_points() const { return num_points_; }
+  // Number of levels of the encoded tree.
+  int num_levels() const { return 3 * bit_length_; }
+  // Number of decoded levels.
+  int depth() const { return depth_; }
+  bool is_complete() const { return depth_ == num_levels(); }
+
+ private:
+  struct Cell {
+    uint32_t num_points;
+    Point3ui base;
+  };
+
+  template <class BitDecoderT>
+  bool DecodeLevel(DecoderBuffer *buffer);
+
+  ProgressiveKdTreeBitCoding bit_coding_;
+  uint32_t bit_length_;
+  uint32_t num_points_;
+  int depth_;
+  std::vector<Cell> cells_;
+  std::vector<Cell> next_cells_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PROGRESSIVE_INTEGER_POINTS_KD_TREE_DECODER_H_
@@ -0,0 +1,99 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/algorithms/progressive_integer_points_kd_tree_encoder.h"
+
+#include <algorithm>
+
+#include "core/bit_utils.h"
+#include "core/varint_encoding.h"
+
+namespace draco {
+
+bool ProgressiveIntegerPointsKdTreeEncoder::EncodePoints(
+    std::vector<Point3ui> *points, uint32_t bit_length,
+    EncoderBuffer *buffer) {
+  if (bit_length > 32) {
+    return false;
+  }
+  buffer->Encode(static_cast<uint8_t>(bit_length));
+  EncodeVarint(static_cast<uint32_t>(points->size()), buffer);
+  if (points->empty()) {
+    return true;
+  }
+
+  cells_.clear();
+  cells_.push_back({0, static_cast<uint32_t>(points->size()),
+                    Point3ui(0, 0, 0)});
+  const uint32_t num_levels = 3 * bit_length;
+  for (uint32_t level = 0; level < num_levels; ++level) {
+    const int axis = level % 3;
+    // Number of bits of |axis| that are not resolved by the previous levels.
+    const uint32_t num_remaining_bits = bit_length - level / 3;
+    const uint32_t modifier = 1u << (num_remaining_bits - 1);
+
+    half_encoder_.StartEncoding();
+    numbers_encoder_.StartEncoding();
+    bool has_numbers = false;
+    next_cells_.clear();
+    for (const Cell &cell : cells_) {
+      const uint32_t split_value = cell.base[axis] + modifier;
+      const auto begin = points->begin() + cell.begin;
+      const auto end = points->begin() + cell.end;
+      const uint32_t split = cell.begin + static_cast<uint32_t>(
+          std::partition(begin, end,
+                         [axis, split_value](const Point3ui &p) {
+                           return p[axis] < split_value;
+                         }) -
+          begin);
+
+      // Same coding of the counts as in DynamicIntegerPointsKdTreeEncoder.
+      const uint32_t num_points = cell.end - cell.begin;
+      const uint32_t first_half = split - cell.begin;
+      const uint32_t second_half = cell.end - split;
+      const bool left = first_half < second_half;
+      const int required_bits = MostSignificantBit(num_points);
+      if (required_bits > 0) {
+        numbers_encoder_.EncodeLeastSignificantBits32(
+            required_bits,
+            num_points / 2 - (left ? first_half : second_half));
+        has_numbers = true;
+      }
+      if (first_half != second_half) {
+        half_encoder_.EncodeBit(left);
+      }
+
+      if (first_half > 0) {
+        next_cells_.push_back({cell.begin, split, cell.base});
+      }
+      if (second_half > 0) {
+        Cell second_cell = {split, cell.end, cell.base};
+        second_cell.base[axis] += modifier;
+        next_cells_.push_back(second_cell);
+      }
+    }
+
+    level_buffer_.Clear();
+    half_encoder_.EndEncoding(&level_buffer_);
+    if (has_numbers) {
+      numbers_encoder_.EndEncoding(&level_buffer_);
+    }
+    EncodeVarint(static_cast<uint64_t>(level_buffer_.size()), buffer);
+    buffer->Encode(level_buffer_.data(), level_buffer_.size());
+    cells_.swap(next_cells_);
+  }
+  return true;
+}
+
+}  // namespace draco
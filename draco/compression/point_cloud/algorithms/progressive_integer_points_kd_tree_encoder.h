@@ -0,0 +1,81 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PROGRESSIVE_INTEGER_POINTS_KD_TREE_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PROGRESSIVE_INTEGER_POINTS_KD_TREE_ENCODER_H_
+
+#include <vector>
+
+#include "compression/bit_coders/adaptive_range_bit_encoder.h"
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "core/encoder_buffer.h"
+
+namespace draco {
+
+// Encodes 3D integer points with a kd-tree that is written level by level
+// (breadth first), so that any prefix of the levels describes the whole point
+// cloud at a lower resolution. See ProgressiveIntegerPointsKdTreeDecoder.
+//
+// Like DynamicIntegerPointsKdTreeEncoder the tree splits the cells in the
+// middle and codes the number of points in the first half. The axes are not
+// selected adaptively but cycle through x, y and z, so all cells of a level
+// have the same size. Level d splits along axis d % 3 and the tree has
+// 3 * |bit_length| levels, after which each cell holds copies of a single
+// point.
+//
+// Bitstream:
+//
+//   uint8   bit length
+//   varint  number of points
+//   For each of the 3 * bit length levels (only if there are any points):
+//     varint  size of the level data in bytes
+//     AdaptiveRangeBit coded half bits (which half holds fewer points)
+//     AdaptiveRangeBit coded deviations of the counts from half of the
+//             points, only present if a cell of the level holds more than
+//             one point
+//
+// The bits are coded while the level is split, the encoder does not buffer
+// them. Older data with RAnsBit coded levels can still be decoded, see
+// ProgressiveIntegerPointsKdTreeDecoder::set_bit_coding().
+//
+// The order of the points is not preserved.
+class ProgressiveIntegerPointsKdTreeEncoder {
+ public:
+  ProgressiveIntegerPointsKdTreeEncoder() {}
+
+  // Encodes |points| into |buffer|. |bit_length| gives the number of bits
+  // used by the coordinates and must be in [0, 32]. The points are reordered.
+  bool EncodePoints(std::vector<Point3ui> *points, uint32_t bit_length,
+                    EncoderBuffer *buffer);
+
+ private:
+  // Cell of the tree holding the points in [begin, end) of the input.
+  struct Cell {
+    uint32_t begin;
+    uint32_t end;
+    Point3ui base;
+  };
+
+  // Cells of the current and of the next level, reused between levels.
+  std::vector<Cell> cells_;
+  std::vector<Cell> next_cells_;
+  // Bit coders of a level, reused so that their output keeps its capacity.
+  AdaptiveRangeBitEncoder half_encoder_;
+  AdaptiveRangeBitEncoder numbers_encoder_;
+  EncoderBuffer level_buffer_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_PROGRESSIVE_INTEGER_POINTS_KD_TREE_ENCODER_H_
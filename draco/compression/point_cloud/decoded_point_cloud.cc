@@ -0,0 +1,61 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/decoded_point_cloud.h"
+
+#include <utility>
+#include <vector>
+
+namespace draco {
+
+std::unique_ptr<PointCloud> CreatePositionsPointCloud(
+    size_t num_points, const PositionsWriter &write_positions,
+    FrameArena *arena) {
+  std::unique_ptr<PointCloud> pc(new PointCloud());
+  pc->set_num_points(static_cast<PointIndex::ValueType>(num_points));
+  GeometryAttribute va;
+  va.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+          sizeof(float) * 3, 0);
+  const size_t entry_size = sizeof(float) * 3;
+  PointAttribute *att;
+  if (arena == nullptr) {
+    att = pc->attribute(pc->AddAttribute(
+        va, true, static_cast<AttributeValueIndex::ValueType>(num_points)));
+  } else {
+    att = pc->attribute(pc->AddAttribute(va, true, 0));
+    if (!att->AdoptValues(arena->AcquireBuffer(entry_size * num_points))) {
+      return nullptr;
+    }
+  }
+  if (num_points > 0) {
+    write_positions(
+        reinterpret_cast<float *>(att->GetAddress(AttributeValueIndex(0))),
+        entry_size, num_points);
+  }
+  return pc;
+}
+
+void RecyclePointCloud(std::unique_ptr<PointCloud> pc, FrameArena *arena) {
+  if (pc == nullptr) {
+    return;
+  }
+  for (int i = 0; i < pc->num_attributes(); ++i) {
+    DataBuffer *const buffer = pc->attribute(i)->buffer();
+    if (buffer != nullptr) {
+      arena->RecycleBuffer(buffer->Release());
+    }
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,49 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_DECODED_POINT_CLOUD_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_DECODED_POINT_CLOUD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "core/frame_arena.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Writes up to |max_num_points| positions as float triplets that are
+// |byte_stride| bytes apart (0 means tightly packed) and returns the number
+// of written points, like GetPositions() of the point cloud decoders.
+typedef std::function<size_t(float *out_positions, int64_t byte_stride,
+                             size_t max_num_points)>
+    PositionsWriter;
+
+// Creates a point cloud with a POSITION attribute of |num_points| points
+// written by |write_positions|. This is the CreatePointCloud() of the
+// decoders that only decode positions. If |arena| is not null the storage of
+// the attribute values is taken from the buffers recycled in |arena|.
+std::unique_ptr<PointCloud> CreatePositionsPointCloud(
+    size_t num_points, const PositionsWriter &write_positions,
+    FrameArena *arena);
+
+// Destroys |pc| and keeps the storage of its attribute values in |arena| for
+// the next point clouds created from it.
+void RecyclePointCloud(std::unique_ptr<PointCloud> pc, FrameArena *arena);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_DECODED_POINT_CLOUD_H_
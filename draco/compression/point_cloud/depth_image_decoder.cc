@@ -0,0 +1,223 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/depth_image_decoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "compression/bit_coders/rans_bit_decoder.h"
+#include "compression/config/compression_shared.h"
+#include "compression/entropy/symbol_decoding.h"
+#include "compression/point_cloud/decoded_point_cloud.h"
+#include "core/bit_utils.h"
+#include "core/varint_decoding.h"
+
+namespace draco {
+
+DepthImageDecoder::DepthImageDecoder()
+    : depth_precision_(0.001f),
+      num_valid_pixels_(0),
+      has_shared_symbol_table_(false),
+      shared_symbol_table_checksum_(0) {}
+
+bool DepthImageDecoder::SetSharedSymbolTable(
+    const InterleavedRAnsTable &table) {
+  has_shared_symbol_table_ = shared_symbol_decoder_.Create(table);
+  shared_symbol_table_checksum_ = table.checksum();
+  return has_shared_symbol_table_;
+}
+
+Status DepthImageDecoder::DecodeDepthImage(DecoderBuffer *in_buffer) {
+  // The image is empty until the whole frame was decoded, the buffers may
+  // not match the size of a partially decoded frame.
+  camera_ = DepthImageCamera();
+  num_valid_pixels_ = 0;
+  // The entropy coders select their format by the Draco bitstream version,
+  // the data is written with the current one.
+  in_buffer->set_bitstream_version(kDracoPointCloudBitstreamVersion);
+  uint8_t version;
+  uint32_t width;
+  uint32_t height;
+  DepthImageCamera camera;
+  uint8_t flags;
+  if (!in_buffer->Decode(&version)) {
+    return Status(Status::IO_ERROR, "Failed to parse header.");
+  }
+  if (version != kDepthImageBitstreamVersion) {
+    return Status(Status::UNSUPPORTED_VERSION, "Unknown bitstream version.");
+  }
+  if (!DecodeVarint(&width, in_buffer) || !DecodeVarint(&height, in_buffer) ||
+      !in_buffer->Decode(&camera.fx) || !in_buffer->Decode(&camera.fy) ||
+      !in_buffer->Decode(&camera.cx) || !in_buffer->Decode(&camera.cy) ||
+      !in_buffer->Decode(&depth_precision_) || !in_buffer->Decode(&flags)) {
+    return Status(Status::IO_ERROR, "Failed to parse header.");
+  }
+  if (static_cast<uint64_t>(width) * height >
+      static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+    return Status(Status::IO_ERROR, "Invalid image size.");
+  }
+  camera.width = static_cast<int>(width);
+  camera.height = static_cast<int>(height);
+  const size_t num_pixels = static_cast<size_t>(width) * height;
+
+  valid_.assign(num_pixels, 1);
+  if (flags & DEPTH_IMAGE_FLAG_HAS_MASK) {
+    RAnsBitDecoder mask_decoder;
+    if (!mask_decoder.StartDecoding(in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to decode validity mask.");
+    }
+    for (int y = 0; y < camera.height; ++y) {
+      for (int x = 0; x < camera.width; ++x) {
+        const size_t i = static_cast<size_t>(y) * width + x;
+        valid_[i] =
+            PredictDepthImageValidity(valid_.data(), camera.width, x, y, i) !=
+            mask_decoder.DecodeNextBit();
+      }
+    }
+    mask_decoder.EndDecoding();
+  }
+  size_t num_valid_pixels = 0;
+  for (size_t i = 0; i < num_pixels; ++i) {
+    num_valid_pixels += valid_[i];
+  }
+
+  symbols_.resize(num_valid_pixels);
+  if (flags & DEPTH_IMAGE_FLAG_SHARED_SYMBOL_TABLE) {
+    uint32_t checksum;
+    if (!in_buffer->Decode(&checksum)) {
+      return Status(Status::IO_ERROR, "Failed to parse header.");
+    }
+    if (!has_shared_symbol_table_ ||
+        checksum != shared_symbol_table_checksum_) {
+      return Status(Status::INVALID_PARAMETER,
+                    "Missing or different shared symbol table.");
+    }
+    if (!DecodeInterleavedSymbols(num_valid_pixels, &shared_symbol_decoder_,
+                                  in_buffer, symbols_.data())) {
+      return Status(Status::IO_ERROR, "Failed to decode depth values.");
+    }
+  } else if (flags & DEPTH_IMAGE_FLAG_INTERLEAVED_SYMBOLS) {
+    if (!DecodeInterleavedSymbols(num_valid_pixels, in_buffer,
+                                  symbols_.data())) {
+      return Status(Status::IO_ERROR, "Failed to decode depth values.");
+    }
+  } else if (num_valid_pixels > 0 &&
+             !DecodeSymbols(static_cast<uint32_t>(num_valid_pixels), 1,
+                            in_buffer, symbols_.data())) {
+    return Status(Status::IO_ERROR, "Failed to decode depth values.");
+  }
+  quantized_depths_.assign(num_pixels, 0);
+  size_t symbol_index = 0;
+  uint32_t last = 0;
+  for (int y = 0; y < camera.height; ++y) {
+    for (int x = 0; x < camera.width; ++x) {
+      const size_t i = static_cast<size_t>(y) * width + x;
+      if (!valid_[i]) {
+        continue;
+      }
+      const uint32_t prediction = PredictDepthImageValue(
+          quantized_depths_.data(), valid_.data(), camera.width, x, y, i,
+          last);
+      const int64_t value =
+          static_cast<int64_t>(prediction) +
+          ConvertSymbolToSignedInt(symbols_[symbol_index++]);
+      if (value < 0 || value > kDepthImageMaxQuantizedDepth) {
+        return Status(Status::IO_ERROR, "Invalid depth value.");
+      }
+      quantized_depths_[i] = static_cast<uint32_t>(value);
+      last = quantized_depths_[i];
+    }
+  }
+  camera_ = camera;
+  num_valid_pixels_ = num_valid_pixels;
+  return OkStatus();
+}
+
+void DepthImageDecoder::GetDepthImage(float *out_depth,
+                                      int64_t row_stride) const {
+  if (row_stride == 0) {
+    row_stride = camera_.width * sizeof(float);
+  }
+  for (int y = 0; y < camera_.height; ++y) {
+    float *const row = reinterpret_cast<float *>(
+        reinterpret_cast<uint8_t *>(out_depth) + row_stride * y);
+    for (int x = 0; x < camera_.width; ++x) {
+      const size_t i = static_cast<size_t>(y) * camera_.width + x;
+      row[x] = valid_[i] ? quantized_depths_[i] * depth_precision_ : 0.f;
+    }
+  }
+}
+
+size_t DepthImageDecoder::GetPositions(float *out_positions,
+                                       int64_t byte_stride,
+                                       size_t capacity) const {
+  if (byte_stride == 0) {
+    byte_stride = 3 * sizeof(float);
+  }
+  const size_t num_out_points = std::min(capacity, num_valid_pixels_);
+  const float inverse_fx = 1.f / camera_.fx;
+  const float inverse_fy = 1.f / camera_.fy;
+  uint8_t *out = reinterpret_cast<uint8_t *>(out_positions);
+  size_t num_written_points = 0;
+  for (int y = 0; y < camera_.height; ++y) {
+    const float v = (y - camera_.cy) * inverse_fy;
+    for (int x = 0; x < camera_.width; ++x) {
+      const size_t i = static_cast<size_t>(y) * camera_.width + x;
+      if (!valid_[i]) {
+        continue;
+      }
+      if (num_written_points == num_out_points) {
+        return num_written_points;
+      }
+      const float d = quantized_depths_[i] * depth_precision_;
+      float *const p =
+          reinterpret_cast<float *>(out + byte_stride * num_written_points);
+      p[0] = (x - camera_.cx) * inverse_fx * d;
+      p[1] = v * d;
+      p[2] = d;
+      ++num_written_points;
+    }
+  }
+  return num_written_points;
+}
+
+std::unique_ptr<PointCloud> DepthImageDecoder::CreatePointCloud() const {
+  return CreatePointCloud(nullptr);
+}
+
+std::unique_ptr<PointCloud> DepthImageDecoder::CreatePointCloud(
+    FrameArena *arena) const {
+  std::unique_ptr<PointCloud> pc = CreatePositionsPointCloud(
+      num_valid_pixels_,
+      [this](float *out_positions, int64_t byte_stride,
+             size_t max_num_points) {
+        return GetPositions(out_positions, byte_stride, max_num_points);
+      },
+      arena);
+  if (pc == nullptr) {
+    return nullptr;
+  }
+  std::unique_ptr<GeometryMetadata> metadata(new GeometryMetadata());
+  metadata->AddEntryIntArray(kDepthImageSizeMetadataName,
+                             {camera_.width, camera_.height});
+  metadata->AddEntryDoubleArray(kDepthImageIntrinsicsMetadataName,
+                                {camera_.fx, camera_.fy, camera_.cx,
+                                 camera_.cy});
+  pc->AddMetadata(std::move(metadata));
+  return pc;
+}
+
+}  // namespace draco
@@ -0,0 +1,80 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_DECODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "compression/entropy/interleaved_rans.h"
+#include "compression/point_cloud/depth_image_shared.h"
+#include "core/decoder_buffer.h"
+#include "core/frame_arena.h"
+#include "core/status.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Decodes depth images encoded by DepthImageEncoder and reconstructs the 3D
+// points of their valid pixels.
+class DepthImageDecoder {
+ public:
+  DepthImageDecoder();
+
+  // Sets the table of frames that were encoded with a shared symbol table,
+  // see DepthImageEncoder::SetSharedSymbolTable(). The decoding table is
+  // built once and used for all following frames. Returns false if |table|
+  // is not valid.
+  bool SetSharedSymbolTable(const InterleavedRAnsTable &table);
+
+  Status DecodeDepthImage(DecoderBuffer *in_buffer);
+
+  const DepthImageCamera &camera() const { return camera_; }
+
+  // Number of valid pixels, i.e. of decoded points.
+  size_t num_points() const { return num_valid_pixels_; }
+
+  // Writes the decoded depth image with rows that are |row_stride| bytes
+  // apart (0 means tightly packed). Invalid pixels are set to 0.
+  void GetDepthImage(float *out_depth, int64_t row_stride) const;
+
+  // Writes the points of the valid pixels in row-major order as float
+  // triplets that are |byte_stride| bytes apart (0 means tightly packed). At
+  // most |capacity| points are written. Returns the number of written points.
+  size_t GetPositions(float *out_positions, int64_t byte_stride,
+                      size_t capacity) const;
+
+  // Creates a point cloud with a POSITION attribute holding the decoded
+  // points. The camera is stored in the geometry metadata.
+  std::unique_ptr<PointCloud> CreatePointCloud() const;
+  // Same as CreatePointCloud() but the storage of the attribute values is
+  // taken from the buffers recycled in |arena|, see RecyclePointCloud().
+  std::unique_ptr<PointCloud> CreatePointCloud(FrameArena *arena) const;
+
+ private:
+  DepthImageCamera camera_;
+  float depth_precision_;
+  size_t num_valid_pixels_;
+  bool has_shared_symbol_table_;
+  uint32_t shared_symbol_table_checksum_;
+  InterleavedRAnsDecoder shared_symbol_decoder_;
+  std::vector<uint32_t> quantized_depths_;
+  std::vector<uint8_t> valid_;
+  std::vector<uint32_t> symbols_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_DECODER_H_
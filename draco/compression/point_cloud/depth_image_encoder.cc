@@ -0,0 +1,220 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/depth_image_encoder.h"
+
+#include <cmath>
+#include <limits>
+
+#include "compression/bit_coders/rans_bit_encoder.h"
+#include "compression/entropy/symbol_encoding.h"
+#include "core/bit_utils.h"
+#include "core/varint_encoding.h"
+
+namespace draco {
+
+DepthImageEncoder::DepthImageEncoder()
+    : depth_precision_(0.001f),
+      interleaved_num_states_(0),
+      has_shared_symbol_table_(false),
+      shared_symbol_table_checksum_(0),
+      symbol_histogram_(nullptr) {}
+
+bool DepthImageEncoder::SetSharedSymbolTable(
+    const InterleavedRAnsTable &table) {
+  has_shared_symbol_table_ = shared_symbol_encoder_.Create(table);
+  shared_symbol_table_checksum_ = table.checksum();
+  return has_shared_symbol_table_;
+}
+
+Status DepthImageEncoder::EncodeDepthImage(const float *depth,
+                                           int64_t row_stride,
+                                           const uint8_t *valid_mask,
+                                           const DepthImageCamera &camera,
+                                           EncoderBuffer *out_buffer) {
+  const int width = camera.width;
+  const int height = camera.height;
+  if (width < 0 || height < 0 ||
+      static_cast<int64_t>(width) * height >
+          std::numeric_limits<int32_t>::max()) {
+    return Status(Status::INVALID_PARAMETER, "Invalid image size.");
+  }
+  const size_t num_pixels = static_cast<size_t>(width) * height;
+  if (depth == nullptr && num_pixels > 0) {
+    return Status(Status::INVALID_PARAMETER, "Missing depth data.");
+  }
+  if (!std::isfinite(camera.fx) || !std::isfinite(camera.fy) ||
+      camera.fx == 0.f || camera.fy == 0.f) {
+    return Status(Status::INVALID_PARAMETER, "Invalid camera intrinsics.");
+  }
+  if (!(depth_precision_ > 0.f) || !std::isfinite(depth_precision_)) {
+    return Status(Status::INVALID_PARAMETER, "Invalid depth precision.");
+  }
+  if (row_stride == 0) {
+    row_stride = width * sizeof(float);
+  }
+  if (row_stride < static_cast<int64_t>(width * sizeof(float))) {
+    return Status(Status::INVALID_PARAMETER, "Invalid row stride.");
+  }
+
+  // Quantize the depths of the valid pixels.
+  quantized_depths_.assign(num_pixels, 0);
+  valid_.assign(num_pixels, 0);
+  bool has_invalid_pixels = false;
+  const float inverse_precision = 1.f / depth_precision_;
+  for (int y = 0; y < height; ++y) {
+    const float *const row = reinterpret_cast<const float *>(
+        reinterpret_cast<const uint8_t *>(depth) + row_stride * y);
+    for (int x = 0; x < width; ++x) {
+      const size_t i = static_cast<size_t>(y) * width + x;
+      const float d = row[x];
+      const bool valid =
+          valid_mask != nullptr ? valid_mask[i] != 0 : d > 0.f;
+      if (!valid) {
+        has_invalid_pixels = true;
+        continue;
+      }
+      // Written to also reject NaNs.
+      const float q = std::floor(d * inverse_precision + 0.5f);
+      if (!(q >= 0.f && q <= kDepthImageMaxQuantizedDepth)) {
+        return Status(Status::INVALID_PARAMETER, "Depth out of range.");
+      }
+      quantized_depths_[i] = static_cast<uint32_t>(q);
+      valid_[i] = 1;
+    }
+  }
+
+  out_buffer->Encode(kDepthImageBitstreamVersion);
+  EncodeVarint(static_cast<uint32_t>(width), out_buffer);
+  EncodeVarint(static_cast<uint32_t>(height), out_buffer);
+  out_buffer->Encode(camera.fx);
+  out_buffer->Encode(camera.fy);
+  out_buffer->Encode(camera.cx);
+  out_buffer->Encode(camera.cy);
+  out_buffer->Encode(depth_precision_);
+  uint8_t flags = 0;
+  if (has_invalid_pixels) {
+    flags |= DEPTH_IMAGE_FLAG_HAS_MASK;
+  }
+  if (has_shared_symbol_table_) {
+    flags |= DEPTH_IMAGE_FLAG_SHARED_SYMBOL_TABLE;
+  } else if (interleaved_num_states_ > 0) {
+    flags |= DEPTH_IMAGE_FLAG_INTERLEAVED_SYMBOLS;
+  }
+  out_buffer->Encode(flags);
+
+  if (has_invalid_pixels) {
+    // Valid regions are contiguous, so the mask is coded as changes of the
+    // validity from the left neighbor.
+    RAnsBitEncoder mask_encoder;
+    mask_encoder.StartEncoding();
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        const size_t i = static_cast<size_t>(y) * width + x;
+        mask_encoder.EncodeBit(
+            (valid_[i] != 0) !=
+            PredictDepthImageValidity(valid_.data(), width, x, y, i));
+      }
+    }
+    mask_encoder.EndEncoding(out_buffer);
+  }
+
+  symbols_.clear();
+  uint32_t last = 0;
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const size_t i = static_cast<size_t>(y) * width + x;
+      if (!valid_[i]) {
+        continue;
+      }
+      const uint32_t prediction = PredictDepthImageValue(
+          quantized_depths_.data(), valid_.data(), width, x, y, i, last);
+      const int32_t residual = static_cast<int32_t>(
+          static_cast<int64_t>(quantized_depths_[i]) - prediction);
+      symbols_.push_back(ConvertSignedIntToSymbol(residual));
+      last = quantized_depths_[i];
+    }
+  }
+  if (symbol_histogram_ != nullptr) {
+    symbol_histogram_->AddSymbols(symbols_.data(), symbols_.size());
+  }
+  bool ok;
+  if (has_shared_symbol_table_) {
+    out_buffer->Encode(shared_symbol_table_checksum_);
+    ok = EncodeInterleavedSymbols(symbols_.data(), symbols_.size(),
+                                  &shared_symbol_encoder_, out_buffer);
+  } else if (interleaved_num_states_ > 0) {
+    ok = EncodeInterleavedSymbols(symbols_.data(), symbols_.size(),
+                                  interleaved_num_states_, out_buffer);
+  } else {
+    ok = EncodeSymbols(symbols_.data(), static_cast<int>(symbols_.size()), 1,
+                       nullptr, out_buffer);
+  }
+  if (!ok) {
+    return ErrorStatus("Failed to encode depth values.");
+  }
+  return OkStatus();
+}
+
+Status DepthImageEncoder::EncodePointCloud(const PointCloud &pc,
+                                           EncoderBuffer *out_buffer) {
+  const GeometryMetadata *const metadata = pc.GetMetadata();
+  std::vector<int32_t> size;
+  std::vector<double> intrinsics;
+  if (metadata == nullptr ||
+      !metadata->GetEntryIntArray(kDepthImageSizeMetadataName, &size) ||
+      !metadata->GetEntryDoubleArray(kDepthImageIntrinsicsMetadataName,
+                                     &intrinsics) ||
+      size.size() != 2 || intrinsics.size() != 4) {
+    return Status(Status::INVALID_PARAMETER, "Missing depth camera.");
+  }
+  DepthImageCamera camera;
+  camera.width = size[0];
+  camera.height = size[1];
+  camera.fx = static_cast<float>(intrinsics[0]);
+  camera.fy = static_cast<float>(intrinsics[1]);
+  camera.cx = static_cast<float>(intrinsics[2]);
+  camera.cy = static_cast<float>(intrinsics[3]);
+  if (camera.width < 0 || camera.height < 0 ||
+      static_cast<int64_t>(camera.width) * camera.height >
+          std::numeric_limits<int32_t>::max()) {
+    return Status(Status::INVALID_PARAMETER, "Invalid image size.");
+  }
+  const PointAttribute *const att =
+      pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (att == nullptr || att->num_components() != 3) {
+    return Status(Status::INVALID_PARAMETER, "Missing position attribute.");
+  }
+
+  // Project the points back to the image.
+  depth_image_.assign(static_cast<size_t>(camera.width) * camera.height, 0.f);
+  for (PointIndex i(0); i < pc.num_points(); ++i) {
+    float p[3];
+    att->ConvertValue<float, 3>(att->mapped_index(i), p);
+    if (!(p[2] > 0.f)) {
+      return Status(Status::INVALID_PARAMETER, "Point behind the camera.");
+    }
+    const float u = std::floor(p[0] * camera.fx / p[2] + camera.cx + 0.5f);
+    const float v = std::floor(p[1] * camera.fy / p[2] + camera.cy + 0.5f);
+    if (!(u >= 0.f && u < camera.width && v >= 0.f && v < camera.height)) {
+      return Status(Status::INVALID_PARAMETER, "Point outside of the image.");
+    }
+    depth_image_[static_cast<size_t>(v) * camera.width +
+                 static_cast<size_t>(u)] = p[2];
+  }
+  return EncodeDepthImage(depth_image_.data(), 0, nullptr, camera,
+                          out_buffer);
+}
+
+}  // namespace draco
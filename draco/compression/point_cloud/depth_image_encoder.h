@@ -0,0 +1,98 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_ENCODER_H_
+
+#include <vector>
+
+#include "compression/entropy/interleaved_rans.h"
+#include "compression/point_cloud/depth_image_shared.h"
+#include "core/encoder_buffer.h"
+#include "core/status.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Encodes point clouds that were unprojected from a depth image, such as the
+// frames of a depth camera. Instead of coding arbitrary 3D points, the depth
+// raster is coded directly together with its validity mask and the camera
+// intrinsics. Each depth is predicted from its already coded neighbors in the
+// image, which takes linear time and exploits the smoothness of depth maps.
+// The decoder unprojects the valid pixels to 3D points. See
+// depth_image_shared.h for the bitstream layout.
+class DepthImageEncoder {
+ public:
+  DepthImageEncoder();
+
+  // Size of a depth quantization step, in the units of the depth values.
+  // Default is 0.001 (1mm for depth in meters).
+  void SetDepthPrecision(float precision) { depth_precision_ = precision; }
+
+  // Number of interleaved rANS states (4 or 8) used to code the depth
+  // values, see interleaved_rans.h. 0 (default) uses the Draco symbol coding,
+  // which is more compact for very small images.
+  void SetInterleavedSymbolCoding(int num_states) {
+    interleaved_num_states_ = num_states;
+  }
+
+  // Codes the depth values of the following frames with |table| instead of a
+  // table per frame, which saves building and storing the table. |table| is
+  // typically created once per sequence from an InterleavedSymbolHistogram
+  // and stored with the sequence, the decoder must be given the same table
+  // (see DepthImageDecoder::SetSharedSymbolTable()). Takes precedence over
+  // SetInterleavedSymbolCoding(). Returns false if |table| is not valid.
+  bool SetSharedSymbolTable(const InterleavedRAnsTable &table);
+  void ClearSharedSymbolTable() { has_shared_symbol_table_ = false; }
+
+  // If set, the depth value symbols of all encoded frames are added to
+  // |histogram|. It must outlive the encoder or be reset with nullptr.
+  void SetSymbolHistogram(InterleavedSymbolHistogram *histogram) {
+    symbol_histogram_ = histogram;
+  }
+
+  // Encodes a depth image of |camera.width| x |camera.height| pixels. Rows
+  // of |depth| are |row_stride| bytes apart (0 means tightly packed).
+  // |valid_mask| holds one byte per pixel in row-major order, nonzero for
+  // valid pixels. If it is null, pixels with a finite positive depth are
+  // valid.
+  Status EncodeDepthImage(const float *depth, int64_t row_stride,
+                          const uint8_t *valid_mask,
+                          const DepthImageCamera &camera,
+                          EncoderBuffer *out_buffer);
+
+  // Encodes the POSITION attribute of a point cloud that was unprojected
+  // from a depth image. The camera is read from the geometry metadata of |pc|
+  // (see kDepthImageSizeMetadataName). Each point is assigned to the nearest
+  // pixel.
+  Status EncodePointCloud(const PointCloud &pc, EncoderBuffer *out_buffer);
+
+ private:
+  float depth_precision_;
+  int interleaved_num_states_;
+  bool has_shared_symbol_table_;
+  uint32_t shared_symbol_table_checksum_;
+  InterleavedRAnsEncoder shared_symbol_encoder_;
+  InterleavedSymbolHistogram *symbol_histogram_;
+
+  // Scratch storage reused between calls.
+  std::vector<uint32_t> quantized_depths_;
+  std::vector<uint8_t> valid_;
+  std::vector<uint32_t> symbols_;
+  std::vector<float> depth_image_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_ENCODER_H_
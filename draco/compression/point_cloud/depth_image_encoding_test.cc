@@ -0,0 +1,287 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "compression/point_cloud/depth_image_decoder.h"
+#include "compression/point_cloud/depth_image_encoder.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class DepthImageEncodingTest : public ::testing::Test {
+ protected:
+  DepthImageEncodingTest() : rng_(11) {
+    camera_.width = 64;
+    camera_.height = 48;
+    camera_.fx = 50.f;
+    camera_.fy = 52.f;
+    camera_.cx = 31.5f;
+    camera_.cy = 23.5f;
+  }
+
+  // Creates a depth image of a slanted plane with a step, noise and a few
+  // invalid pixels (zero and NaN depths).
+  void CreateDepthImage(int frame) {
+    std::uniform_real_distribution<float> noise(-0.002f, 0.002f);
+    depth_.resize(camera_.width * camera_.height);
+    for (int y = 0; y < camera_.height; ++y) {
+      for (int x = 0; x < camera_.width; ++x) {
+        float d = 1.f + 0.01f * x + 0.005f * y + noise(rng_);
+        if (x > 40 + frame) {
+          d += 0.5f;
+        }
+        depth_[y * camera_.width + x] = d;
+      }
+    }
+    for (int i = 0; i < 100; ++i) {
+      depth_[rng_() % depth_.size()] = i % 2 ? 0.f : NAN;
+    }
+    for (int x = 10; x < 20; ++x) {
+      depth_[5 * camera_.width + x] = 0.f;
+    }
+  }
+
+  void Encode(DepthImageEncoder *encoder, std::vector<char> *out_data) {
+    EncoderBuffer buffer;
+    ASSERT_TRUE(encoder
+                    ->EncodeDepthImage(depth_.data(), 0, nullptr, camera_,
+                                       &buffer)
+                    .ok());
+    out_data->assign(buffer.data(), buffer.data() + buffer.size());
+  }
+
+  // Decodes the first |size| bytes of |data|.
+  static Status Decode(const std::vector<char> &data, size_t size,
+                       DepthImageDecoder *decoder) {
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), size);
+    return decoder->DecodeDepthImage(&buffer);
+  }
+
+  // Expects the decoded image to match |depth_| up to the quantization
+  // error, with zeros at invalid pixels, and the points to be unprojected
+  // from the valid pixels.
+  void ExpectDepthImage(const DepthImageDecoder &decoder) const {
+    EXPECT_EQ(decoder.camera().width, camera_.width);
+    EXPECT_EQ(decoder.camera().height, camera_.height);
+    EXPECT_EQ(decoder.camera().fx, camera_.fx);
+    EXPECT_EQ(decoder.camera().fy, camera_.fy);
+    EXPECT_EQ(decoder.camera().cx, camera_.cx);
+    EXPECT_EQ(decoder.camera().cy, camera_.cy);
+    std::vector<float> decoded(depth_.size(), -1.f);
+    decoder.GetDepthImage(decoded.data(), 0);
+    size_t num_valid_pixels = 0;
+    for (size_t i = 0; i < depth_.size(); ++i) {
+      if (depth_[i] > 0.f) {
+        ++num_valid_pixels;
+        ASSERT_NEAR(decoded[i], depth_[i], 0.0005f + 1e-6f) << i;
+      } else {
+        ASSERT_EQ(decoded[i], 0.f) << i;
+      }
+    }
+    ASSERT_EQ(decoder.num_points(), num_valid_pixels);
+
+    std::vector<float> positions(3 * num_valid_pixels);
+    ASSERT_EQ(decoder.GetPositions(positions.data(), 0, num_valid_pixels),
+              num_valid_pixels);
+    size_t point = 0;
+    for (int y = 0; y < camera_.height; ++y) {
+      for (int x = 0; x < camera_.width; ++x) {
+        const float d = decoded[y * camera_.width + x];
+        if (d == 0.f) {
+          continue;
+        }
+        EXPECT_NEAR(positions[3 * point], (x - camera_.cx) * d / camera_.fx,
+                    1e-4f);
+        EXPECT_NEAR(positions[3 * point + 1],
+                    (y - camera_.cy) * d / camera_.fy, 1e-4f);
+        EXPECT_EQ(positions[3 * point + 2], d);
+        ++point;
+      }
+    }
+  }
+
+  std::mt19937 rng_;
+  DepthImageCamera camera_;
+  std::vector<float> depth_;
+};
+
+TEST_F(DepthImageEncodingTest, TestRoundTrip) {
+  // Draco symbol coding and interleaved rANS with 4 and 8 states.
+  for (const int num_states : {0, 4, 8}) {
+    DepthImageEncoder encoder;
+    encoder.SetInterleavedSymbolCoding(num_states);
+    DepthImageDecoder decoder;
+    for (int frame = 0; frame < 3; ++frame) {
+      CreateDepthImage(frame);
+      std::vector<char> data;
+      Encode(&encoder, &data);
+      ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+      ExpectDepthImage(decoder);
+    }
+  }
+}
+
+TEST_F(DepthImageEncodingTest, TestValidMask) {
+  CreateDepthImage(0);
+  // Pixels marked as invalid are dropped regardless of their depth.
+  std::vector<uint8_t> mask(depth_.size());
+  for (size_t i = 0; i < depth_.size(); ++i) {
+    mask[i] = depth_[i] > 0.f && i % 7 != 0;
+    if (!mask[i]) {
+      depth_[i] = i % 2 ? 0.f : 5.f;
+    }
+  }
+  DepthImageEncoder encoder;
+  EncoderBuffer buffer;
+  ASSERT_TRUE(encoder
+                  .EncodeDepthImage(depth_.data(), 0, mask.data(), camera_,
+                                    &buffer)
+                  .ok());
+  for (size_t i = 0; i < depth_.size(); ++i) {
+    if (!mask[i]) {
+      depth_[i] = 0.f;
+    }
+  }
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  DepthImageDecoder decoder;
+  ASSERT_TRUE(decoder.DecodeDepthImage(&in_buffer).ok());
+  ExpectDepthImage(decoder);
+}
+
+TEST_F(DepthImageEncodingTest, TestRowStride) {
+  CreateDepthImage(0);
+  const int row_size = camera_.width + 3;
+  std::vector<float> padded(row_size * camera_.height, -1.f);
+  for (int y = 0; y < camera_.height; ++y) {
+    std::copy(depth_.begin() + y * camera_.width,
+              depth_.begin() + (y + 1) * camera_.width,
+              padded.begin() + y * row_size);
+  }
+  DepthImageEncoder encoder;
+  EncoderBuffer buffer;
+  ASSERT_TRUE(encoder
+                  .EncodeDepthImage(padded.data(), row_size * sizeof(float),
+                                    nullptr, camera_, &buffer)
+                  .ok());
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  DepthImageDecoder decoder;
+  ASSERT_TRUE(decoder.DecodeDepthImage(&in_buffer).ok());
+  ExpectDepthImage(decoder);
+  std::vector<float> decoded(padded.size(), -1.f);
+  decoder.GetDepthImage(decoded.data(), row_size * sizeof(float));
+  EXPECT_EQ(decoded[camera_.width], -1.f);
+}
+
+TEST_F(DepthImageEncodingTest, TestSharedSymbolTable) {
+  // Collect the statistics of a few frames.
+  InterleavedSymbolHistogram histogram;
+  {
+    DepthImageEncoder encoder;
+    encoder.SetSymbolHistogram(&histogram);
+    for (int frame = 0; frame < 3; ++frame) {
+      CreateDepthImage(frame);
+      std::vector<char> data;
+      Encode(&encoder, &data);
+    }
+  }
+  InterleavedRAnsTable table;
+  ASSERT_TRUE(histogram.CreateTable(4, &table));
+
+  DepthImageEncoder encoder;
+  ASSERT_TRUE(encoder.SetSharedSymbolTable(table));
+  DepthImageDecoder decoder;
+  ASSERT_TRUE(decoder.SetSharedSymbolTable(table));
+  for (int frame = 3; frame < 6; ++frame) {
+    CreateDepthImage(frame);
+    std::vector<char> data;
+    Encode(&encoder, &data);
+    ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+    ExpectDepthImage(decoder);
+
+    // The table is required and must match.
+    DepthImageDecoder decoder_without_table;
+    EXPECT_EQ(Decode(data, data.size(), &decoder_without_table).code(),
+              Status::INVALID_PARAMETER);
+    InterleavedRAnsTable other_table;
+    ASSERT_TRUE(histogram.CreateTable(8, &other_table));
+    DepthImageDecoder decoder_with_other_table;
+    ASSERT_TRUE(decoder_with_other_table.SetSharedSymbolTable(other_table));
+    EXPECT_EQ(Decode(data, data.size(), &decoder_with_other_table).code(),
+              Status::INVALID_PARAMETER);
+  }
+}
+
+TEST_F(DepthImageEncodingTest, TestTruncatedData) {
+  CreateDepthImage(0);
+  for (const int num_states : {0, 4}) {
+    DepthImageEncoder encoder;
+    encoder.SetInterleavedSymbolCoding(num_states);
+    std::vector<char> data;
+    Encode(&encoder, &data);
+    for (size_t size = 0; size < data.size(); ++size) {
+      DepthImageDecoder decoder;
+      ASSERT_FALSE(Decode(data, size, &decoder).ok()) << size;
+      EXPECT_EQ(decoder.num_points(), 0u);
+      EXPECT_EQ(decoder.camera().width, 0);
+    }
+  }
+}
+
+TEST_F(DepthImageEncodingTest, TestCorruptedData) {
+  CreateDepthImage(0);
+  DepthImageEncoder encoder;
+  encoder.SetInterleavedSymbolCoding(4);
+  std::vector<char> data;
+  Encode(&encoder, &data);
+  {
+    std::vector<char> corrupted = data;
+    corrupted[0] = kDepthImageBitstreamVersion + 1;
+    DepthImageDecoder decoder;
+    EXPECT_EQ(Decode(corrupted, corrupted.size(), &decoder).code(),
+              Status::UNSUPPORTED_VERSION);
+  }
+
+  // Flipped bits must not crash the decoder. They are not always detected,
+  // but a failed frame leaves an empty image, even if a larger frame was
+  // decoded before.
+  DepthImageDecoder decoder;
+  for (int i = 0; i < 1000; ++i) {
+    std::vector<char> corrupted = data;
+    // The size of the image is not corrupted to keep the test fast.
+    const size_t offset = 3 + rng_() % (corrupted.size() - 3);
+    corrupted[offset] ^= static_cast<char>(1 << (rng_() % 8));
+    ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+    if (!Decode(corrupted, corrupted.size(), &decoder).ok()) {
+      EXPECT_EQ(decoder.num_points(), 0u);
+      EXPECT_EQ(decoder.camera().width, 0);
+      continue;
+    }
+    const DepthImageCamera &camera = decoder.camera();
+    std::vector<float> depth(static_cast<size_t>(camera.width) *
+                             camera.height);
+    decoder.GetDepthImage(depth.data(), 0);
+    std::vector<float> positions(3 * decoder.num_points());
+    EXPECT_EQ(
+        decoder.GetPositions(positions.data(), 0, decoder.num_points()),
+        decoder.num_points());
+  }
+}
+
+}  // namespace draco
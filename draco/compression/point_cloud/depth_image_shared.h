@@ -0,0 +1,126 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_SHARED_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_SHARED_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace draco {
+
+// Shared definitions of DepthImageEncoder and DepthImageDecoder.
+//
+// Bitstream:
+//
+//   uint8   bitstream version
+//   varint  width
+//   varint  height
+//   float   fx, fy, cx, cy
+//   float   depth precision (size of a quantization step in depth units)
+//   uint8   DepthImageFlags
+//   bits    validity of each pixel XOR the validity of its left neighbor
+//           (upper neighbor in the first column), only present with
+//           DEPTH_IMAGE_FLAG_HAS_MASK (RAnsBit)
+//   uint32  checksum of the shared symbol table, only present with
+//           DEPTH_IMAGE_FLAG_SHARED_SYMBOL_TABLE
+//   symbols prediction residuals of the quantized depths of all valid pixels
+//           in row-major order (EncodeSymbols, or EncodeInterleavedSymbols
+//           with DEPTH_IMAGE_FLAG_INTERLEAVED_SYMBOLS, or
+//           EncodeInterleavedSymbols with the shared table and without a
+//           table in the frame with DEPTH_IMAGE_FLAG_SHARED_SYMBOL_TABLE)
+//
+// Quantized depths are predicted from their valid left, upper and upper-left
+// neighbors using the median edge detector of LOCO-I.
+
+constexpr uint8_t kDepthImageBitstreamVersion = 1;
+
+enum DepthImageFlags : uint8_t {
+  // Some pixels of the image are invalid.
+  DEPTH_IMAGE_FLAG_HAS_MASK = 1,
+  // The residuals are coded by the interleaved rANS coder, which decodes
+  // faster than the Draco symbol coding.
+  DEPTH_IMAGE_FLAG_INTERLEAVED_SYMBOLS = 2,
+  // The residuals are coded by the interleaved rANS coder with a table that
+  // is shared by all frames of a sequence and stored outside of the frames.
+  DEPTH_IMAGE_FLAG_SHARED_SYMBOL_TABLE = 4,
+};
+
+// Largest quantized depth value.
+constexpr uint32_t kDepthImageMaxQuantizedDepth = (1u << 30) - 1;
+
+// Pinhole camera of a depth image. A pixel (u, v) with depth d is the point
+// ((u - cx) * d / fx, (v - cy) * d / fy, d).
+struct DepthImageCamera {
+  int width = 0;
+  int height = 0;
+  float fx = 0.f;
+  float fy = 0.f;
+  float cx = 0.f;
+  float cy = 0.f;
+};
+
+// Names of the GeometryMetadata entries that store the camera of point clouds
+// created by DepthImageDecoder. The size is an int array {width, height} and
+// the intrinsics a double array {fx, fy, cx, cy}.
+constexpr char kDepthImageSizeMetadataName[] = "depth_image_size";
+constexpr char kDepthImageIntrinsicsMetadataName[] = "depth_image_intrinsics";
+
+// Returns the validity of pixel |i| = |y| * |width| + |x| predicted from its
+// left neighbor, or from its upper neighbor in the first column.
+inline bool PredictDepthImageValidity(const uint8_t *valid, int width, int x,
+                                      int y, size_t i) {
+  if (x > 0) {
+    return valid[i - 1] != 0;
+  }
+  return y > 0 ? valid[i - width] != 0 : true;
+}
+
+// Predicts the quantized depth of pixel |i| = |y| * |width| + |x| from its
+// valid left (a), upper (b) and upper-left (c) neighbors. |last| is the
+// previous valid depth in row-major order, used when no neighbor is valid.
+inline uint32_t PredictDepthImageValue(const uint32_t *depths,
+                                       const uint8_t *valid, int width, int x,
+                                       int y, size_t i, uint32_t last) {
+  const bool has_a = x > 0 && valid[i - 1];
+  const bool has_b = y > 0 && valid[i - width];
+  if (has_a && has_b) {
+    const uint32_t a = depths[i - 1];
+    const uint32_t b = depths[i - width];
+    if (!valid[i - width - 1]) {
+      return static_cast<uint32_t>((static_cast<uint64_t>(a) + b) / 2);
+    }
+    // Median edge detector.
+    const uint32_t c = depths[i - width - 1];
+    if (c >= std::max(a, b)) {
+      return std::min(a, b);
+    }
+    if (c <= std::min(a, b)) {
+      return std::max(a, b);
+    }
+    return a + b - c;
+  }
+  if (has_a) {
+    return depths[i - 1];
+  }
+  if (has_b) {
+    return depths[i - width];
+  }
+  return last;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_DEPTH_IMAGE_SHARED_H_
@@ -0,0 +1,105 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/octree_point_cloud_decoder.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "compression/point_cloud/decoded_point_cloud.h"
+#include "core/quantization_utils.h"
+
+namespace draco {
+
+OctreePointCloudDecoder::OctreePointCloudDecoder()
+    : max_depth_(-1),
+      max_num_bytes_(-1),
+      quantization_bits_(0),
+      origin_{0.f, 0.f, 0.f},
+      range_(1.f) {}
+
+Status OctreePointCloudDecoder::DecodePositions(DecoderBuffer *in_buffer) {
+  points_.clear();
+  uint8_t version;
+  uint8_t quantization_bits;
+  if (!in_buffer->Decode(&version) ||
+      !in_buffer->Decode(&quantization_bits) ||
+      !in_buffer->Decode(origin_, sizeof(origin_)) ||
+      !in_buffer->Decode(&range_)) {
+    return Status(Status::IO_ERROR, "Failed to parse header.");
+  }
+  if (version < 1 || version > kOctreePointCloudBitstreamVersion) {
+    return Status(Status::UNSUPPORTED_VERSION, "Unknown bitstream version.");
+  }
+  if (quantization_bits < 1 ||
+      quantization_bits > kOctreePointCloudMaxQuantizationBits ||
+      !std::isfinite(range_) || range_ <= 0.f) {
+    return Status(Status::IO_ERROR, "Invalid quantization grid.");
+  }
+  quantization_bits_ = quantization_bits;
+  int64_t max_tree_bytes = -1;
+  if (max_num_bytes_ >= 0) {
+    max_tree_bytes =
+        std::max<int64_t>(max_num_bytes_ - kOctreePointCloudHeaderSize, 0);
+  }
+  if (!octree_decoder_.DecodePoints(in_buffer, max_depth_, max_tree_bytes,
+                                    &points_)) {
+    points_.clear();
+    return Status(Status::IO_ERROR, "Failed to decode points.");
+  }
+  if (static_cast<int>(octree_decoder_.bit_length()) != quantization_bits_) {
+    points_.clear();
+    return Status(Status::IO_ERROR, "Invalid octree bit length.");
+  }
+  return OkStatus();
+}
+
+size_t OctreePointCloudDecoder::GetPositions(float *out_positions,
+                                             int64_t byte_stride,
+                                             size_t capacity) const {
+  if (byte_stride == 0) {
+    byte_stride = 3 * sizeof(float);
+  }
+  const size_t num_out_points = std::min(capacity, points_.size());
+  Dequantizer dequantizer;
+  if (!dequantizer.Init(range_, (1u << quantization_bits_) - 1)) {
+    return 0;
+  }
+  uint8_t *out = reinterpret_cast<uint8_t *>(out_positions);
+  for (size_t i = 0; i < num_out_points; ++i) {
+    float *const p = reinterpret_cast<float *>(out + byte_stride * i);
+    for (int c = 0; c < 3; ++c) {
+      p[c] = dequantizer.DequantizeFloat(points_[i][c]) + origin_[c];
+    }
+  }
+  return num_out_points;
+}
+
+std::unique_ptr<PointCloud> OctreePointCloudDecoder::CreatePointCloud() const {
+  return CreatePointCloud(nullptr);
+}
+
+std::unique_ptr<PointCloud> OctreePointCloudDecoder::CreatePointCloud(
+    FrameArena *arena) const {
+  std::unique_ptr<PointCloud> pc = CreatePositionsPointCloud(
+      points_.size(),
+      [this](float *out_positions, int64_t byte_stride,
+             size_t max_num_points) {
+        return GetPositions(out_positions, byte_stride, max_num_points);
+      },
+      arena);
+  return pc;
+}
+
+}  // namespace draco
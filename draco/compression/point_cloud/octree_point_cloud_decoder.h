@@ -0,0 +1,100 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_OCTREE_POINT_CLOUD_DECODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_OCTREE_POINT_CLOUD_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "compression/point_cloud/algorithms/octree_occupancy_decoder.h"
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "compression/point_cloud/octree_point_cloud_shared.h"
+#include "core/decoder_buffer.h"
+#include "core/frame_arena.h"
+#include "core/status.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Decodes point clouds encoded by OctreePointCloudEncoder up to a
+// requested level of detail. The level of detail is limited by the depth of
+// the decoded octree and by the number of bytes that may be read, e.g.
+// the part of a file that was loaded or streamed so far. Each decoded level
+// doubles the resolution along all axes.
+//
+// Usage (preview from the first 16kB of a file):
+//   OctreePointCloudDecoder decoder;
+//   decoder.SetMaxNumBytes(16 * 1024);
+//   DRACO_RETURN_IF_ERROR(decoder.DecodePositions(&buffer));
+//   std::unique_ptr<PointCloud> preview = decoder.CreatePointCloud();
+class OctreePointCloudDecoder {
+ public:
+  OctreePointCloudDecoder();
+
+  // Maximum number of decoded octree levels, negative for no limit.
+  void SetMaxDepth(int max_depth) { max_depth_ = max_depth; }
+
+  // Maximum number of bytes read from the input buffer, negative for no
+  // limit. The input buffer may be truncated after this many bytes.
+  void SetMaxNumBytes(int64_t max_num_bytes) {
+    max_num_bytes_ = max_num_bytes;
+  }
+
+  // Decodes the point cloud in |in_buffer| up to the configured level of
+  // detail.
+  Status DecodePositions(DecoderBuffer *in_buffer);
+
+  // Number of decoded points.
+  size_t num_points() const { return points_.size(); }
+
+  // Number of points of the encoded point cloud.
+  uint32_t num_encoded_points() const {
+    return octree_decoder_.num_encoded_points();
+  }
+
+  // Number of decoded and of all encoded octree levels.
+  int depth() const { return octree_decoder_.depth(); }
+  int num_levels() const { return octree_decoder_.num_levels(); }
+
+  // Returns true if the full resolution point cloud was decoded.
+  bool is_complete() const { return octree_decoder_.is_complete(); }
+
+  // Writes the decoded positions as float triplets that are |byte_stride|
+  // bytes apart (0 means tightly packed). At most |capacity| points are
+  // written. Returns the number of written points.
+  size_t GetPositions(float *out_positions, int64_t byte_stride,
+                      size_t capacity) const;
+
+  // Creates a point cloud with a POSITION attribute holding the decoded
+  // points.
+  std::unique_ptr<PointCloud> CreatePointCloud() const;
+  // Same as CreatePointCloud() but the storage of the attribute values is
+  // taken from the buffers recycled in |arena|, see RecyclePointCloud().
+  std::unique_ptr<PointCloud> CreatePointCloud(FrameArena *arena) const;
+
+ private:
+  int max_depth_;
+  int64_t max_num_bytes_;
+
+  int quantization_bits_;
+  float origin_[3];
+  float range_;
+  std::vector<Point3ui> points_;
+  OctreeOccupancyDecoder octree_decoder_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_OCTREE_POINT_CLOUD_DECODER_H_
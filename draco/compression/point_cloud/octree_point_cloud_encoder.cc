@@ -0,0 +1,98 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/octree_point_cloud_encoder.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "core/position_quantization.h"
+
+namespace draco {
+
+OctreePointCloudEncoder::OctreePointCloudEncoder() : quantization_bits_(11) {}
+
+Status OctreePointCloudEncoder::EncodePositions(
+    const float *positions, size_t num_points, int64_t byte_stride,
+    EncoderBuffer *out_buffer) {
+  if (positions == nullptr && num_points > 0) {
+    return Status(Status::INVALID_PARAMETER, "Missing position data.");
+  }
+  if (num_points > std::numeric_limits<uint32_t>::max()) {
+    return Status(Status::INVALID_PARAMETER, "Too many points.");
+  }
+  if (quantization_bits_ < 1 ||
+      quantization_bits_ > kOctreePointCloudMaxQuantizationBits) {
+    return Status(Status::INVALID_PARAMETER, "Invalid quantization bits.");
+  }
+  if (byte_stride == 0) {
+    byte_stride = 3 * sizeof(float);
+  }
+  if (byte_stride < static_cast<int64_t>(3 * sizeof(float))) {
+    return Status(Status::INVALID_PARAMETER, "Invalid byte stride.");
+  }
+  float min_values[3] = {0.f, 0.f, 0.f};
+  float max_values[3] = {0.f, 0.f, 0.f};
+  if (!ComputePositionBounds(positions, num_points, byte_stride, min_values,
+                             max_values)) {
+    return Status(Status::INVALID_PARAMETER, "Non-finite position.");
+  }
+  float range = 0.f;
+  for (int c = 0; c < 3; ++c) {
+    range = std::max(range, max_values[c] - min_values[c]);
+  }
+  if (range == 0.f) {
+    range = 1.f;
+  }
+
+  // All points lie within the grid, the bounds were computed from them.
+  points_.resize(num_points);
+  if (!QuantizePositions(positions, num_points, byte_stride, min_values, range,
+                         (1u << quantization_bits_) - 1, points_.data())) {
+    return ErrorStatus("Failed to quantize positions.");
+  }
+
+  out_buffer->Encode(kOctreePointCloudBitstreamVersion);
+  out_buffer->Encode(static_cast<uint8_t>(quantization_bits_));
+  out_buffer->Encode(min_values, sizeof(min_values));
+  out_buffer->Encode(range);
+  if (!octree_encoder_.EncodePoints(points_, quantization_bits_,
+                                    out_buffer)) {
+    return ErrorStatus("Failed to encode points.");
+  }
+  return OkStatus();
+}
+
+Status OctreePointCloudEncoder::EncodePointCloud(
+    const PointCloud &pc, EncoderBuffer *out_buffer) {
+  const PointAttribute *const att =
+      pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (att == nullptr || att->num_components() != 3) {
+    return Status(Status::INVALID_PARAMETER, "Missing position attribute.");
+  }
+  if (att->data_type() == DT_FLOAT32 && att->is_mapping_identity() &&
+      att->size() == pc.num_points()) {
+    const uint8_t *const data = att->GetAddress(AttributeValueIndex(0));
+    return EncodePositions(reinterpret_cast<const float *>(data),
+                           pc.num_points(), att->byte_stride(), out_buffer);
+  }
+  std::vector<float> positions(3 * static_cast<size_t>(pc.num_points()));
+  for (PointIndex i(0); i < pc.num_points(); ++i) {
+    att->ConvertValue<float, 3>(att->mapped_index(i),
+                                &positions[3 * i.value()]);
+  }
+  return EncodePositions(positions.data(), pc.num_points(), 0, out_buffer);
+}
+
+}  // namespace draco
@@ -0,0 +1,311 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "compression/point_cloud/octree_point_cloud_decoder.h"
+#include "compression/point_cloud/octree_point_cloud_encoder.h"
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class OctreePointCloudEncodingTest : public ::testing::Test {
+ protected:
+  OctreePointCloudEncodingTest() : rng_(5) {}
+
+  // Creates |num_points| random points with integer coordinates. The first
+  // two points span the whole grid, so the points are quantized without loss
+  // and the decoded positions must match exactly.
+  void CreatePoints(size_t num_points) {
+    const uint32_t max_value = (1u << kQuantizationBits) - 1;
+    positions_ = {0.f, 0.f, 0.f, static_cast<float>(max_value),
+                  static_cast<float>(max_value), static_cast<float>(max_value)};
+    std::uniform_int_distribution<uint32_t> dist(0, max_value);
+    while (positions_.size() < 3 * num_points) {
+      positions_.push_back(static_cast<float>(dist(rng_)));
+    }
+  }
+
+  // Creates points on a wavy surface like a depth camera frame, which is the
+  // data the neighbor contexts are made for.
+  void CreateSurfacePoints(int width, int height) {
+    const float max_value = static_cast<float>((1u << kQuantizationBits) - 1);
+    positions_.clear();
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        const float fx = static_cast<float>(x) / (width - 1);
+        const float fy = static_cast<float>(y) / (height - 1);
+        const float z = 0.5f + 0.4f * std::sin(6.f * fx) * std::cos(4.f * fy);
+        positions_.insert(positions_.end(),
+                          {std::round(fx * max_value),
+                           std::round(fy * max_value),
+                           std::round(z * max_value)});
+      }
+    }
+    // Make the grid span all axes.
+    positions_.insert(positions_.end(), {0.f, 0.f, 0.f});
+    positions_.insert(positions_.end(), {max_value, max_value, max_value});
+  }
+
+  void Encode(std::vector<char> *out_data) {
+    OctreePointCloudEncoder encoder;
+    encoder.SetQuantizationBits(kQuantizationBits);
+    EncoderBuffer buffer;
+    ASSERT_TRUE(encoder
+                    .EncodePositions(positions_.data(), positions_.size() / 3,
+                                     0, &buffer)
+                    .ok());
+    out_data->assign(buffer.data(), buffer.data() + buffer.size());
+  }
+
+  // Decodes the first |size| bytes of |data|.
+  static Status Decode(const std::vector<char> &data, size_t size,
+                       OctreePointCloudDecoder *decoder) {
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), size);
+    return decoder->DecodePositions(&buffer);
+  }
+
+  static std::vector<float> GetSortedPositions(
+      const OctreePointCloudDecoder &decoder) {
+    std::vector<float> positions(3 * decoder.num_points());
+    decoder.GetPositions(positions.data(), 0, decoder.num_points());
+    return SortPoints(positions);
+  }
+
+  static std::vector<float> SortPoints(const std::vector<float> &positions) {
+    std::vector<std::array<float, 3>> points(positions.size() / 3);
+    for (size_t i = 0; i < points.size(); ++i) {
+      points[i] = {positions[3 * i], positions[3 * i + 1],
+                   positions[3 * i + 2]};
+    }
+    std::sort(points.begin(), points.end());
+    std::vector<float> sorted;
+    for (const std::array<float, 3> &point : points) {
+      sorted.insert(sorted.end(), point.begin(), point.end());
+    }
+    return sorted;
+  }
+
+  static constexpr int kQuantizationBits = 8;
+
+  std::mt19937 rng_;
+  std::vector<float> positions_;
+};
+
+TEST_F(OctreePointCloudEncodingTest, TestRoundTrip) {
+  for (const size_t num_points : {2, 3, 100, 5000}) {
+    CreatePoints(num_points);
+    std::vector<char> data;
+    Encode(&data);
+    EXPECT_EQ(data[0], kOctreePointCloudBitstreamVersion);
+    OctreePointCloudDecoder decoder;
+    ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+    EXPECT_TRUE(decoder.is_complete());
+    EXPECT_EQ(decoder.depth(), kQuantizationBits);
+    EXPECT_EQ(decoder.num_encoded_points(), num_points);
+    EXPECT_EQ(GetSortedPositions(decoder), SortPoints(positions_));
+  }
+  CreateSurfacePoints(160, 120);
+  std::vector<char> data;
+  Encode(&data);
+  OctreePointCloudDecoder decoder;
+  ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+  EXPECT_EQ(GetSortedPositions(decoder), SortPoints(positions_));
+}
+
+TEST_F(OctreePointCloudEncodingTest, TestDuplicatePoints) {
+  CreatePoints(10);
+  // Each point is repeated a few times.
+  const std::vector<float> points = positions_;
+  for (int i = 0; i < 3; ++i) {
+    positions_.insert(positions_.end(), points.begin(), points.end());
+  }
+  // Many copies of a single point.
+  for (int i = 0; i < 1000; ++i) {
+    positions_.insert(positions_.end(), {7.f, 100.f, 31.f});
+  }
+  std::vector<char> data;
+  Encode(&data);
+  OctreePointCloudDecoder decoder;
+  ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+  EXPECT_EQ(GetSortedPositions(decoder), SortPoints(positions_));
+}
+
+TEST_F(OctreePointCloudEncodingTest, TestEmptyPointCloud) {
+  positions_.clear();
+  std::vector<char> data;
+  Encode(&data);
+  OctreePointCloudDecoder decoder;
+  ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+  EXPECT_EQ(decoder.num_points(), 0u);
+  EXPECT_EQ(decoder.num_encoded_points(), 0u);
+}
+
+TEST_F(OctreePointCloudEncodingTest, TestInvalidInput) {
+  OctreePointCloudEncoder encoder;
+  encoder.SetQuantizationBits(kOctreePointCloudMaxQuantizationBits + 1);
+  const float position[3] = {0.f, 0.f, 0.f};
+  EncoderBuffer buffer;
+  EXPECT_FALSE(encoder.EncodePositions(position, 1, 0, &buffer).ok());
+  encoder.SetQuantizationBits(0);
+  EXPECT_FALSE(encoder.EncodePositions(position, 1, 0, &buffer).ok());
+  const float invalid_position[3] = {0.f, NAN, 0.f};
+  encoder.SetQuantizationBits(kQuantizationBits);
+  EXPECT_FALSE(encoder.EncodePositions(invalid_position, 1, 0, &buffer).ok());
+}
+
+TEST_F(OctreePointCloudEncodingTest, TestLevelsOfDetail) {
+  CreateSurfacePoints(160, 120);
+  std::vector<char> data;
+  Encode(&data);
+  std::set<std::array<float, 3>> points;
+  for (size_t i = 0; i < positions_.size(); i += 3) {
+    points.insert({positions_[i], positions_[i + 1], positions_[i + 2]});
+  }
+  size_t last_num_points = 0;
+  for (int depth = 0; depth <= kQuantizationBits; ++depth) {
+    OctreePointCloudDecoder decoder;
+    decoder.SetMaxDepth(depth);
+    ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+    EXPECT_EQ(decoder.depth(), depth);
+    EXPECT_EQ(decoder.num_levels(), kQuantizationBits);
+    EXPECT_EQ(decoder.is_complete(), depth == kQuantizationBits);
+    // Each level refines the nodes of the previous one.
+    EXPECT_GE(decoder.num_points(), last_num_points);
+    EXPECT_LE(decoder.num_points(), decoder.num_encoded_points());
+    last_num_points = decoder.num_points();
+    if (depth == kQuantizationBits) {
+      continue;
+    }
+    // A point at the center of each occupied node of the level, or an
+    // encoded point for nodes that were coded directly.
+    const float node_size = static_cast<float>(1u << (kQuantizationBits -
+                                                      depth));
+    std::vector<float> positions(3 * decoder.num_points());
+    decoder.GetPositions(positions.data(), 0, decoder.num_points());
+    for (size_t i = 0; i < positions.size(); i += 3) {
+      if (points.count({positions[i], positions[i + 1], positions[i + 2]})) {
+        continue;
+      }
+      for (int c = 0; c < 3; ++c) {
+        const float offset = std::fmod(positions[i + c], node_size);
+        EXPECT_NEAR(offset, node_size / 2, 1e-3f) << depth;
+      }
+    }
+  }
+}
+
+TEST_F(OctreePointCloudEncodingTest, TestByteBudget) {
+  CreateSurfacePoints(160, 120);
+  std::vector<char> data;
+  Encode(&data);
+  // The budget must cover the header, the bit length and the varint coded
+  // number of points, which takes three bytes here.
+  ASSERT_GT(positions_.size() / 3, 1u << 14);
+  {
+    OctreePointCloudDecoder decoder;
+    decoder.SetMaxNumBytes(kOctreePointCloudHeaderSize + 3);
+    EXPECT_FALSE(
+        Decode(data, kOctreePointCloudHeaderSize + 3, &decoder).ok());
+  }
+  int last_depth = 0;
+  for (size_t size = kOctreePointCloudHeaderSize + 4; size < data.size();
+       size += 97) {
+    // The budget limits the data that is read, so the input may be truncated.
+    OctreePointCloudDecoder decoder;
+    decoder.SetMaxNumBytes(size);
+    ASSERT_TRUE(Decode(data, size, &decoder).ok()) << size;
+    EXPECT_GE(decoder.depth(), last_depth);
+    last_depth = decoder.depth();
+    EXPECT_FALSE(decoder.is_complete());
+  }
+  EXPECT_GT(last_depth, 0);
+  OctreePointCloudDecoder decoder;
+  decoder.SetMaxNumBytes(data.size());
+  ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+  EXPECT_TRUE(decoder.is_complete());
+  EXPECT_EQ(GetSortedPositions(decoder), SortPoints(positions_));
+}
+
+TEST_F(OctreePointCloudEncodingTest, TestTruncatedData) {
+  CreatePoints(300);
+  std::vector<char> data;
+  Encode(&data);
+  // Without a byte budget all levels are required.
+  for (size_t size = 0; size < data.size(); ++size) {
+    OctreePointCloudDecoder decoder;
+    ASSERT_FALSE(Decode(data, size, &decoder).ok()) << size;
+    EXPECT_EQ(decoder.num_points(), 0u);
+  }
+}
+
+TEST_F(OctreePointCloudEncodingTest, TestCorruptedData) {
+  CreatePoints(300);
+  std::vector<char> data;
+  Encode(&data);
+  const struct {
+    int offset;
+    char value;
+  } corruptions[] = {
+      {0, 0},  // Version.
+      {0, kOctreePointCloudBitstreamVersion + 1},
+      {1, 0},  // Quantization bits.
+      {1, kOctreePointCloudMaxQuantizationBits + 1},
+      {1, kQuantizationBits + 1},  // Does not match the octree.
+      {17, static_cast<char>(0xff)},  // Negative range.
+      {18, kOctreePointCloudMaxQuantizationBits + 1},  // Octree bit length.
+  };
+  for (const auto &corruption : corruptions) {
+    std::vector<char> corrupted = data;
+    corrupted[corruption.offset] = corruption.value;
+    OctreePointCloudDecoder decoder;
+    EXPECT_FALSE(Decode(corrupted, corrupted.size(), &decoder).ok())
+        << corruption.offset;
+    EXPECT_EQ(decoder.num_points(), 0u);
+  }
+  {
+    std::vector<char> corrupted = data;
+    corrupted[0] = kOctreePointCloudBitstreamVersion + 1;
+    OctreePointCloudDecoder decoder;
+    EXPECT_EQ(Decode(corrupted, corrupted.size(), &decoder).code(),
+              Status::UNSUPPORTED_VERSION);
+  }
+
+  // Flipped bits in the octree must not crash the decoder. They are not
+  // always detected, but the decoded points stay within the grid.
+  for (int i = 0; i < 500; ++i) {
+    std::vector<char> corrupted = data;
+    const size_t offset =
+        kOctreePointCloudHeaderSize +
+        rng_() % (data.size() - kOctreePointCloudHeaderSize);
+    corrupted[offset] ^= static_cast<char>(1 << (rng_() % 8));
+    OctreePointCloudDecoder decoder;
+    if (Decode(corrupted, corrupted.size(), &decoder).ok()) {
+      std::vector<float> positions(3 * decoder.num_points());
+      decoder.GetPositions(positions.data(), 0, decoder.num_points());
+      for (const float value : positions) {
+        ASSERT_GE(value, 0.f);
+        ASSERT_LE(value, static_cast<float>((1u << kQuantizationBits) - 1));
+      }
+    }
+  }
+}
+
+}  // namespace draco
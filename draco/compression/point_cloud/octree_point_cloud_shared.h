@@ -0,0 +1,47 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_OCTREE_POINT_CLOUD_SHARED_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_OCTREE_POINT_CLOUD_SHARED_H_
+
+#include <cstdint>
+
+#include "compression/point_cloud/algorithms/octree_occupancy_coding.h"
+
+namespace draco {
+
+// Shared constants of OctreePointCloudEncoder and OctreePointCloudDecoder.
+//
+// Bitstream:
+//
+//   uint8   bitstream version
+//   uint8   quantization bits
+//   float   origin[3]
+//   float   range
+//   octree coded points (OctreeOccupancyEncoder)
+//
+// The octree data is ordered coarse to fine, so the header together with any
+// number of complete octree levels can be decoded.
+
+constexpr uint8_t kOctreePointCloudBitstreamVersion = 1;
+
+// Size of the bitstream header in bytes.
+constexpr int64_t kOctreePointCloudHeaderSize = 18;
+
+// The Morton codes of the octree nodes hold 3 * 21 bits.
+constexpr int kOctreePointCloudMaxQuantizationBits = kOctreeMaxBitLength;
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_OCTREE_POINT_CLOUD_SHARED_H_
@@ -0,0 +1,86 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/point_cloud_region_query.h"
+
+namespace draco {
+
+PointCloudRegionQuery PointCloudRegionQuery::FromBox(const float min[3],
+                                                     const float max[3]) {
+  PointCloudRegionQuery query;
+  for (int c = 0; c < 3; ++c) {
+    float normal[3] = {0.f, 0.f, 0.f};
+    normal[c] = 1.f;
+    query.AddPlane(normal[0], normal[1], normal[2], -min[c]);
+    query.AddPlane(-normal[0], -normal[1], -normal[2], max[c]);
+  }
+  return query;
+}
+
+PointCloudRegionQuery PointCloudRegionQuery::FromPlanes(
+    const float (*planes)[4], int num_planes) {
+  PointCloudRegionQuery query;
+  for (int i = 0; i < num_planes; ++i) {
+    query.AddPlane(planes[i][0], planes[i][1], planes[i][2], planes[i][3]);
+  }
+  return query;
+}
+
+void PointCloudRegionQuery::AddPlane(float a, float b, float c, float d) {
+  const Plane plane = {{a, b, c}, d};
+  planes_.push_back(plane);
+}
+
+bool PointCloudRegionQuery::ContainsPoint(const float point[3]) const {
+  for (const Plane &plane : planes_) {
+    if (plane.normal[0] * point[0] + plane.normal[1] * point[1] +
+            plane.normal[2] * point[2] + plane.offset <
+        0.f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PointCloudRegionQuery::IntersectsBox(const float min[3],
+                                          const float max[3]) const {
+  for (const Plane &plane : planes_) {
+    // The corner of the box that is farthest inside of the plane.
+    float distance = plane.offset;
+    for (int c = 0; c < 3; ++c) {
+      distance += plane.normal[c] * (plane.normal[c] >= 0.f ? max[c] : min[c]);
+    }
+    if (distance < 0.f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PointCloudRegionQuery::ContainsBox(const float min[3],
+                                        const float max[3]) const {
+  for (const Plane &plane : planes_) {
+    // The corner of the box that is farthest outside of the plane.
+    float distance = plane.offset;
+    for (int c = 0; c < 3; ++c) {
+      distance += plane.normal[c] * (plane.normal[c] >= 0.f ? min[c] : max[c]);
+    }
+    if (distance < 0.f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,68 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_REGION_QUERY_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_REGION_QUERY_H_
+
+#include <vector>
+
+namespace draco {
+
+// Convex region of space used to decode a subset of a point cloud, e.g. an
+// axis-aligned box or a camera frustum. The region is the intersection of
+// half-spaces a * x + b * y + c * z + d >= 0.
+class PointCloudRegionQuery {
+ public:
+  // Creates a query without planes that contains all points.
+  PointCloudRegionQuery() {}
+
+  // Creates a query for the axis-aligned box [min, max], including its
+  // boundary.
+  static PointCloudRegionQuery FromBox(const float min[3], const float max[3]);
+
+  // Creates a query from |num_planes| planes with four coefficients each,
+  // e.g. the six planes of a frustum extracted from a view-projection matrix
+  // with their normals pointing inwards.
+  static PointCloudRegionQuery FromPlanes(const float (*planes)[4],
+                                          int num_planes);
+
+  // Adds the half-space a * x + b * y + c * z + d >= 0 to the region.
+  void AddPlane(float a, float b, float c, float d);
+
+  // Returns true if |point| lies inside of the region.
+  bool ContainsPoint(const float point[3]) const;
+
+  // Returns false if the axis-aligned box [min, max] lies completely outside
+  // of one of the planes. The test is conservative: for regions that are not
+  // boxes it can return true for a few boxes near the edges of the region
+  // that don't intersect it.
+  bool IntersectsBox(const float min[3], const float max[3]) const;
+
+  // Returns true if the axis-aligned box [min, max] lies completely inside of
+  // the region.
+  bool ContainsBox(const float min[3], const float max[3]) const;
+
+  int num_planes() const { return static_cast<int>(planes_.size()); }
+
+ private:
+  struct Plane {
+    float normal[3];
+    float offset;
+  };
+  std::vector<Plane> planes_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_REGION_QUERY_H_
@@ -0,0 +1,623 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/point_cloud_sequence_decoder.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "compression/bit_coders/rans_bit_decoder.h"
+#include "compression/config/compression_shared.h"
+#include "compression/point_cloud/algorithms/points_kd_tree_decoder_3.h"
+#include "compression/point_cloud/decoded_point_cloud.h"
+#include "core/quantization_utils.h"
+#include "core/varint_decoding.h"
+
+namespace draco {
+
+namespace {
+
+// Output iterator that collects the points produced by the kd-tree decoder
+// and optionally passes them on to |positions|.
+class Point3uiBackInserter {
+ public:
+  Point3uiBackInserter(std::vector<Point3ui> *points,
+                       DequantizingPointsOutputIterator *positions)
+      : points_(points), positions_(positions) {}
+
+  Point3uiBackInserter &operator*() { return *this; }
+  Point3uiBackInserter &operator++() { return *this; }
+  Point3uiBackInserter &operator++(int) { return *this; }
+
+  Point3uiBackInserter &operator=(const Point3ui &point) {
+    points_->push_back(point);
+    if (positions_ != nullptr) {
+      positions_->Write(point[0], point[1], point[2]);
+    }
+    return *this;
+  }
+
+ private:
+  std::vector<Point3ui> *points_;
+  DequantizingPointsOutputIterator *positions_;
+};
+
+template <int compression_level_t>
+bool DecodeKdTree(DecoderBuffer *in_buffer, std::vector<Point3ui> *points,
+                  DequantizingPointsOutputIterator *positions) {
+  PointsKdTreeDecoder3<compression_level_t> decoder;
+  Point3uiBackInserter oit(points, positions);
+  return decoder.DecodePoints(in_buffer, oit);
+}
+
+// Returns the number of points stored at the start of kd-tree coded data.
+bool PeekKdTreeNumPoints(const char *data, size_t size,
+                         uint32_t *out_num_points) {
+  DecoderBuffer buffer;
+  buffer.Init(data, size);
+  uint32_t bit_length;
+  return buffer.Decode(&bit_length) && buffer.Decode(out_num_points);
+}
+
+// Removes the points whose dequantized positions lie outside of |region|.
+void FilterPoints(const PointCloudRegionQuery &region,
+                  const Dequantizer &dequantizer, const float origin[3],
+                  std::vector<Point3ui> *points) {
+  size_t num_kept = 0;
+  for (const Point3ui &p : *points) {
+    float position[3];
+    for (int c = 0; c < 3; ++c) {
+      position[c] = dequantizer.DequantizeFloat(p[c]) + origin[c];
+    }
+    if (region.ContainsPoint(position)) {
+      (*points)[num_kept++] = p;
+    }
+  }
+  points->resize(num_kept);
+}
+
+}  // namespace
+
+PointCloudSequenceDecoder::PointCloudSequenceDecoder()
+    : positions_output_(nullptr),
+      region_(nullptr),
+      region_filtered_(false),
+      num_threads_(1),
+      version_(0),
+      compression_level_(0),
+      quantization_bits_(0),
+      grid_origin_{0.f, 0.f, 0.f},
+      grid_range_(1.f),
+      has_frame_(false),
+      is_key_frame_(false) {}
+
+Status PointCloudSequenceDecoder::DecodeFrame(DecoderBuffer *in_buffer) {
+  // The bit coders select their format by the Draco bitstream version, the
+  // frames are written with the current one.
+  in_buffer->set_bitstream_version(kDracoPointCloudBitstreamVersion);
+  uint8_t version;
+  uint8_t frame_type;
+  uint8_t compression_level;
+  if (!in_buffer->Decode(&version) || !in_buffer->Decode(&frame_type) ||
+      !in_buffer->Decode(&compression_level)) {
+    return Status(Status::IO_ERROR, "Failed to parse frame header.");
+  }
+  if (version < 1 || version > kPointCloudSequenceBitstreamVersion) {
+    return Status(Status::UNSUPPORTED_VERSION, "Unknown frame version.");
+  }
+  if (compression_level > 6) {
+    return Status(Status::IO_ERROR, "Invalid compression level.");
+  }
+  version_ = version;
+  compression_level_ = compression_level;
+  Status status;
+  if (frame_type == POINT_CLOUD_SEQUENCE_KEY_FRAME) {
+    status = DecodeKeyFrame(in_buffer);
+  } else if (frame_type == POINT_CLOUD_SEQUENCE_PREDICTED_FRAME) {
+    if (!has_frame_) {
+      return Status(Status::INVALID_PARAMETER,
+                    "Predicted frame without a reference frame.");
+    }
+    status = DecodePredictedFrame(in_buffer);
+  } else {
+    return Status(Status::IO_ERROR, "Unknown frame type.");
+  }
+  if (!status.ok()) {
+    // A partially decoded frame can't be used as a reference.
+    Reset();
+    return status;
+  }
+  has_frame_ = true;
+  is_key_frame_ = frame_type == POINT_CLOUD_SEQUENCE_KEY_FRAME;
+  return OkStatus();
+}
+
+Status PointCloudSequenceDecoder::DecodeFrame(
+    DecoderBuffer *in_buffer, const PositionsOutputLayout &layout,
+    size_t capacity, PointCloudSequencePointOrder order) {
+  const PositionsOutput output = {layout, capacity, order};
+  positions_output_ = &output;
+  const Status status = DecodeFrame(in_buffer);
+  positions_output_ = nullptr;
+  DRACO_RETURN_IF_ERROR(status);
+  if (points_.size() > capacity) {
+    return Status(Status::INVALID_PARAMETER, "Output buffer too small.");
+  }
+  return OkStatus();
+}
+
+Status PointCloudSequenceDecoder::DecodeFrameRegion(
+    DecoderBuffer *in_buffer, const PointCloudRegionQuery &region,
+    const PositionsOutputLayout &layout, size_t capacity,
+    size_t *out_num_points) {
+  region_ = &region;
+  region_filtered_ = false;
+  const Status status = DecodeFrame(in_buffer);
+  region_ = nullptr;
+  DRACO_RETURN_IF_ERROR(status);
+  DequantizingPointsOutputIterator positions(layout, capacity, grid_origin_,
+                                             grid_range_,
+                                             (1u << quantization_bits_) - 1);
+  if (region_filtered_) {
+    for (const Point3ui &p : points_) {
+      positions.Write(p[0], p[1], p[2]);
+    }
+    Reset();
+  } else {
+    Dequantizer dequantizer;
+    if (!dequantizer.Init(grid_range_, (1u << quantization_bits_) - 1)) {
+      return Status(Status::DRACO_ERROR, "Invalid quantization grid.");
+    }
+    for (const Point3ui &p : points_) {
+      float position[3];
+      for (int c = 0; c < 3; ++c) {
+        position[c] = dequantizer.DequantizeFloat(p[c]) + grid_origin_[c];
+      }
+      if (region.ContainsPoint(position)) {
+        positions.Write(p[0], p[1], p[2]);
+      }
+    }
+  }
+  *out_num_points = positions.index();
+  if (positions.index() > capacity) {
+    return Status(Status::INVALID_PARAMETER, "Output buffer too small.");
+  }
+  return OkStatus();
+}
+
+bool PointCloudSequenceDecoder::IsKeyFrame(const DecoderBuffer &in_buffer) {
+  if (in_buffer.remaining_size() < 2) {
+    return false;
+  }
+  return static_cast<uint8_t>(in_buffer.data_head()[1]) ==
+         POINT_CLOUD_SEQUENCE_KEY_FRAME;
+}
+
+size_t PointCloudSequenceDecoder::GetPositions(float *out_positions,
+                                               int64_t byte_stride,
+                                               size_t capacity) const {
+  if (byte_stride == 0) {
+    byte_stride = 3 * sizeof(float);
+  }
+  const size_t num_out_points = std::min(capacity, points_.size());
+  Dequantizer dequantizer;
+  if (!dequantizer.Init(grid_range_, (1u << quantization_bits_) - 1)) {
+    return 0;
+  }
+  uint8_t *out = reinterpret_cast<uint8_t *>(out_positions);
+  for (size_t i = 0; i < num_out_points; ++i) {
+    float *const p = reinterpret_cast<float *>(out + byte_stride * i);
+    for (int c = 0; c < 3; ++c) {
+      p[c] = dequantizer.DequantizeFloat(points_[i][c]) + grid_origin_[c];
+    }
+  }
+  return num_out_points;
+}
+
+std::unique_ptr<PointCloud> PointCloudSequenceDecoder::CreatePointCloud()
+    const {
+  return CreatePointCloud(nullptr);
+}
+
+std::unique_ptr<PointCloud> PointCloudSequenceDecoder::CreatePointCloud(
+    FrameArena *arena) const {
+  std::unique_ptr<PointCloud> pc = CreatePositionsPointCloud(
+      points_.size(),
+      [this](float *out_positions, int64_t byte_stride,
+             size_t max_num_points) {
+        return GetPositions(out_positions, byte_stride, max_num_points);
+      },
+      arena);
+  return pc;
+}
+
+void PointCloudSequenceDecoder::Reset() {
+  points_.clear();
+  has_frame_ = false;
+  is_key_frame_ = false;
+}
+
+Status PointCloudSequenceDecoder::DecodeKeyFrame(DecoderBuffer *in_buffer) {
+  uint8_t quantization_bits;
+  if (!in_buffer->Decode(&quantization_bits) ||
+      !in_buffer->Decode(grid_origin_, sizeof(grid_origin_)) ||
+      !in_buffer->Decode(&grid_range_)) {
+    return Status(Status::IO_ERROR, "Failed to parse key frame.");
+  }
+  if (quantization_bits < 1 ||
+      quantization_bits > kPointCloudSequenceMaxQuantizationBits ||
+      !std::isfinite(grid_range_) || grid_range_ <= 0.f) {
+    return Status(Status::IO_ERROR, "Invalid quantization grid.");
+  }
+  quantization_bits_ = quantization_bits;
+  if (positions_output_ == nullptr) {
+    DRACO_RETURN_IF_ERROR(
+        DecodeAddedPoints(in_buffer, region_, nullptr, nullptr));
+  } else {
+    DequantizingPointsOutputIterator positions = CreatePositionsIterator();
+    const bool sorted =
+        positions_output_->order == POINT_CLOUD_SEQUENCE_SORTED_ORDER;
+    DRACO_RETURN_IF_ERROR(DecodeAddedPoints(in_buffer, region_,
+                                            sorted ? nullptr : &positions,
+                                            sorted ? &positions : nullptr));
+  }
+  points_.swap(added_points_);
+  return OkStatus();
+}
+
+Status PointCloudSequenceDecoder::DecodePredictedFrame(
+    DecoderBuffer *in_buffer) {
+  uint32_t num_reference_points;
+  if (!DecodeVarint(&num_reference_points, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to parse predicted frame.");
+  }
+  if (num_reference_points != points_.size()) {
+    return Status(Status::IO_ERROR, "Reference frame mismatch.");
+  }
+  // With decoding order the kept points are written first, followed by the
+  // added points. With sorted order all points are written by the merge.
+  DequantizingPointsOutputIterator positions = CreatePositionsIterator();
+  const bool decoding_order =
+      positions_output_ != nullptr &&
+      positions_output_->order == POINT_CLOUD_SEQUENCE_DECODING_ORDER;
+  const bool sorted_order =
+      positions_output_ != nullptr &&
+      positions_output_->order == POINT_CLOUD_SEQUENCE_SORTED_ORDER;
+
+  // Remove the points that are not kept in place. Keeping the sorted order
+  // allows a linear merge with the added points below.
+  removed_points_.clear();
+  if (num_reference_points > 0) {
+    RAnsBitDecoder kept_decoder;
+    if (!kept_decoder.StartDecoding(in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to decode kept points.");
+    }
+    size_t num_kept = 0;
+    for (size_t i = 0; i < points_.size(); ++i) {
+      const Point3ui p = points_[i];
+      if (kept_decoder.DecodeNextBit()) {
+        if (decoding_order) {
+          positions.Write(p[0], p[1], p[2]);
+        }
+        points_[num_kept++] = p;
+      } else {
+        removed_points_.push_back(p);
+      }
+    }
+    kept_decoder.EndDecoding();
+    points_.resize(num_kept);
+  }
+  if (version_ >= 4 && !removed_points_.empty()) {
+    DRACO_RETURN_IF_ERROR(DecodeMovedPoints(in_buffer));
+    if (!moved_points_.empty()) {
+      if (decoding_order) {
+        for (const Point3ui &p : moved_points_) {
+          positions.Write(p[0], p[1], p[2]);
+        }
+      }
+      std::sort(moved_points_.begin(), moved_points_.end());
+      merged_points_.resize(points_.size() + moved_points_.size());
+      std::merge(points_.begin(), points_.end(), moved_points_.begin(),
+                 moved_points_.end(), merged_points_.begin());
+      points_.swap(merged_points_);
+    }
+  }
+  // The complete frame is the reference of the next one, so no cells are
+  // skipped here.
+  DRACO_RETURN_IF_ERROR(DecodeAddedPoints(
+      in_buffer, nullptr, decoding_order ? &positions : nullptr, nullptr));
+  merged_points_.resize(points_.size() + added_points_.size());
+  if (sorted_order) {
+    // Same as std::merge() below, with the positions written on the way.
+    size_t kept = 0;
+    size_t added = 0;
+    for (Point3ui &merged : merged_points_) {
+      if (added == added_points_.size() ||
+          (kept < points_.size() && !(added_points_[added] < points_[kept]))) {
+        merged = points_[kept++];
+      } else {
+        merged = added_points_[added++];
+      }
+      positions.Write(merged[0], merged[1], merged[2]);
+    }
+  } else {
+    std::merge(points_.begin(), points_.end(), added_points_.begin(),
+               added_points_.end(), merged_points_.begin());
+  }
+  points_.swap(merged_points_);
+  return OkStatus();
+}
+
+Status PointCloudSequenceDecoder::DecodeMovedPoints(
+    DecoderBuffer *in_buffer) {
+  moved_points_.clear();
+  RAnsBitDecoder moved_decoder;
+  if (!moved_decoder.StartDecoding(in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to decode moved points.");
+  }
+  for (const Point3ui &p : removed_points_) {
+    if (moved_decoder.DecodeNextBit()) {
+      moved_points_.push_back(p);
+    }
+  }
+  moved_decoder.EndDecoding();
+  if (moved_points_.empty()) {
+    return OkStatus();
+  }
+  RAnsBitDecoder axis_decoder;
+  RAnsBitDecoder sign_decoder;
+  if (!axis_decoder.StartDecoding(in_buffer) ||
+      !sign_decoder.StartDecoding(in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to decode moved points.");
+  }
+  // The moved points must stay on the grid and differ from their reference.
+  const uint32_t max_value = (1u << quantization_bits_) - 1;
+  for (Point3ui &p : moved_points_) {
+    int num_moved_axes = 0;
+    for (int c = 0; c < 3; ++c) {
+      if (!axis_decoder.DecodeNextBit()) {
+        continue;
+      }
+      ++num_moved_axes;
+      const bool decrease = sign_decoder.DecodeNextBit();
+      if (p[c] == (decrease ? 0 : max_value)) {
+        return Status(Status::IO_ERROR, "Invalid moved point.");
+      }
+      p[c] = decrease ? p[c] - 1 : p[c] + 1;
+    }
+    if (num_moved_axes == 0) {
+      return Status(Status::IO_ERROR, "Invalid moved point.");
+    }
+  }
+  axis_decoder.EndDecoding();
+  sign_decoder.EndDecoding();
+  return OkStatus();
+}
+
+Status PointCloudSequenceDecoder::DecodeAddedPoints(
+    DecoderBuffer *in_buffer, const PointCloudRegionQuery *region,
+    DequantizingPointsOutputIterator *decoding_order_output,
+    DequantizingPointsOutputIterator *sorted_output) {
+  added_points_.clear();
+  uint32_t num_subtrees = 1;
+  if (version_ >= 2) {
+    if (!DecodeVarint(&num_subtrees, in_buffer) || num_subtrees < 1 ||
+        num_subtrees > (1u << kPointCloudSequenceMaxSubtreeDepth)) {
+      return Status(Status::IO_ERROR, "Invalid number of subtrees.");
+    }
+  }
+  if (num_subtrees == 1) {
+    if (!DecodeSubtree(in_buffer, &added_points_, decoding_order_output)) {
+      return Status(Status::IO_ERROR, "Failed to decode points.");
+    }
+    // The kd-tree coder does not preserve the order of the points.
+    std::sort(added_points_.begin(), added_points_.end());
+    if (sorted_output != nullptr) {
+      for (const Point3ui &p : added_points_) {
+        sorted_output->Write(p[0], p[1], p[2]);
+      }
+    }
+    return OkStatus();
+  }
+  uint8_t layout = POINT_CLOUD_SEQUENCE_SORTED_RUNS;
+  if (version_ >= 3 && !in_buffer->Decode(&layout)) {
+    return Status(Status::IO_ERROR, "Failed to parse subtree layout.");
+  }
+  const bool spatial_cells = layout == POINT_CLOUD_SEQUENCE_SPATIAL_CELLS;
+  int cell_depth = 0;
+  if (spatial_cells) {
+    while ((1u << cell_depth) < num_subtrees) {
+      ++cell_depth;
+    }
+    if ((1u << cell_depth) != num_subtrees ||
+        cell_depth > 3 * quantization_bits_) {
+      return Status(Status::IO_ERROR, "Invalid number of spatial cells.");
+    }
+  } else if (layout != POINT_CLOUD_SEQUENCE_SORTED_RUNS) {
+    return Status(Status::IO_ERROR, "Unknown subtree layout.");
+  } else {
+    // Sorted runs can't be skipped.
+    region = nullptr;
+  }
+  Dequantizer dequantizer;
+  if (region != nullptr) {
+    if (!dequantizer.Init(grid_range_, (1u << quantization_bits_) - 1)) {
+      return Status(Status::IO_ERROR, "Invalid quantization grid.");
+    }
+    region_filtered_ = true;
+  }
+
+  std::vector<uint32_t> subtree_sizes(num_subtrees);
+  uint64_t total_size = 0;
+  for (uint32_t i = 0; i < num_subtrees; ++i) {
+    if (!DecodeVarint(&subtree_sizes[i], in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to parse subtree sizes.");
+    }
+    total_size += subtree_sizes[i];
+  }
+  if (total_size > static_cast<uint64_t>(in_buffer->remaining_size())) {
+    return Status(Status::IO_ERROR, "Invalid subtree size.");
+  }
+  const char *const data = in_buffer->data_head();
+  in_buffer->Advance(total_size);
+
+  subtree_points_.resize(num_subtrees);
+  subtree_status_.assign(num_subtrees, 0);
+  std::vector<uint64_t> subtree_offsets(num_subtrees, 0);
+  for (uint32_t i = 1; i < num_subtrees; ++i) {
+    subtree_offsets[i] = subtree_offsets[i - 1] + subtree_sizes[i - 1];
+  }
+  // In decoding order each subtree writes its positions after the ones of the
+  // preceding subtrees, so their number of points is needed up front.
+  std::vector<uint32_t> subtree_num_points(num_subtrees, 0);
+  std::vector<DequantizingPointsOutputIterator> subtree_outputs;
+  if (decoding_order_output != nullptr) {
+    subtree_outputs.reserve(num_subtrees);
+    for (uint32_t i = 0; i < num_subtrees; ++i) {
+      if (!PeekKdTreeNumPoints(data + subtree_offsets[i], subtree_sizes[i],
+                               &subtree_num_points[i])) {
+        return Status(Status::IO_ERROR, "Failed to decode points.");
+      }
+      subtree_outputs.push_back(*decoding_order_output);
+      decoding_order_output->Skip(subtree_num_points[i]);
+    }
+  }
+  const auto decode_subtree = [&](int subtree) {
+    bool contained = true;
+    if (region != nullptr &&
+        !SubtreeIntersectsRegion(*region, subtree, cell_depth, &contained)) {
+      subtree_points_[subtree].clear();
+      subtree_status_[subtree] = 1;
+      return;
+    }
+    DecoderBuffer buffer;
+    buffer.Init(data + subtree_offsets[subtree], subtree_sizes[subtree],
+                kDracoPointCloudBitstreamVersion);
+    std::vector<Point3ui> *const points = &subtree_points_[subtree];
+    points->clear();
+    DequantizingPointsOutputIterator *const positions =
+        subtree_outputs.empty() ? nullptr : &subtree_outputs[subtree];
+    if (DecodeSubtree(&buffer, points, positions) &&
+        (positions == nullptr ||
+         points->size() == subtree_num_points[subtree])) {
+      if (!contained) {
+        FilterPoints(*region, dequantizer, grid_origin_, points);
+      }
+      std::sort(points->begin(), points->end());
+      subtree_status_[subtree] = 1;
+    }
+  };
+  if (num_threads_ > 1) {
+    if (thread_pool_ == nullptr ||
+        thread_pool_->num_threads() != num_threads_) {
+      thread_pool_.reset(new ThreadPool(num_threads_));
+    }
+    thread_pool_->Run(static_cast<int>(num_subtrees), decode_subtree);
+  } else {
+    for (uint32_t i = 0; i < num_subtrees; ++i) {
+      decode_subtree(static_cast<int>(i));
+    }
+  }
+  size_t num_points = 0;
+  for (uint32_t i = 0; i < num_subtrees; ++i) {
+    if (!subtree_status_[i]) {
+      return Status(Status::IO_ERROR, "Failed to decode points.");
+    }
+    num_points += subtree_points_[i].size();
+  }
+  added_points_.reserve(num_points);
+  run_offsets_.assign(1, 0);
+  for (uint32_t i = 0; i < num_subtrees; ++i) {
+    added_points_.insert(added_points_.end(), subtree_points_[i].begin(),
+                         subtree_points_[i].end());
+    run_offsets_.push_back(added_points_.size());
+  }
+  if (spatial_cells) {
+    // The cells overlap in the sorted order, so the sorted cells are merged
+    // pairwise until a single run is left.
+    for (size_t width = 1; width < num_subtrees; width *= 2) {
+      for (size_t i = 0; i + width < num_subtrees; i += 2 * width) {
+        const size_t end = std::min<size_t>(i + 2 * width, num_subtrees);
+        std::inplace_merge(added_points_.begin() + run_offsets_[i],
+                           added_points_.begin() + run_offsets_[i + width],
+                           added_points_.begin() + run_offsets_[end]);
+      }
+    }
+  }
+  // Otherwise each subtree holds a consecutive run of the sorted points, so
+  // sorting the subtrees separately was enough.
+  if (sorted_output != nullptr) {
+    for (const Point3ui &p : added_points_) {
+      sorted_output->Write(p[0], p[1], p[2]);
+    }
+  }
+  return OkStatus();
+}
+
+bool PointCloudSequenceDecoder::DecodeSubtree(
+    DecoderBuffer *in_buffer, std::vector<Point3ui> *out_points,
+    DequantizingPointsOutputIterator *out_positions) const {
+  switch (compression_level_) {
+    case 0:
+      return DecodeKdTree<0>(in_buffer, out_points, out_positions);
+    case 1:
+      return DecodeKdTree<1>(in_buffer, out_points, out_positions);
+    case 2:
+      return DecodeKdTree<2>(in_buffer, out_points, out_positions);
+    case 3:
+      return DecodeKdTree<3>(in_buffer, out_points, out_positions);
+    case 4:
+      return DecodeKdTree<4>(in_buffer, out_points, out_positions);
+    case 5:
+      return DecodeKdTree<5>(in_buffer, out_points, out_positions);
+    case 6:
+      return DecodeKdTree<6>(in_buffer, out_points, out_positions);
+  }
+  return false;
+}
+
+bool PointCloudSequenceDecoder::SubtreeIntersectsRegion(
+    const PointCloudRegionQuery &region, uint32_t subtree, int depth,
+    bool *out_contained) const {
+  Point3ui min_value;
+  Point3ui max_value;
+  GetSpatialSubtreeBounds(subtree, depth, quantization_bits_, &min_value,
+                          &max_value);
+  Dequantizer dequantizer;
+  dequantizer.Init(grid_range_, (1u << quantization_bits_) - 1);
+  float min_position[3];
+  float max_position[3];
+  for (int c = 0; c < 3; ++c) {
+    min_position[c] =
+        dequantizer.DequantizeFloat(min_value[c]) + grid_origin_[c];
+    max_position[c] =
+        dequantizer.DequantizeFloat(max_value[c]) + grid_origin_[c];
+  }
+  *out_contained = region.ContainsBox(min_position, max_position);
+  return *out_contained || region.IntersectsBox(min_position, max_position);
+}
+
+DequantizingPointsOutputIterator
+PointCloudSequenceDecoder::CreatePositionsIterator() const {
+  static const PositionsOutput kNoOutput = {
+      PositionsOutputLayout::Planar(nullptr, nullptr, nullptr), 0,
+      POINT_CLOUD_SEQUENCE_SORTED_ORDER};
+  const PositionsOutput &output =
+      positions_output_ != nullptr ? *positions_output_ : kNoOutput;
+  return DequantizingPointsOutputIterator(output.layout, output.capacity,
+                                          grid_origin_, grid_range_,
+                                          (1u << quantization_bits_) - 1);
+}
+
+}  // namespace draco
@@ -0,0 +1,184 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_DECODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "compression/point_cloud/algorithms/dequantizing_points_output_iterator.h"
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "compression/point_cloud/point_cloud_region_query.h"
+#include "compression/point_cloud/point_cloud_sequence_shared.h"
+#include "core/decoder_buffer.h"
+#include "core/frame_arena.h"
+#include "core/status.h"
+#include "core/thread_pool.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Order of the positions written by PointCloudSequenceDecoder::DecodeFrame().
+enum PointCloudSequencePointOrder {
+  // Same order as GetPositions(), the quantized points in ascending order.
+  POINT_CLOUD_SEQUENCE_SORTED_ORDER = 0,
+  // Order in which the points are decoded: the points kept from the previous
+  // frame, the points moved to a neighboring cell and the new points in the
+  // order of the kd-tree leaves.
+  // Cells of the tree are contiguous in this order. The positions are
+  // written while the kd-tree is expanded.
+  POINT_CLOUD_SEQUENCE_DECODING_ORDER,
+};
+
+// Decodes frames encoded by PointCloudSequenceEncoder. Predicted frames
+// depend on the previously decoded frame, so the frames of a sequence must be
+// passed to DecodeFrame() in order. Decoding can start (or restart after a
+// seek) at any key frame.
+class PointCloudSequenceDecoder {
+ public:
+  PointCloudSequenceDecoder();
+
+  // Number of threads decoding the subtrees of a frame, including the
+  // calling thread.
+  void SetNumThreads(int num_threads) { num_threads_ = num_threads; }
+
+  // Decodes the next frame of the sequence and makes it the current frame.
+  // Returns an error when a predicted frame is decoded without a preceding
+  // key frame.
+  Status DecodeFrame(DecoderBuffer *in_buffer);
+
+  // Same as DecodeFrame() but also writes the dequantized positions of the
+  // frame to |layout| while it is reconstructed, which saves the separate
+  // pass of GetPositions(). Returns an error if the frame has more than
+  // |capacity| points, in which case the frame is still decoded but
+  // |layout| holds only the first |capacity| points.
+  Status DecodeFrame(DecoderBuffer *in_buffer,
+                     const PositionsOutputLayout &layout, size_t capacity,
+                     PointCloudSequencePointOrder order);
+
+  // Decodes the next frame and writes the dequantized positions of its points
+  // inside |region| to |layout| in sorted order. At most |capacity| points
+  // are written, their total number is returned in |out_num_points|.
+  //
+  // Key frames coded with spatial subtrees (see
+  // PointCloudSequenceEncoder::SetSpatialSubtrees()) skip the cells outside
+  // of |region|, so the time spent depends on the points of the intersecting
+  // cells rather than on the whole frame. The decoder is reset afterwards
+  // because the next predicted frame needs the complete frame as reference.
+  // All other frames are decoded completely, filtered, and remain the current
+  // frame, which allows playing back a region of a sequence.
+  Status DecodeFrameRegion(DecoderBuffer *in_buffer,
+                           const PointCloudRegionQuery &region,
+                           const PositionsOutputLayout &layout,
+                           size_t capacity, size_t *out_num_points);
+
+  // Returns true if |in_buffer| starts with an encoded key frame. The buffer
+  // is not modified.
+  static bool IsKeyFrame(const DecoderBuffer &in_buffer);
+
+  // Number of points of the current frame.
+  size_t num_points() const { return points_.size(); }
+
+  // Returns true if the current frame was a key frame.
+  bool is_key_frame() const { return is_key_frame_; }
+
+  // Writes the dequantized positions of the current frame as float triplets
+  // that are |byte_stride| bytes apart (0 means tightly packed). At most
+  // |capacity| points are written. Returns the number of written points.
+  size_t GetPositions(float *out_positions, int64_t byte_stride,
+                      size_t capacity) const;
+
+  // Creates a point cloud with a POSITION attribute holding the current
+  // frame.
+  std::unique_ptr<PointCloud> CreatePointCloud() const;
+  // Same as CreatePointCloud() but the storage of the attribute values is
+  // taken from the buffers recycled in |arena|, see RecyclePointCloud().
+  std::unique_ptr<PointCloud> CreatePointCloud(FrameArena *arena) const;
+
+  // Discards the current frame. The next decoded frame must be a key frame.
+  void Reset();
+
+ private:
+  Status DecodeKeyFrame(DecoderBuffer *in_buffer);
+  Status DecodePredictedFrame(DecoderBuffer *in_buffer);
+  // Decodes which of |removed_points_| moved to a neighboring cell and
+  // stores their new positions in |moved_points_|.
+  Status DecodeMovedPoints(DecoderBuffer *in_buffer);
+  // Decodes kd-tree coded points into |added_points_| and sorts them. The
+  // positions of the points are written to |decoding_order_output| in the
+  // order of the kd-tree leaves and to |sorted_output| after sorting. Both
+  // may be nullptr. Unless |region| is nullptr, spatial cells outside of it
+  // are skipped and only the points inside of it are kept, in which case
+  // |region_filtered_| is set.
+  Status DecodeAddedPoints(
+      DecoderBuffer *in_buffer, const PointCloudRegionQuery *region,
+      DequantizingPointsOutputIterator *decoding_order_output,
+      DequantizingPointsOutputIterator *sorted_output);
+  // Returns true if the cell of a spatial subtree may contain points inside
+  // of |region|. |*out_contained| is set if all of its points are inside.
+  bool SubtreeIntersectsRegion(const PointCloudRegionQuery &region,
+                               uint32_t subtree, int depth,
+                               bool *out_contained) const;
+  // Decodes a single kd-tree and appends the points to |out_points|. The
+  // positions are also written to |out_positions| unless it is nullptr.
+  bool DecodeSubtree(DecoderBuffer *in_buffer,
+                     std::vector<Point3ui> *out_points,
+                     DequantizingPointsOutputIterator *out_positions) const;
+  // Returns an iterator writing positions on the grid of the current frame
+  // to |positions_output_|.
+  DequantizingPointsOutputIterator CreatePositionsIterator() const;
+
+  // Destination of the positions set by DecodeFrame() for the duration of
+  // the call, nullptr when no positions are written.
+  struct PositionsOutput {
+    PositionsOutputLayout layout;
+    size_t capacity;
+    PointCloudSequencePointOrder order;
+  };
+  const PositionsOutput *positions_output_;
+  // Region set by DecodeFrameRegion() for the duration of the call.
+  const PointCloudRegionQuery *region_;
+  // Whether the current frame holds only the points inside of |region_|.
+  bool region_filtered_;
+
+  int num_threads_;
+
+  // Parameters of the current frame.
+  int version_;
+  int compression_level_;
+  int quantization_bits_;
+  float grid_origin_[3];
+  float grid_range_;
+
+  // Sorted quantized points of the current frame.
+  std::vector<Point3ui> points_;
+  bool has_frame_;
+  bool is_key_frame_;
+
+  // Scratch storage reused between frames.
+  std::vector<Point3ui> removed_points_;
+  std::vector<Point3ui> moved_points_;
+  std::vector<Point3ui> added_points_;
+  std::vector<Point3ui> merged_points_;
+  std::vector<std::vector<Point3ui>> subtree_points_;
+  std::vector<uint8_t> subtree_status_;
+  std::vector<size_t> run_offsets_;
+  // Created on first use with more than one thread.
+  std::unique_ptr<ThreadPool> thread_pool_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_DECODER_H_
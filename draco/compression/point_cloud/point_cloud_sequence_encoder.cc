@@ -0,0 +1,476 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/point_cloud_sequence_encoder.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "compression/bit_coders/rans_bit_encoder.h"
+#include "compression/point_cloud/algorithms/planar_points_kd_tree_encoder.h"
+#include "core/position_quantization.h"
+#include "core/varint_encoding.h"
+
+namespace draco {
+
+namespace {
+
+// Smallest number of points worth a subtree of its own. Smaller subtrees
+// spend more on the per-tree overhead than they save in coding time.
+constexpr size_t kMinSubtreeSize = 4096;
+
+// Offsets from a point to the 26 neighboring cells of the grid, the closest
+// ones first. Points of predicted frames that moved by one of these offsets
+// are coded as moved instead of removed and added.
+const int kNeighborOffsets[26][3] = {
+    {-1, 0, 0},   {1, 0, 0},   {0, -1, 0},   {0, 1, 0},   {0, 0, -1},
+    {0, 0, 1},    {-1, -1, 0}, {-1, 1, 0},   {1, -1, 0},  {1, 1, 0},
+    {-1, 0, -1},  {-1, 0, 1},  {1, 0, -1},   {1, 0, 1},   {0, -1, -1},
+    {0, -1, 1},   {0, 1, -1},  {0, 1, 1},    {-1, -1, -1}, {-1, -1, 1},
+    {-1, 1, -1},  {-1, 1, 1},  {1, -1, -1},  {1, -1, 1},  {1, 1, -1},
+    {1, 1, 1},
+};
+
+template <int compression_level_t>
+bool EncodeKdTree(std::vector<Point3ui>::iterator begin,
+                  std::vector<Point3ui>::iterator end, uint32_t bit_length,
+                  EncoderBuffer *out_buffer) {
+  PlanarPointsKdTreeEncoder<compression_level_t> encoder;
+  return encoder.EncodePoints(begin, end, bit_length, out_buffer);
+}
+
+}  // namespace
+
+PointCloudSequenceEncoder::PointCloudSequenceEncoder()
+    : quantization_bits_(11),
+      compression_level_(6),
+      key_frame_interval_(30),
+      grid_margin_(0.1f),
+      max_change_ratio_(0.5f),
+      subtree_depth_(0),
+      spatial_subtrees_(false),
+      num_threads_(1),
+      key_frame_requested_(false),
+      grid_quantization_bits_(0),
+      grid_origin_{0.f, 0.f, 0.f},
+      grid_range_(1.f),
+      has_reference_(false),
+      frames_since_key_frame_(0),
+      last_frame_is_key_frame_(false),
+      last_frame_num_changes_(0),
+      last_frame_num_moved_points_(0) {}
+
+Status PointCloudSequenceEncoder::EncodeFrame(const float *positions,
+                                              size_t num_points,
+                                              int64_t byte_stride,
+                                              EncoderBuffer *out_buffer) {
+  if (positions == nullptr && num_points > 0) {
+    return Status(Status::INVALID_PARAMETER, "Missing position data.");
+  }
+  if (num_points > std::numeric_limits<uint32_t>::max()) {
+    return Status(Status::INVALID_PARAMETER, "Too many points.");
+  }
+  if (quantization_bits_ < 1 ||
+      quantization_bits_ > kPointCloudSequenceMaxQuantizationBits) {
+    return Status(Status::INVALID_PARAMETER, "Invalid quantization bits.");
+  }
+  if (compression_level_ < 0 || compression_level_ > 6) {
+    return Status(Status::INVALID_PARAMETER, "Invalid compression level.");
+  }
+  if (subtree_depth_ < 0 ||
+      subtree_depth_ > kPointCloudSequenceMaxSubtreeDepth) {
+    return Status(Status::INVALID_PARAMETER, "Invalid subtree depth.");
+  }
+  if (byte_stride == 0) {
+    byte_stride = 3 * sizeof(float);
+  }
+  if (byte_stride < static_cast<int64_t>(3 * sizeof(float))) {
+    return Status(Status::INVALID_PARAMETER, "Invalid byte stride.");
+  }
+
+  bool key_frame = !has_reference_ || key_frame_requested_ ||
+                   quantization_bits_ != grid_quantization_bits_ ||
+                   (key_frame_interval_ > 0 &&
+                    frames_since_key_frame_ + 1 >= key_frame_interval_);
+  if (!key_frame) {
+    // Points that moved out of the grid of the last key frame can't be
+    // predicted.
+    if (!QuantizePoints(positions, num_points, byte_stride)) {
+      key_frame = true;
+    } else {
+      std::sort(current_points_.begin(), current_points_.end());
+      const size_t num_changes = MatchReference();
+      if (num_changes >
+          max_change_ratio_ * std::max<size_t>(num_points, 1)) {
+        key_frame = true;
+      } else {
+        DRACO_RETURN_IF_ERROR(EncodePredictedFrame(out_buffer));
+        last_frame_num_changes_ = num_changes;
+        last_frame_num_moved_points_ = moved_points_.size();
+      }
+    }
+  }
+  if (key_frame) {
+    DRACO_RETURN_IF_ERROR(InitGrid(positions, num_points, byte_stride));
+    if (!QuantizePoints(positions, num_points, byte_stride)) {
+      return Status(Status::INVALID_PARAMETER, "Invalid position data.");
+    }
+    std::sort(current_points_.begin(), current_points_.end());
+    DRACO_RETURN_IF_ERROR(EncodeKeyFrame(out_buffer));
+    last_frame_num_changes_ = num_points;
+    last_frame_num_moved_points_ = 0;
+    frames_since_key_frame_ = 0;
+    key_frame_requested_ = false;
+  } else {
+    ++frames_since_key_frame_;
+  }
+  // The sorted quantized points are exactly the reconstruction of the
+  // decoder, so they become the reference of the next frame.
+  reference_points_.swap(current_points_);
+  has_reference_ = true;
+  last_frame_is_key_frame_ = key_frame;
+  return OkStatus();
+}
+
+Status PointCloudSequenceEncoder::EncodeFrame(const PointCloud &pc,
+                                              EncoderBuffer *out_buffer) {
+  const PointAttribute *const att =
+      pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (att == nullptr || att->num_components() != 3) {
+    return Status(Status::INVALID_PARAMETER, "Missing position attribute.");
+  }
+  if (att->data_type() == DT_FLOAT32 && att->is_mapping_identity() &&
+      att->size() == pc.num_points()) {
+    const uint8_t *const data = att->GetAddress(AttributeValueIndex(0));
+    return EncodeFrame(reinterpret_cast<const float *>(data), pc.num_points(),
+                       att->byte_stride(), out_buffer);
+  }
+  std::vector<float> positions(3 * static_cast<size_t>(pc.num_points()));
+  for (PointIndex i(0); i < pc.num_points(); ++i) {
+    att->ConvertValue<float, 3>(att->mapped_index(i),
+                                &positions[3 * i.value()]);
+  }
+  return EncodeFrame(positions.data(), pc.num_points(), 0, out_buffer);
+}
+
+void PointCloudSequenceEncoder::Reset() {
+  reference_points_.clear();
+  has_reference_ = false;
+  frames_since_key_frame_ = 0;
+  grid_quantization_bits_ = 0;
+}
+
+Status PointCloudSequenceEncoder::InitGrid(const float *positions,
+                                           size_t num_points,
+                                           int64_t byte_stride) {
+  float min_values[3] = {0.f, 0.f, 0.f};
+  float max_values[3] = {0.f, 0.f, 0.f};
+  if (!ComputePositionBounds(positions, num_points, byte_stride, min_values,
+                             max_values)) {
+    return Status(Status::INVALID_PARAMETER, "Non-finite position.");
+  }
+  float range = 0.f;
+  for (int c = 0; c < 3; ++c) {
+    range = std::max(range, max_values[c] - min_values[c]);
+  }
+  if (range == 0.f) {
+    range = 1.f;
+  }
+  // The margin lets the grid cover points that move slightly outside of the
+  // bounds of the key frame in the following predicted frames.
+  const float margin = range * std::max(grid_margin_, 0.f);
+  for (int c = 0; c < 3; ++c) {
+    grid_origin_[c] = min_values[c] - margin;
+  }
+  grid_range_ = range + 2.f * margin;
+  grid_quantization_bits_ = quantization_bits_;
+  return OkStatus();
+}
+
+bool PointCloudSequenceEncoder::QuantizePoints(const float *positions,
+                                               size_t num_points,
+                                               int64_t byte_stride) {
+  current_points_.resize(num_points);
+  return QuantizePositions(positions, num_points, byte_stride, grid_origin_,
+                           grid_range_, (1u << grid_quantization_bits_) - 1,
+                           current_points_.data());
+}
+
+size_t PointCloudSequenceEncoder::MatchReference() {
+  kept_flags_.assign(reference_points_.size(), false);
+  moved_flags_.assign(reference_points_.size(), false);
+  moved_points_.clear();
+  added_points_.clear();
+  size_t ref = 0;
+  size_t cur = 0;
+  while (ref < reference_points_.size() && cur < current_points_.size()) {
+    if (reference_points_[ref] == current_points_[cur]) {
+      kept_flags_[ref++] = true;
+      ++cur;
+    } else if (reference_points_[ref] < current_points_[cur]) {
+      ++ref;
+    } else {
+      added_points_.push_back(current_points_[cur++]);
+    }
+  }
+  added_points_.insert(added_points_.end(), current_points_.begin() + cur,
+                       current_points_.end());
+
+  // Sensor noise moves many points of a static scene to a neighboring cell
+  // between frames. Each point that is not kept is matched with an unused
+  // added point in the closest neighboring cell, which is much cheaper to
+  // code than removing and adding the point. |added_points_| is sorted, so
+  // the neighbors are found by binary search.
+  added_used_.assign(added_points_.size(), false);
+  const uint32_t max_value = (1u << grid_quantization_bits_) - 1;
+  size_t num_removed = 0;
+  for (size_t i = 0; i < reference_points_.size(); ++i) {
+    if (kept_flags_[i]) {
+      continue;
+    }
+    const Point3ui &p = reference_points_[i];
+    size_t match = added_points_.size();
+    for (const int *const offset : kNeighborOffsets) {
+      Point3ui neighbor;
+      bool inside = true;
+      for (int c = 0; c < 3; ++c) {
+        if ((offset[c] < 0 && p[c] == 0) ||
+            (offset[c] > 0 && p[c] == max_value)) {
+          inside = false;
+        }
+        neighbor[c] = p[c] + offset[c];
+      }
+      if (!inside) {
+        continue;
+      }
+      // Duplicates of the neighbor may have been used already.
+      size_t j = std::lower_bound(added_points_.begin(), added_points_.end(),
+                                  neighbor) -
+                 added_points_.begin();
+      while (j < added_points_.size() && added_points_[j] == neighbor &&
+             added_used_[j]) {
+        ++j;
+      }
+      if (j < added_points_.size() && added_points_[j] == neighbor) {
+        match = j;
+        break;
+      }
+    }
+    if (match == added_points_.size()) {
+      ++num_removed;
+      continue;
+    }
+    added_used_[match] = true;
+    moved_flags_[i] = true;
+    moved_points_.push_back(added_points_[match]);
+  }
+  if (!moved_points_.empty()) {
+    size_t num_added = 0;
+    for (size_t j = 0; j < added_points_.size(); ++j) {
+      if (!added_used_[j]) {
+        added_points_[num_added++] = added_points_[j];
+      }
+    }
+    added_points_.resize(num_added);
+  }
+  return num_removed + added_points_.size();
+}
+
+void PointCloudSequenceEncoder::EncodeFrameHeader(
+    PointCloudSequenceFrameType frame_type, EncoderBuffer *out_buffer) const {
+  out_buffer->Encode(kPointCloudSequenceBitstreamVersion);
+  out_buffer->Encode(static_cast<uint8_t>(frame_type));
+  out_buffer->Encode(static_cast<uint8_t>(compression_level_));
+}
+
+Status PointCloudSequenceEncoder::EncodeKeyFrame(EncoderBuffer *out_buffer) {
+  EncodeFrameHeader(POINT_CLOUD_SEQUENCE_KEY_FRAME, out_buffer);
+  out_buffer->Encode(static_cast<uint8_t>(grid_quantization_bits_));
+  out_buffer->Encode(grid_origin_, sizeof(grid_origin_));
+  out_buffer->Encode(grid_range_);
+  added_points_ = current_points_;
+  return EncodeAddedPoints(spatial_subtrees_
+                               ? POINT_CLOUD_SEQUENCE_SPATIAL_CELLS
+                               : POINT_CLOUD_SEQUENCE_SORTED_RUNS,
+                           out_buffer);
+}
+
+Status PointCloudSequenceEncoder::EncodePredictedFrame(
+    EncoderBuffer *out_buffer) {
+  EncodeFrameHeader(POINT_CLOUD_SEQUENCE_PREDICTED_FRAME, out_buffer);
+  EncodeVarint(static_cast<uint32_t>(reference_points_.size()), out_buffer);
+  if (!reference_points_.empty()) {
+    RAnsBitEncoder kept_encoder;
+    kept_encoder.StartEncoding();
+    for (size_t i = 0; i < kept_flags_.size(); ++i) {
+      kept_encoder.EncodeBit(kept_flags_[i]);
+    }
+    kept_encoder.EndEncoding(out_buffer);
+  }
+  const size_t num_kept =
+      std::count(kept_flags_.begin(), kept_flags_.end(), true);
+  if (num_kept < reference_points_.size()) {
+    RAnsBitEncoder moved_encoder;
+    moved_encoder.StartEncoding();
+    for (size_t i = 0; i < moved_flags_.size(); ++i) {
+      if (!kept_flags_[i]) {
+        moved_encoder.EncodeBit(moved_flags_[i]);
+      }
+    }
+    moved_encoder.EndEncoding(out_buffer);
+  }
+  if (!moved_points_.empty()) {
+    // The offset of each moved point to its reference point, coded as a flag
+    // for each axis along which the point moved and the signs of the moves.
+    RAnsBitEncoder axis_encoder;
+    RAnsBitEncoder sign_encoder;
+    axis_encoder.StartEncoding();
+    sign_encoder.StartEncoding();
+    size_t moved = 0;
+    for (size_t i = 0; i < moved_flags_.size(); ++i) {
+      if (!moved_flags_[i]) {
+        continue;
+      }
+      const Point3ui &from = reference_points_[i];
+      const Point3ui &to = moved_points_[moved++];
+      for (int c = 0; c < 3; ++c) {
+        axis_encoder.EncodeBit(from[c] != to[c]);
+        if (from[c] != to[c]) {
+          sign_encoder.EncodeBit(to[c] < from[c]);
+        }
+      }
+    }
+    axis_encoder.EndEncoding(out_buffer);
+    sign_encoder.EndEncoding(out_buffer);
+  }
+  // Predicted frames are always decoded completely, so they don't benefit
+  // from spatial cells.
+  return EncodeAddedPoints(POINT_CLOUD_SEQUENCE_SORTED_RUNS, out_buffer);
+}
+
+Status PointCloudSequenceEncoder::EncodeAddedPoints(
+    PointCloudSequenceSubtreeLayout layout, EncoderBuffer *out_buffer) {
+  const size_t num_points = added_points_.size();
+  // Each cell halves one axis of the grid, which limits the depth for coarse
+  // grids.
+  const int cell_depth =
+      std::min(subtree_depth_, 3 * static_cast<int>(grid_quantization_bits_));
+  size_t num_subtrees = 1;
+  if (layout == POINT_CLOUD_SEQUENCE_SPATIAL_CELLS) {
+    num_subtrees = size_t(1) << cell_depth;
+  } else {
+    num_subtrees = std::max<size_t>(
+        std::min<size_t>(size_t(1) << subtree_depth_,
+                         num_points / kMinSubtreeSize),
+        1);
+  }
+  EncodeVarint(static_cast<uint32_t>(num_subtrees), out_buffer);
+  if (num_subtrees == 1) {
+    if (!EncodeSubtree(added_points_.begin(), added_points_.end(),
+                       out_buffer)) {
+      return ErrorStatus("Failed to encode points.");
+    }
+    return OkStatus();
+  }
+  out_buffer->Encode(static_cast<uint8_t>(layout));
+
+  // Subtree i holds the points in range
+  // [subtree_offsets_[i], subtree_offsets_[i + 1]) of |subtree_points|.
+  std::vector<Point3ui> *subtree_points = &added_points_;
+  subtree_offsets_.assign(num_subtrees + 1, 0);
+  if (layout == POINT_CLOUD_SEQUENCE_SPATIAL_CELLS) {
+    // Counting sort by cell, which keeps the points of each cell sorted.
+    for (const Point3ui &p : added_points_) {
+      ++subtree_offsets_[GetSpatialSubtreeIndex(p, cell_depth,
+                                                grid_quantization_bits_) +
+                         1];
+    }
+    for (size_t i = 1; i <= num_subtrees; ++i) {
+      subtree_offsets_[i] += subtree_offsets_[i - 1];
+    }
+    cell_points_.resize(num_points);
+    std::vector<size_t> next(subtree_offsets_.begin(),
+                             subtree_offsets_.end() - 1);
+    for (const Point3ui &p : added_points_) {
+      cell_points_[next[GetSpatialSubtreeIndex(p, cell_depth,
+                                               grid_quantization_bits_)]++] =
+          p;
+    }
+    subtree_points = &cell_points_;
+  } else {
+    // The points are sorted, so each subtree covers a compact slab of the
+    // grid and the decoder restores the order by sorting the subtrees
+    // separately.
+    for (size_t i = 0; i <= num_subtrees; ++i) {
+      subtree_offsets_[i] = num_points * i / num_subtrees;
+    }
+  }
+  subtree_buffers_.resize(num_subtrees);
+  subtree_status_.assign(num_subtrees, 0);
+  const auto encode_subtree = [this, subtree_points](int subtree) {
+    EncoderBuffer *const buffer = &subtree_buffers_[subtree];
+    buffer->Clear();
+    subtree_status_[subtree] = EncodeSubtree(
+        subtree_points->begin() + subtree_offsets_[subtree],
+        subtree_points->begin() + subtree_offsets_[subtree + 1], buffer);
+  };
+  if (num_threads_ > 1) {
+    if (thread_pool_ == nullptr ||
+        thread_pool_->num_threads() != num_threads_) {
+      thread_pool_.reset(new ThreadPool(num_threads_));
+    }
+    thread_pool_->Run(static_cast<int>(num_subtrees), encode_subtree);
+  } else {
+    for (size_t i = 0; i < num_subtrees; ++i) {
+      encode_subtree(static_cast<int>(i));
+    }
+  }
+  for (size_t i = 0; i < num_subtrees; ++i) {
+    if (!subtree_status_[i]) {
+      return ErrorStatus("Failed to encode points.");
+    }
+    EncodeVarint(static_cast<uint32_t>(subtree_buffers_[i].size()),
+                 out_buffer);
+  }
+  for (size_t i = 0; i < num_subtrees; ++i) {
+    out_buffer->Encode(subtree_buffers_[i].data(),
+                       subtree_buffers_[i].size());
+  }
+  return OkStatus();
+}
+
+bool PointCloudSequenceEncoder::EncodeSubtree(
+    std::vector<Point3ui>::iterator begin,
+    std::vector<Point3ui>::iterator end, EncoderBuffer *out_buffer) const {
+  const uint32_t bit_length = grid_quantization_bits_;
+  switch (compression_level_) {
+    case 0:
+      return EncodeKdTree<0>(begin, end, bit_length, out_buffer);
+    case 1:
+      return EncodeKdTree<1>(begin, end, bit_length, out_buffer);
+    case 2:
+      return EncodeKdTree<2>(begin, end, bit_length, out_buffer);
+    case 3:
+      return EncodeKdTree<3>(begin, end, bit_length, out_buffer);
+    case 4:
+      return EncodeKdTree<4>(begin, end, bit_length, out_buffer);
+    case 5:
+      return EncodeKdTree<5>(begin, end, bit_length, out_buffer);
+    case 6:
+      return EncodeKdTree<6>(begin, end, bit_length, out_buffer);
+  }
+  return false;
+}
+
+}  // namespace draco
@@ -0,0 +1,188 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_ENCODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "compression/point_cloud/point_cloud_sequence_shared.h"
+#include "core/encoder_buffer.h"
+#include "core/status.h"
+#include "core/thread_pool.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Encodes the positions of a sequence of point clouds, such as consecutive
+// depth camera frames, using temporal prediction. All frames between two key
+// frames are quantized on the same grid and each predicted frame is coded as
+// the difference to the previous reconstructed frame: a kept/removed bit for
+// each point of the reference, the offsets of points that moved to a
+// neighboring cell of the grid and a kd-tree of the newly added points. For
+// mostly static scenes nearly all points are kept or moved by sensor noise,
+// making predicted frames a fraction of the size of independently coded
+// frames. See
+// point_cloud_sequence_shared.h for the bitstream layout.
+//
+// Frames must be decoded in order by PointCloudSequenceDecoder, starting at a
+// key frame. The order of the decoded points is not preserved.
+class PointCloudSequenceEncoder {
+ public:
+  PointCloudSequenceEncoder();
+
+  // Number of bits used to quantize positions on the grid of a key frame.
+  void SetQuantizationBits(int quantization_bits) {
+    quantization_bits_ = quantization_bits;
+  }
+
+  // Compression level of the kd-tree coder in range [0..6]. Higher levels
+  // give better compression at the cost of speed.
+  void SetCompressionLevel(int compression_level) {
+    compression_level_ = compression_level;
+  }
+
+  // Maximum distance between two key frames. 1 codes every frame as a key
+  // frame, 0 disables periodic key frames.
+  void SetKeyFrameInterval(int key_frame_interval) {
+    key_frame_interval_ = key_frame_interval;
+  }
+
+  // Relative margin added around the bounding box of a key frame. Points of
+  // predicted frames outside of the grid force a new key frame.
+  void SetGridMargin(float grid_margin) { grid_margin_ = grid_margin; }
+
+  // When the number of added and removed points of a predicted frame exceeds
+  // |ratio| times the number of points, the frame is coded as a key frame.
+  // Points that moved to a neighboring cell don't count as changes.
+  void SetMaxChangeRatio(float ratio) { max_change_ratio_ = ratio; }
+
+  // Splits the points of a frame into up to 2^|depth| subtrees in range
+  // [0..kPointCloudSequenceMaxSubtreeDepth] that are coded independently.
+  // Each subtree holds at least a few thousand points, so small frames use
+  // fewer subtrees. Every doubling of the number of subtrees grows the coded
+  // points by about 1%.
+  void SetSubtreeDepth(int depth) { subtree_depth_ = depth; }
+
+  // Splits the points of key frames into the 2^depth cells of the grid given
+  // by SetSubtreeDepth() instead of equally sized subtrees, independent of
+  // the number of points. PointCloudSequenceDecoder::DecodeFrameRegion() can
+  // then skip the cells outside of a queried region. Decoding all points of
+  // such frames merges the cells, which is a little slower.
+  void SetSpatialSubtrees(bool spatial_subtrees) {
+    spatial_subtrees_ = spatial_subtrees;
+  }
+
+  // Number of threads encoding the subtrees of a frame, including the
+  // calling thread.
+  void SetNumThreads(int num_threads) { num_threads_ = num_threads; }
+
+  // Forces the next frame to be coded as a key frame.
+  void RequestKeyFrame() { key_frame_requested_ = true; }
+
+  // Encodes the next frame given by |num_points| float triplets. Consecutive
+  // points are |byte_stride| bytes apart (0 means tightly packed).
+  Status EncodeFrame(const float *positions, size_t num_points,
+                     int64_t byte_stride, EncoderBuffer *out_buffer);
+
+  // Encodes the POSITION attribute of |pc| as the next frame.
+  Status EncodeFrame(const PointCloud &pc, EncoderBuffer *out_buffer);
+
+  // Returns true if the last encoded frame was a key frame.
+  bool last_frame_is_key_frame() const { return last_frame_is_key_frame_; }
+
+  // Number of points that were added or removed in the last predicted frame.
+  size_t last_frame_num_changes() const { return last_frame_num_changes_; }
+
+  // Number of points of the last predicted frame that moved to one of the 26
+  // neighboring cells of their position in the reference.
+  size_t last_frame_num_moved_points() const {
+    return last_frame_num_moved_points_;
+  }
+
+  // Discards the reference, the next frame is coded as a key frame.
+  void Reset();
+
+ private:
+  // Sets up the quantization grid for a key frame.
+  Status InitGrid(const float *positions, size_t num_points,
+                  int64_t byte_stride);
+  // Quantizes the input into |current_points_|. Returns false if any point is
+  // outside of the current grid.
+  bool QuantizePoints(const float *positions, size_t num_points,
+                      int64_t byte_stride);
+  // Matches the sorted |current_points_| against |reference_points_|. Fills
+  // |kept_flags_|, |moved_flags_|, |moved_points_| and |added_points_| and
+  // returns the number of removed and added points.
+  size_t MatchReference();
+  void EncodeFrameHeader(PointCloudSequenceFrameType frame_type,
+                         EncoderBuffer *out_buffer) const;
+  Status EncodeKeyFrame(EncoderBuffer *out_buffer);
+  Status EncodePredictedFrame(EncoderBuffer *out_buffer);
+  // Encodes |added_points_| with the kd-tree coder. The order of the points
+  // is not preserved.
+  Status EncodeAddedPoints(PointCloudSequenceSubtreeLayout layout,
+                           EncoderBuffer *out_buffer);
+  // Encodes the points in range [begin, end) as a single kd-tree.
+  bool EncodeSubtree(std::vector<Point3ui>::iterator begin,
+                     std::vector<Point3ui>::iterator end,
+                     EncoderBuffer *out_buffer) const;
+
+  // Options.
+  int quantization_bits_;
+  int compression_level_;
+  int key_frame_interval_;
+  float grid_margin_;
+  float max_change_ratio_;
+  int subtree_depth_;
+  bool spatial_subtrees_;
+  int num_threads_;
+  bool key_frame_requested_;
+
+  // Quantization grid of the last key frame.
+  int grid_quantization_bits_;
+  float grid_origin_[3];
+  float grid_range_;
+
+  // Sorted quantized points of the last reconstructed frame.
+  std::vector<Point3ui> reference_points_;
+  bool has_reference_;
+  int frames_since_key_frame_;
+
+  // Scratch storage reused between frames.
+  std::vector<Point3ui> current_points_;
+  std::vector<Point3ui> added_points_;
+  std::vector<bool> kept_flags_;
+  std::vector<bool> moved_flags_;
+  // New positions of the moved reference points, in the order of the
+  // reference.
+  std::vector<Point3ui> moved_points_;
+  std::vector<bool> added_used_;
+  std::vector<Point3ui> cell_points_;
+  std::vector<size_t> subtree_offsets_;
+  std::vector<EncoderBuffer> subtree_buffers_;
+  std::vector<uint8_t> subtree_status_;
+  // Created on first use with more than one thread.
+  std::unique_ptr<ThreadPool> thread_pool_;
+
+  bool last_frame_is_key_frame_;
+  size_t last_frame_num_changes_;
+  size_t last_frame_num_moved_points_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_ENCODER_H_
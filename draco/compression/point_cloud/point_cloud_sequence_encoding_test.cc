@@ -0,0 +1,781 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "compression/bit_coders/rans_bit_decoder.h"
+#include "compression/config/compression_shared.h"
+#include "compression/point_cloud/point_cloud_sequence_decoder.h"
+#include "compression/point_cloud/point_cloud_sequence_encoder.h"
+#include "core/draco_test_base.h"
+#include "core/varint_decoding.h"
+
+namespace draco {
+
+class PointCloudSequenceEncodingTest : public ::testing::Test {
+ protected:
+  PointCloudSequenceEncodingTest() : rng_(7), dist_(-1.f, 1.f) {}
+
+  void SetUp() override {
+    encoder_.SetQuantizationBits(kQuantizationBits);
+    encoder_.SetKeyFrameInterval(0);
+    positions_.resize(3 * kNumPoints);
+    for (float &value : positions_) {
+      value = dist_(rng_);
+    }
+  }
+
+  // Moves |num_moved| random points to new random positions.
+  void MovePoints(int num_moved) {
+    for (int i = 0; i < num_moved; ++i) {
+      const size_t point = rng_() % kNumPoints;
+      for (int c = 0; c < 3; ++c) {
+        positions_[3 * point + c] = dist_(rng_);
+      }
+    }
+  }
+
+  void EncodeFrame(std::vector<char> *frame) {
+    EncoderBuffer buffer;
+    ASSERT_TRUE(
+        encoder_.EncodeFrame(positions_.data(), kNumPoints, 0, &buffer).ok());
+    frame->assign(buffer.data(), buffer.data() + buffer.size());
+  }
+
+  // Decodes the first |size| bytes of |frame|.
+  static Status DecodeFrame(const std::vector<char> &frame, size_t size,
+                            PointCloudSequenceDecoder *decoder) {
+    DecoderBuffer in_buffer;
+    in_buffer.Init(frame.data(), size);
+    return decoder->DecodeFrame(&in_buffer);
+  }
+
+  // Expects the decoded points to match |positions_| up to the quantization
+  // error, in both directions. The order of the points is not preserved.
+  void ExpectPositions(const PointCloudSequenceDecoder &decoder) const {
+    ASSERT_EQ(decoder.num_points(), kNumPoints);
+    std::vector<float> decoded(3 * kNumPoints);
+    ASSERT_EQ(decoder.GetPositions(decoded.data(), 0, kNumPoints), kNumPoints);
+    // The grid covers [-1, 1] plus a small margin.
+    const float tolerance = 2.5f / (1 << kQuantizationBits);
+    EXPECT_LE(MaxDistance(positions_, decoded), tolerance);
+    EXPECT_LE(MaxDistance(decoded, positions_), tolerance);
+  }
+
+  // Returns the largest distance of a point in |a| to its closest point in
+  // |b| using the maximum norm.
+  static float MaxDistance(const std::vector<float> &a,
+                           const std::vector<float> &b) {
+    float max_distance = 0.f;
+    for (size_t i = 0; i < a.size(); i += 3) {
+      float min_distance = INFINITY;
+      for (size_t j = 0; j < b.size(); j += 3) {
+        float distance = 0.f;
+        for (int c = 0; c < 3; ++c) {
+          distance = std::max(distance, std::abs(a[i + c] - b[j + c]));
+        }
+        min_distance = std::min(min_distance, distance);
+      }
+      max_distance = std::max(max_distance, min_distance);
+    }
+    return max_distance;
+  }
+
+  static constexpr int kQuantizationBits = 14;
+  static constexpr size_t kNumPoints = 2000;
+
+  std::mt19937 rng_;
+  std::uniform_real_distribution<float> dist_;
+  std::vector<float> positions_;
+  PointCloudSequenceEncoder encoder_;
+};
+
+TEST_F(PointCloudSequenceEncodingTest, TestKeyFrameRoundTrip) {
+  std::vector<char> buffer;
+  EncodeFrame(&buffer);
+  EXPECT_TRUE(encoder_.last_frame_is_key_frame());
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  EXPECT_TRUE(PointCloudSequenceDecoder::IsKeyFrame(in_buffer));
+
+  PointCloudSequenceDecoder decoder;
+  ASSERT_TRUE(decoder.DecodeFrame(&in_buffer).ok());
+  EXPECT_TRUE(decoder.is_key_frame());
+  EXPECT_EQ(in_buffer.remaining_size(), 0);
+  ExpectPositions(decoder);
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestPredictedFrames) {
+  PointCloudSequenceDecoder decoder;
+  std::vector<char> buffer;
+  EncodeFrame(&buffer);
+  const size_t key_frame_size = buffer.size();
+  ASSERT_TRUE(DecodeFrame(buffer, buffer.size(), &decoder).ok());
+  for (int frame = 1; frame < 6; ++frame) {
+    MovePoints(kNumPoints / 20);
+    EncodeFrame(&buffer);
+    ASSERT_FALSE(encoder_.last_frame_is_key_frame());
+    EXPECT_GT(encoder_.last_frame_num_changes(), 0u);
+    EXPECT_LT(buffer.size(), key_frame_size / 2);
+    ASSERT_TRUE(DecodeFrame(buffer, buffer.size(), &decoder).ok());
+    EXPECT_FALSE(decoder.is_key_frame());
+    ExpectPositions(decoder);
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestJitteredFrames) {
+  // A static scene seen through a noisy sensor: every frame adds up to half
+  // a grid cell of noise to each point, which moves most quantized points to
+  // a neighboring cell. Coded as removed and added points, such frames
+  // exceeded the change ratio and fell back to key frames of about 8400
+  // bytes. With the moved points the frames are predicted and take about
+  // 950 bytes.
+  const std::vector<float> scene = positions_;
+  const float cell = 2.f / (1 << kQuantizationBits);
+  std::uniform_real_distribution<float> noise(-0.5f * cell, 0.5f * cell);
+  PointCloudSequenceDecoder decoder;
+  std::vector<char> buffer;
+  EncodeFrame(&buffer);
+  const size_t key_frame_size = buffer.size();
+  ASSERT_TRUE(DecodeFrame(buffer, buffer.size(), &decoder).ok());
+  for (int frame = 1; frame < 6; ++frame) {
+    for (size_t i = 0; i < positions_.size(); ++i) {
+      positions_[i] = scene[i] + noise(rng_);
+    }
+    EncodeFrame(&buffer);
+    ASSERT_FALSE(encoder_.last_frame_is_key_frame());
+    EXPECT_GT(encoder_.last_frame_num_moved_points(), kNumPoints / 2);
+    EXPECT_LT(encoder_.last_frame_num_changes(), kNumPoints / 10);
+    EXPECT_LT(buffer.size(), key_frame_size / 4);
+
+    // The positions written in decoding order are a permutation of the
+    // sorted ones.
+    std::vector<float> decoded(3 * kNumPoints);
+    DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), buffer.size());
+    ASSERT_TRUE(decoder
+                    .DecodeFrame(&in_buffer,
+                                 PositionsOutputLayout::Interleaved(
+                                     decoded.data(), 3 * sizeof(float)),
+                                 kNumPoints,
+                                 POINT_CLOUD_SEQUENCE_DECODING_ORDER)
+                    .ok());
+    EXPECT_FALSE(decoder.is_key_frame());
+    ExpectPositions(decoder);
+    std::vector<float> sorted(3 * kNumPoints);
+    decoder.GetPositions(sorted.data(), 0, kNumPoints);
+    std::vector<std::array<float, 3>> a(kNumPoints);
+    std::vector<std::array<float, 3>> b(kNumPoints);
+    for (size_t i = 0; i < kNumPoints; ++i) {
+      a[i] = {decoded[3 * i], decoded[3 * i + 1], decoded[3 * i + 2]};
+      b[i] = {sorted[3 * i], sorted[3 * i + 1], sorted[3 * i + 2]};
+    }
+    std::sort(a.begin(), a.end());
+    ASSERT_EQ(a, b) << frame;
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestKeyFrames) {
+  // Key frames are coded periodically, on request and when too many points
+  // change.
+  encoder_.SetKeyFrameInterval(3);
+  encoder_.SetMaxChangeRatio(0.5f);
+  PointCloudSequenceDecoder decoder;
+  std::vector<char> buffer;
+  const bool expected_key_frames[] = {true, false, false, true,
+                                      true, false, true};
+  for (int frame = 0; frame < 7; ++frame) {
+    if (frame == 4) {
+      encoder_.RequestKeyFrame();
+    }
+    MovePoints(frame == 6 ? kNumPoints : kNumPoints / 20);
+    EncodeFrame(&buffer);
+    EXPECT_EQ(encoder_.last_frame_is_key_frame(), expected_key_frames[frame]);
+    ASSERT_TRUE(DecodeFrame(buffer, buffer.size(), &decoder).ok());
+    EXPECT_EQ(decoder.is_key_frame(), expected_key_frames[frame]);
+    ExpectPositions(decoder);
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestSeekToKeyFrame) {
+  std::vector<char> key_frame;
+  std::vector<char> predicted_frame;
+  EncodeFrame(&key_frame);
+  MovePoints(kNumPoints / 20);
+  EncodeFrame(&predicted_frame);
+
+  // A predicted frame can't be decoded without the preceding key frame.
+  PointCloudSequenceDecoder decoder;
+  DecoderBuffer in_buffer;
+  in_buffer.Init(predicted_frame.data(), predicted_frame.size());
+  EXPECT_FALSE(PointCloudSequenceDecoder::IsKeyFrame(in_buffer));
+  EXPECT_FALSE(
+      DecodeFrame(predicted_frame, predicted_frame.size(), &decoder).ok());
+  ASSERT_TRUE(DecodeFrame(key_frame, key_frame.size(), &decoder).ok());
+  ASSERT_TRUE(
+      DecodeFrame(predicted_frame, predicted_frame.size(), &decoder).ok());
+  ExpectPositions(decoder);
+
+  decoder.Reset();
+  EXPECT_EQ(decoder.num_points(), 0u);
+  EXPECT_FALSE(
+      DecodeFrame(predicted_frame, predicted_frame.size(), &decoder).ok());
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestTruncatedFrames) {
+  std::vector<char> key_frame;
+  std::vector<char> predicted_frame;
+  EncodeFrame(&key_frame);
+  MovePoints(kNumPoints / 20);
+  EncodeFrame(&predicted_frame);
+
+  for (size_t size = 0; size < key_frame.size(); ++size) {
+    PointCloudSequenceDecoder decoder;
+    ASSERT_FALSE(DecodeFrame(key_frame, size, &decoder).ok()) << size;
+    EXPECT_EQ(decoder.num_points(), 0u);
+  }
+  for (size_t size = 0; size < predicted_frame.size(); ++size) {
+    PointCloudSequenceDecoder decoder;
+    ASSERT_TRUE(DecodeFrame(key_frame, key_frame.size(), &decoder).ok());
+    ASSERT_FALSE(DecodeFrame(predicted_frame, size, &decoder).ok()) << size;
+    // A truncated header leaves the current frame untouched. Otherwise the
+    // partially decoded frame is discarded, so the next predicted frame
+    // can't be decoded either.
+    const bool has_header = size >= 3;
+    EXPECT_EQ(decoder.num_points(), has_header ? 0u : kNumPoints);
+    EXPECT_NE(
+        DecodeFrame(predicted_frame, predicted_frame.size(), &decoder).ok(),
+        has_header);
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestCorruptedFrames) {
+  std::vector<char> key_frame;
+  std::vector<char> predicted_frame;
+  EncodeFrame(&key_frame);
+  MovePoints(kNumPoints / 20);
+  EncodeFrame(&predicted_frame);
+
+  // Invalid header fields.
+  const struct {
+    int offset;
+    char value;
+  } header_corruptions[] = {
+      {0, 0},   // Version.
+      {0, kPointCloudSequenceBitstreamVersion + 1},
+      {1, 2},   // Frame type.
+      {2, 7},   // Compression level.
+      {3, 0},   // Quantization bits.
+      {3, 31},
+  };
+  for (const auto &corruption : header_corruptions) {
+    std::vector<char> corrupted = key_frame;
+    corrupted[corruption.offset] = corruption.value;
+    PointCloudSequenceDecoder decoder;
+    EXPECT_FALSE(DecodeFrame(corrupted, corrupted.size(), &decoder).ok());
+  }
+  {
+    std::vector<char> corrupted = key_frame;
+    corrupted[0] = kPointCloudSequenceBitstreamVersion + 1;
+    PointCloudSequenceDecoder decoder;
+    EXPECT_EQ(DecodeFrame(corrupted, corrupted.size(), &decoder).code(),
+              Status::UNSUPPORTED_VERSION);
+  }
+
+  // A predicted frame coded against a different reference is rejected.
+  {
+    PointCloudSequenceEncoder other_encoder;
+    EncoderBuffer other_key_frame;
+    ASSERT_TRUE(other_encoder
+                    .EncodeFrame(positions_.data(), kNumPoints / 2, 0,
+                                 &other_key_frame)
+                    .ok());
+    DecoderBuffer in_buffer;
+    in_buffer.Init(other_key_frame.data(), other_key_frame.size());
+    PointCloudSequenceDecoder decoder;
+    ASSERT_TRUE(decoder.DecodeFrame(&in_buffer).ok());
+    EXPECT_FALSE(
+        DecodeFrame(predicted_frame, predicted_frame.size(), &decoder).ok());
+  }
+
+  // Flipped bits in the coded points must not crash the decoder. They are
+  // not always detected, but a decoded frame stays within the grid.
+  for (int i = 0; i < 200; ++i) {
+    std::vector<char> corrupted = i % 2 ? predicted_frame : key_frame;
+    const size_t offset = 3 + rng_() % (corrupted.size() - 3);
+    corrupted[offset] ^= static_cast<char>(1 << (rng_() % 8));
+    PointCloudSequenceDecoder decoder;
+    if (i % 2) {
+      ASSERT_TRUE(DecodeFrame(key_frame, key_frame.size(), &decoder).ok());
+    }
+    if (DecodeFrame(corrupted, corrupted.size(), &decoder).ok()) {
+      const size_t num_points = decoder.num_points();
+      std::vector<float> decoded(3 * num_points);
+      decoder.GetPositions(decoded.data(), 0, num_points);
+      for (const float value : decoded) {
+        ASSERT_TRUE(std::isfinite(value));
+      }
+    }
+  }
+}
+
+// Encodes |num_frames| frames of |num_points| random points each, moving a
+// tenth of the points between frames, and returns the coded frames.
+static std::vector<std::vector<char>> EncodeFrames(
+    PointCloudSequenceEncoder *encoder, size_t num_points, int num_frames) {
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> positions(3 * num_points);
+  for (float &value : positions) {
+    value = dist(rng);
+  }
+  std::vector<std::vector<char>> frames(num_frames);
+  for (int frame = 0; frame < num_frames; ++frame) {
+    for (size_t i = 0; i < num_points / 10; ++i) {
+      positions[rng() % positions.size()] = dist(rng);
+    }
+    EncoderBuffer buffer;
+    EXPECT_TRUE(
+        encoder->EncodeFrame(positions.data(), num_points, 0, &buffer).ok());
+    frames[frame].assign(buffer.data(), buffer.data() + buffer.size());
+  }
+  return frames;
+}
+
+// Converts a predicted frame without moved points to version 3 by removing
+// the moved flags. Returns false if any point moved.
+static bool RemoveMovedFlags(std::vector<char> *frame) {
+  DecoderBuffer parser;
+  parser.Init(frame->data(), frame->size(), kDracoPointCloudBitstreamVersion);
+  parser.Advance(3);
+  uint32_t num_reference_points;
+  RAnsBitDecoder kept_decoder;
+  if (!DecodeVarint(&num_reference_points, &parser) ||
+      !kept_decoder.StartDecoding(&parser)) {
+    return false;
+  }
+  uint32_t num_not_kept = 0;
+  for (uint32_t i = 0; i < num_reference_points; ++i) {
+    num_not_kept += !kept_decoder.DecodeNextBit();
+  }
+  const int64_t moved_flags_offset = parser.decoded_size();
+  if (num_not_kept > 0) {
+    RAnsBitDecoder moved_decoder;
+    if (!moved_decoder.StartDecoding(&parser)) {
+      return false;
+    }
+    for (uint32_t i = 0; i < num_not_kept; ++i) {
+      if (moved_decoder.DecodeNextBit()) {
+        return false;
+      }
+    }
+  }
+  frame->erase(frame->begin() + moved_flags_offset,
+               frame->begin() + parser.decoded_size());
+  (*frame)[0] = 3;
+  return true;
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestSubtrees) {
+  // Frames coded as several subtrees decode to the same points as frames
+  // coded as a single kd-tree, with any number of threads.
+  constexpr size_t kNumSubtreePoints = 40000;
+  constexpr int kNumFrames = 6;
+  // Offset of the number of subtrees in a key frame.
+  constexpr size_t kNumSubtreesOffset = 3 + 1 + 4 * sizeof(float);
+  PointCloudSequenceEncoder reference_encoder;
+  reference_encoder.SetQuantizationBits(kQuantizationBits);
+  reference_encoder.SetKeyFrameInterval(4);
+  const std::vector<std::vector<char>> reference_frames =
+      EncodeFrames(&reference_encoder, kNumSubtreePoints, kNumFrames);
+  std::vector<std::vector<float>> expected_positions(kNumFrames);
+  PointCloudSequenceDecoder reference_decoder;
+  for (int frame = 0; frame < kNumFrames; ++frame) {
+    const std::vector<char> &buffer = reference_frames[frame];
+    ASSERT_TRUE(DecodeFrame(buffer, buffer.size(), &reference_decoder).ok());
+    expected_positions[frame].resize(3 * reference_decoder.num_points());
+    reference_decoder.GetPositions(expected_positions[frame].data(), 0,
+                                   reference_decoder.num_points());
+  }
+
+  for (const bool spatial_subtrees : {false, true}) {
+    for (const int depth : {0, 3, 6}) {
+      for (const int num_threads : {1, 4}) {
+        PointCloudSequenceEncoder encoder;
+        encoder.SetQuantizationBits(kQuantizationBits);
+        encoder.SetKeyFrameInterval(4);
+        encoder.SetSubtreeDepth(depth);
+        encoder.SetSpatialSubtrees(spatial_subtrees);
+        encoder.SetNumThreads(num_threads);
+        const std::vector<std::vector<char>> frames =
+            EncodeFrames(&encoder, kNumSubtreePoints, kNumFrames);
+        // Spatial cells don't depend on the number of points, sorted runs
+        // hold at least 4096 points each.
+        const size_t expected_num_subtrees =
+            spatial_subtrees ? size_t(1) << depth
+                             : std::min<size_t>(size_t(1) << depth,
+                                                kNumSubtreePoints / 4096);
+        EXPECT_EQ(static_cast<size_t>(frames[0][kNumSubtreesOffset]),
+                  expected_num_subtrees);
+
+        PointCloudSequenceDecoder decoder;
+        decoder.SetNumThreads(num_threads);
+        for (int frame = 0; frame < kNumFrames; ++frame) {
+          const std::vector<char> &buffer = frames[frame];
+          ASSERT_TRUE(DecodeFrame(buffer, buffer.size(), &decoder).ok());
+          EXPECT_EQ(decoder.is_key_frame(), frame % 4 == 0);
+          std::vector<float> positions(3 * decoder.num_points());
+          decoder.GetPositions(positions.data(), 0, decoder.num_points());
+          ASSERT_EQ(positions, expected_positions[frame])
+              << spatial_subtrees << " " << depth << " " << num_threads << " "
+              << frame;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestPositionsOutputLayout) {
+  // Positions written while decoding match GetPositions(), in sorted order
+  // or as a permutation in decoding order.
+  constexpr size_t kNumLayoutPoints = 20000;
+  constexpr int kNumFrames = 4;
+  for (const bool spatial_subtrees : {false, true}) {
+    PointCloudSequenceEncoder encoder;
+    encoder.SetQuantizationBits(kQuantizationBits);
+    encoder.SetKeyFrameInterval(2);
+    encoder.SetSubtreeDepth(3);
+    encoder.SetSpatialSubtrees(spatial_subtrees);
+    const std::vector<std::vector<char>> frames =
+        EncodeFrames(&encoder, kNumLayoutPoints, kNumFrames);
+    for (const PointCloudSequencePointOrder order :
+         {POINT_CLOUD_SEQUENCE_SORTED_ORDER,
+          POINT_CLOUD_SEQUENCE_DECODING_ORDER}) {
+      PointCloudSequenceDecoder decoder;
+      decoder.SetNumThreads(2);
+      for (int frame = 0; frame < kNumFrames; ++frame) {
+        const std::vector<char> &buffer = frames[frame];
+        DecoderBuffer in_buffer;
+        in_buffer.Init(buffer.data(), buffer.size());
+        // Interleaved with a stride of four floats and a guard value after
+        // the last point.
+        std::vector<float> output(4 * kNumLayoutPoints + 4, -7.f);
+        ASSERT_TRUE(decoder
+                        .DecodeFrame(&in_buffer,
+                                     PositionsOutputLayout::Interleaved(
+                                         output.data(), 4 * sizeof(float)),
+                                     kNumLayoutPoints + 1, order)
+                        .ok());
+        const size_t num_points = decoder.num_points();
+        ASSERT_LE(num_points, kNumLayoutPoints);
+        EXPECT_EQ(output[4 * num_points], -7.f);
+        std::vector<std::array<float, 3>> decoded(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+          decoded[i] = {output[4 * i], output[4 * i + 1], output[4 * i + 2]};
+        }
+        std::vector<float> positions(3 * num_points);
+        decoder.GetPositions(positions.data(), 0, num_points);
+        std::vector<std::array<float, 3>> expected(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+          expected[i] = {positions[3 * i], positions[3 * i + 1],
+                         positions[3 * i + 2]};
+        }
+        if (order == POINT_CLOUD_SEQUENCE_DECODING_ORDER) {
+          std::sort(decoded.begin(), decoded.end());
+          std::sort(expected.begin(), expected.end());
+        }
+        ASSERT_EQ(decoded, expected) << spatial_subtrees << " " << frame;
+
+        // Planar output.
+        std::vector<float> x(num_points), y(num_points), z(num_points);
+        PointCloudSequenceDecoder planar_decoder;
+        for (int i = frame - frame % 2; i <= frame; ++i) {
+          DecoderBuffer planar_buffer;
+          planar_buffer.Init(frames[i].data(), frames[i].size());
+          ASSERT_TRUE(planar_decoder
+                          .DecodeFrame(&planar_buffer,
+                                       PositionsOutputLayout::Planar(
+                                           x.data(), y.data(), z.data()),
+                                       num_points,
+                                       POINT_CLOUD_SEQUENCE_SORTED_ORDER)
+                          .ok());
+        }
+        for (size_t i = 0; i < num_points; ++i) {
+          ASSERT_EQ(x[i], positions[3 * i]);
+          ASSERT_EQ(y[i], positions[3 * i + 1]);
+          ASSERT_EQ(z[i], positions[3 * i + 2]);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestPositionsOutputCapacity) {
+  // A too small output is an error, but the frame is still decoded and can
+  // be used as the reference of the next frame.
+  std::vector<char> key_frame;
+  std::vector<char> predicted_frame;
+  EncodeFrame(&key_frame);
+  MovePoints(kNumPoints / 20);
+  EncodeFrame(&predicted_frame);
+  for (const PointCloudSequencePointOrder order :
+       {POINT_CLOUD_SEQUENCE_SORTED_ORDER,
+        POINT_CLOUD_SEQUENCE_DECODING_ORDER}) {
+    PointCloudSequenceDecoder decoder;
+    std::vector<float> output(3 * kNumPoints / 2 + 3, -7.f);
+    DecoderBuffer in_buffer;
+    in_buffer.Init(key_frame.data(), key_frame.size());
+    EXPECT_FALSE(decoder
+                     .DecodeFrame(&in_buffer,
+                                  PositionsOutputLayout::Interleaved(
+                                      output.data(), 0),
+                                  kNumPoints / 2, order)
+                     .ok());
+    EXPECT_EQ(decoder.num_points(), kNumPoints);
+    EXPECT_EQ(output.back(), -7.f);
+    ASSERT_TRUE(
+        DecodeFrame(predicted_frame, predicted_frame.size(), &decoder).ok());
+    ExpectPositions(decoder);
+  }
+}
+
+// Returns the positions of the current frame of |decoder| inside |region|.
+static std::vector<float> GetRegionPositions(
+    const PointCloudSequenceDecoder &decoder,
+    const PointCloudRegionQuery &region) {
+  std::vector<float> positions(3 * decoder.num_points());
+  decoder.GetPositions(positions.data(), 0, decoder.num_points());
+  std::vector<float> region_positions;
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    if (region.ContainsPoint(&positions[i])) {
+      region_positions.insert(region_positions.end(), &positions[i],
+                              &positions[i] + 3);
+    }
+  }
+  return region_positions;
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestDecodeFrameRegion) {
+  // Decoding a region gives the same points as filtering the complete frame,
+  // whether or not the cells outside of the region are skipped.
+  constexpr size_t kNumRegionPoints = 20000;
+  constexpr int kNumFrames = 6;
+  const float box_min[3] = {-0.5f, -0.2f, 0.1f};
+  const float box_max[3] = {0.3f, 0.6f, 0.9f};
+  const float outside_min[3] = {2.f, 2.f, 2.f};
+  const float outside_max[3] = {3.f, 3.f, 3.f};
+  const float planes[2][4] = {{1.f, 1.f, 0.f, 0.f}, {0.f, 0.f, -1.f, 0.5f}};
+  const PointCloudRegionQuery regions[] = {
+      PointCloudRegionQuery(),
+      PointCloudRegionQuery::FromBox(box_min, box_max),
+      PointCloudRegionQuery::FromBox(outside_min, outside_max),
+      PointCloudRegionQuery::FromPlanes(planes, 2),
+  };
+  for (const bool spatial_subtrees : {false, true}) {
+    PointCloudSequenceEncoder encoder;
+    encoder.SetQuantizationBits(kQuantizationBits);
+    encoder.SetKeyFrameInterval(3);
+    encoder.SetSubtreeDepth(4);
+    encoder.SetSpatialSubtrees(spatial_subtrees);
+    const std::vector<std::vector<char>> frames =
+        EncodeFrames(&encoder, kNumRegionPoints, kNumFrames);
+    for (const PointCloudRegionQuery &region : regions) {
+      PointCloudSequenceDecoder reference_decoder;
+      PointCloudSequenceDecoder decoder;
+      for (int frame = 0; frame < kNumFrames; ++frame) {
+        const std::vector<char> &buffer = frames[frame];
+        ASSERT_TRUE(
+            DecodeFrame(buffer, buffer.size(), &reference_decoder).ok());
+        const std::vector<float> expected =
+            GetRegionPositions(reference_decoder, region);
+        const bool key_frame = frame % 3 == 0;
+        if (!key_frame && spatial_subtrees) {
+          // The decoder was reset by the region decoded key frame and needs
+          // the complete key frame.
+          EXPECT_FALSE(DecodeFrame(buffer, buffer.size(), &decoder).ok());
+          continue;
+        }
+
+        DecoderBuffer in_buffer;
+        in_buffer.Init(buffer.data(), buffer.size());
+        std::vector<float> output(3 * kNumRegionPoints + 3, -7.f);
+        size_t num_points = 0;
+        ASSERT_TRUE(decoder
+                        .DecodeFrameRegion(&in_buffer, region,
+                                           PositionsOutputLayout::Interleaved(
+                                               output.data(), 0),
+                                           kNumRegionPoints, &num_points)
+                        .ok());
+        ASSERT_EQ(3 * num_points, expected.size());
+        EXPECT_EQ(output[3 * num_points], -7.f);
+        output.resize(3 * num_points);
+        ASSERT_EQ(output, expected) << spatial_subtrees << " " << frame;
+        // Only key frames with spatial cells skip points, after which the
+        // decoder has no reference frame.
+        EXPECT_EQ(decoder.num_points(),
+                  key_frame && spatial_subtrees
+                      ? 0u
+                      : reference_decoder.num_points());
+      }
+    }
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestDecodeFrameRegionCapacity) {
+  encoder_.SetSubtreeDepth(3);
+  encoder_.SetSpatialSubtrees(true);
+  std::vector<char> key_frame;
+  EncodeFrame(&key_frame);
+  const float box_min[3] = {-1.f, -1.f, -1.f};
+  const float box_max[3] = {0.f, 0.f, 0.f};
+  const PointCloudRegionQuery region =
+      PointCloudRegionQuery::FromBox(box_min, box_max);
+  PointCloudSequenceDecoder reference_decoder;
+  ASSERT_TRUE(DecodeFrame(key_frame, key_frame.size(), &reference_decoder)
+                  .ok());
+  const std::vector<float> expected =
+      GetRegionPositions(reference_decoder, region);
+  ASSERT_GT(expected.size(), 30u);
+
+  // The total number of points is returned, but only |capacity| points are
+  // written.
+  const size_t capacity = 10;
+  std::vector<float> output(3 * capacity + 3, -7.f);
+  DecoderBuffer in_buffer;
+  in_buffer.Init(key_frame.data(), key_frame.size());
+  PointCloudSequenceDecoder decoder;
+  size_t num_points = 0;
+  EXPECT_EQ(decoder
+                .DecodeFrameRegion(&in_buffer, region,
+                                   PositionsOutputLayout::Interleaved(
+                                       output.data(), 0),
+                                   capacity, &num_points)
+                .code(),
+            Status::INVALID_PARAMETER);
+  EXPECT_EQ(3 * num_points, expected.size());
+  EXPECT_EQ(output.back(), -7.f);
+  output.resize(3 * capacity);
+  EXPECT_TRUE(std::equal(output.begin(), output.end(), expected.begin()));
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestDecodeFrameRegionCorrupted) {
+  encoder_.SetSubtreeDepth(3);
+  encoder_.SetSpatialSubtrees(true);
+  std::vector<char> key_frame;
+  EncodeFrame(&key_frame);
+  const float box_min[3] = {-1.f, -1.f, -1.f};
+  const float box_max[3] = {0.f, 0.5f, 1.f};
+  const PointCloudRegionQuery region =
+      PointCloudRegionQuery::FromBox(box_min, box_max);
+  std::vector<float> output(3 * kNumPoints);
+  const PositionsOutputLayout layout =
+      PositionsOutputLayout::Interleaved(output.data(), 0);
+  // Truncated frames, including the sizes of the skipped cells.
+  for (size_t size = 0; size < key_frame.size(); ++size) {
+    DecoderBuffer in_buffer;
+    in_buffer.Init(key_frame.data(), size);
+    PointCloudSequenceDecoder decoder;
+    size_t num_points = 0;
+    ASSERT_FALSE(decoder
+                     .DecodeFrameRegion(&in_buffer, region, layout, kNumPoints,
+                                        &num_points)
+                     .ok())
+        << size;
+  }
+  // Flipped bits must not crash the decoder.
+  for (int i = 0; i < 200; ++i) {
+    std::vector<char> corrupted = key_frame;
+    const size_t offset = 3 + rng_() % (corrupted.size() - 3);
+    corrupted[offset] ^= static_cast<char>(1 << (rng_() % 8));
+    DecoderBuffer in_buffer;
+    in_buffer.Init(corrupted.data(), corrupted.size());
+    PointCloudSequenceDecoder decoder;
+    size_t num_points = 0;
+    decoder.DecodeFrameRegion(&in_buffer, region, layout, kNumPoints,
+                              &num_points);
+  }
+}
+
+TEST_F(PointCloudSequenceEncodingTest, TestOldVersions) {
+  // Frames written by older encoders still decode. They are derived from
+  // current frames: version 3 predicted frames have no moved points, version
+  // 2 frames no subtree layout and version 1 frames no number of subtrees.
+  constexpr size_t kNumSubtreesOffset = 3 + 1 + 4 * sizeof(float);
+  constexpr size_t kNumVersionPoints = 20000;
+  for (const int depth : {0, 2}) {
+    PointCloudSequenceEncoder encoder;
+    encoder.SetQuantizationBits(kQuantizationBits);
+    encoder.SetSubtreeDepth(depth);
+    encoder.SetKeyFrameInterval(0);
+    const std::vector<std::vector<char>> frames =
+        EncodeFrames(&encoder, kNumVersionPoints, 3);
+    const std::vector<char> &key_frame = frames[0];
+    ASSERT_EQ(static_cast<int>(key_frame[kNumSubtreesOffset]), 1 << depth);
+    PointCloudSequenceDecoder reference_decoder;
+    ASSERT_TRUE(
+        DecodeFrame(key_frame, key_frame.size(), &reference_decoder).ok());
+    std::vector<float> expected(3 * reference_decoder.num_points());
+    reference_decoder.GetPositions(expected.data(), 0,
+                                   reference_decoder.num_points());
+
+    for (const int version : {1, 2}) {
+      std::vector<char> old_frame = key_frame;
+      old_frame[0] = static_cast<char>(version);
+      if (version == 1) {
+        if (depth > 0) {
+          // Version 1 frames can't hold several subtrees.
+          continue;
+        }
+        old_frame.erase(old_frame.begin() + kNumSubtreesOffset);
+      } else if (depth > 0) {
+        old_frame.erase(old_frame.begin() + kNumSubtreesOffset + 1);
+      }
+      PointCloudSequenceDecoder decoder;
+      ASSERT_TRUE(DecodeFrame(old_frame, old_frame.size(), &decoder).ok())
+          << version << " " << depth;
+      std::vector<float> positions(3 * decoder.num_points());
+      decoder.GetPositions(positions.data(), 0, decoder.num_points());
+      EXPECT_EQ(positions, expected) << version << " " << depth;
+
+      // The predicted frames code few enough points for a single subtree,
+      // which versions 2 and 3 store the same way. Frames in which points
+      // moved to a neighboring cell can't be written by older encoders and
+      // are decoded as they are.
+      if (version == 2) {
+        int num_old_predicted_frames = 0;
+        for (size_t i = 1; i < frames.size(); ++i) {
+          std::vector<char> old_predicted_frame = frames[i];
+          if (RemoveMovedFlags(&old_predicted_frame)) {
+            old_predicted_frame[0] = static_cast<char>(version);
+            ++num_old_predicted_frames;
+          }
+          ASSERT_TRUE(DecodeFrame(frames[i], frames[i].size(),
+                                  &reference_decoder)
+                          .ok());
+          ASSERT_TRUE(DecodeFrame(old_predicted_frame,
+                                  old_predicted_frame.size(), &decoder)
+                          .ok());
+          EXPECT_EQ(decoder.num_points(), reference_decoder.num_points());
+        }
+        EXPECT_GT(num_old_predicted_frames, 0);
+      }
+    }
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,132 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_SHARED_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_SHARED_H_
+
+#include <cstdint>
+
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+
+namespace draco {
+
+// Shared constants of PointCloudSequenceEncoder and PointCloudSequenceDecoder.
+//
+// Each encoded frame starts with the following header:
+//
+//   uint8   bitstream version
+//   uint8   PointCloudSequenceFrameType
+//   uint8   compression level of the kd-tree coder [0..6]
+//
+// Key frames continue with the quantization grid of the sequence and all
+// points of the frame:
+//
+//   uint8   quantization bits
+//   float   origin[3]
+//   float   range
+//   coded points
+//
+// Predicted frames are coded against the sorted quantized points of the
+// previous frame (the reference) and use the grid of the last key frame:
+//
+//   varint  number of reference points
+//   bits    one bit per reference point, 1 if the point is kept (RAnsBit)
+//   bits    one bit per reference point that is not kept, 1 if the point
+//           moved to one of the 26 neighboring cells (RAnsBit), omitted if
+//           all points are kept
+//   bits    three bits per moved point, 1 if the point moved along the x, y
+//           and z axis respectively (RAnsBit), omitted without moved points
+//   bits    one bit per axis along which a point moved, 1 if the coordinate
+//           decreased by one, 0 if it increased by one (RAnsBit), omitted
+//           without moved points
+//   coded added points
+//
+// The reconstructed frame is the union of the kept, the moved and the added
+// points in sorted order. It is also the reference of the next frame.
+//
+// The coded points are split into subtrees, independent kd-trees that can be
+// encoded and decoded in parallel:
+//
+//   varint  number of subtrees
+//   uint8   PointCloudSequenceSubtreeLayout, omitted for a single subtree
+//   varint  size in bytes of each subtree, omitted for a single subtree
+//   kd-tree coded points of each subtree (DynamicIntegerPointsKdTreeEncoder)
+//
+// With POINT_CLOUD_SEQUENCE_SORTED_RUNS the subtrees hold consecutive runs of
+// the sorted points, so the points are sorted by sorting each subtree and
+// concatenating them. With POINT_CLOUD_SEQUENCE_SPATIAL_CELLS each subtree
+// holds the points of one cell of the grid, see GetSpatialSubtreeIndex(), and
+// the sorted subtrees are merged. The sizes of the subtrees allow skipping
+// the cells outside of a queried region. The kd-tree coded data stores the
+// number of points, so it is not repeated in the header.
+//
+// Version 1 frames store a single kd-tree without the number of subtrees.
+// Version 2 frames store no subtree layout and use sorted runs.
+// Version 3 predicted frames store no moved points.
+
+constexpr uint8_t kPointCloudSequenceBitstreamVersion = 4;
+
+enum PointCloudSequenceFrameType : uint8_t {
+  POINT_CLOUD_SEQUENCE_KEY_FRAME = 0,
+  POINT_CLOUD_SEQUENCE_PREDICTED_FRAME = 1,
+};
+
+enum PointCloudSequenceSubtreeLayout : uint8_t {
+  POINT_CLOUD_SEQUENCE_SORTED_RUNS = 0,
+  POINT_CLOUD_SEQUENCE_SPATIAL_CELLS = 1,
+};
+
+constexpr int kPointCloudSequenceMaxQuantizationBits = 30;
+
+// A frame is split into at most 2^depth subtrees.
+constexpr int kPointCloudSequenceMaxSubtreeDepth = 6;
+
+// Spatial cells split the grid like the first |depth| levels of a kd-tree,
+// cycling through the axes x, y, z and halving the cell each time. Returns
+// the index of the cell containing |point|, in range [0, 2^depth). |depth|
+// must not exceed 3 * |quantization_bits|.
+inline uint32_t GetSpatialSubtreeIndex(const Point3ui &point, int depth,
+                                       int quantization_bits) {
+  uint32_t index = 0;
+  for (int i = 0; i < depth; ++i) {
+    const int bit = quantization_bits - 1 - i / 3;
+    index = (index << 1) | ((point[i % 3] >> bit) & 1);
+  }
+  return index;
+}
+
+// Returns the inclusive range of quantized coordinates of the cell with
+// |index|.
+inline void GetSpatialSubtreeBounds(uint32_t index, int depth,
+                                    int quantization_bits,
+                                    Point3ui *out_min, Point3ui *out_max) {
+  Point3ui min_value(0, 0, 0);
+  Point3ui size(1u << quantization_bits, 1u << quantization_bits,
+                1u << quantization_bits);
+  for (int i = 0; i < depth; ++i) {
+    const int axis = i % 3;
+    size[axis] >>= 1;
+    if ((index >> (depth - 1 - i)) & 1) {
+      min_value[axis] += size[axis];
+    }
+  }
+  *out_min = min_value;
+  for (int c = 0; c < 3; ++c) {
+    (*out_max)[c] = min_value[c] + size[c] - 1;
+  }
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_SEQUENCE_SHARED_H_
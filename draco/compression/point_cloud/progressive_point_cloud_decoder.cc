@@ -0,0 +1,114 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "compression/point_cloud/progressive_point_cloud_decoder.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "compression/config/compression_shared.h"
+#include "compression/point_cloud/decoded_point_cloud.h"
+#include "core/quantization_utils.h"
+
+namespace draco {
+
+ProgressivePointCloudDecoder::ProgressivePointCloudDecoder()
+    : max_depth_(-1),
+      max_num_bytes_(-1),
+      quantization_bits_(0),
+      origin_{0.f, 0.f, 0.f},
+      range_(1.f) {}
+
+Status ProgressivePointCloudDecoder::DecodePositions(
+    DecoderBuffer *in_buffer) {
+  points_.clear();
+  // The bit coders select their format by the Draco bitstream version, the
+  // data is written with the current one.
+  in_buffer->set_bitstream_version(kDracoPointCloudBitstreamVersion);
+  uint8_t version;
+  uint8_t quantization_bits;
+  if (!in_buffer->Decode(&version) ||
+      !in_buffer->Decode(&quantization_bits) ||
+      !in_buffer->Decode(origin_, sizeof(origin_)) ||
+      !in_buffer->Decode(&range_)) {
+    return Status(Status::IO_ERROR, "Failed to parse header.");
+  }
+  if (version < 1 || version > kProgressivePointCloudBitstreamVersion) {
+    return Status(Status::UNSUPPORTED_VERSION, "Unknown bitstream version.");
+  }
+  if (quantization_bits < 1 ||
+      quantization_bits > kProgressivePointCloudMaxQuantizationBits ||
+      !std::isfinite(range_) || range_ <= 0.f) {
+    return Status(Status::IO_ERROR, "Invalid quantization grid.");
+  }
+  quantization_bits_ = quantization_bits;
+  int64_t max_tree_bytes = -1;
+  if (max_num_bytes_ >= 0) {
+    max_tree_bytes =
+        std::max<int64_t>(max_num_bytes_ - kProgressivePointCloudHeaderSize, 0);
+  }
+  kd_tree_decoder_.set_bit_coding(
+      version == 1 ? PROGRESSIVE_KD_TREE_RANS_BITS
+                   : PROGRESSIVE_KD_TREE_ADAPTIVE_RANGE_BITS);
+  if (!kd_tree_decoder_.DecodePoints(in_buffer, max_depth_, max_tree_bytes,
+                                     &points_)) {
+    points_.clear();
+    return Status(Status::IO_ERROR, "Failed to decode points.");
+  }
+  if (static_cast<int>(kd_tree_decoder_.bit_length()) != quantization_bits_) {
+    points_.clear();
+    return Status(Status::IO_ERROR, "Invalid kd-tree bit length.");
+  }
+  return OkStatus();
+}
+
+size_t ProgressivePointCloudDecoder::GetPositions(float *out_positions,
+                                                  int64_t byte_stride,
+                                                  size_t capacity) const {
+  if (byte_stride == 0) {
+    byte_stride = 3 * sizeof(float);
+  }
+  const size_t num_out_points = std::min(capacity, points_.size());
+  Dequantizer dequantizer;
+  if (!dequantizer.Init(range_, (1u << quantization_bits_) - 1)) {
+    return 0;
+  }
+  uint8_t *out = reinterpret_cast<uint8_t *>(out_positions);
+  for (size_t i = 0; i < num_out_points; ++i) {
+    float *const p = reinterpret_cast<float *>(out + byte_stride * i);
+    for (int c = 0; c < 3; ++c) {
+      p[c] = dequantizer.DequantizeFloat(points_[i][c]) + origin_[c];
+    }
+  }
+  return num_out_points;
+}
+
+std::unique_ptr<PointCloud> ProgressivePointCloudDecoder::CreatePointCloud()
+    const {
+  return CreatePointCloud(nullptr);
+}
+
+std::unique_ptr<PointCloud> ProgressivePointCloudDecoder::CreatePointCloud(
+    FrameArena *arena) const {
+  std::unique_ptr<PointCloud> pc = CreatePositionsPointCloud(
+      points_.size(),
+      [this](float *out_positions, int64_t byte_stride,
+             size_t max_num_points) {
+        return GetPositions(out_positions, byte_stride, max_num_points);
+      },
+      arena);
+  return pc;
+}
+
+}  // namespace draco
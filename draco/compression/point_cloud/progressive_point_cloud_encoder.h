@@ -0,0 +1,65 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_PROGRESSIVE_POINT_CLOUD_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_PROGRESSIVE_POINT_CLOUD_ENCODER_H_
+
+#include <vector>
+
+#include "compression/point_cloud/algorithms/point_cloud_types.h"
+#include "compression/point_cloud/algorithms/progressive_integer_points_kd_tree_encoder.h"
+#include "compression/point_cloud/progressive_point_cloud_shared.h"
+#include "core/encoder_buffer.h"
+#include "core/status.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Encodes the positions of a point cloud into a progressive bitstream that is
+// ordered from coarse to fine levels of detail. A decoder can stop after any
+// level (or byte budget) and still get a uniformly subsampled point cloud,
+// which allows previews from a prefix of the data. See
+// progressive_point_cloud_shared.h for the bitstream layout.
+//
+// The positions are quantized on a uniform grid spanning the bounding box of
+// the points. The order of the decoded points is not preserved.
+class ProgressivePointCloudEncoder {
+ public:
+  ProgressivePointCloudEncoder();
+
+  // Number of bits used to quantize each coordinate. Each bit adds three
+  // levels of detail.
+  void SetQuantizationBits(int quantization_bits) {
+    quantization_bits_ = quantization_bits;
+  }
+
+  // Encodes |num_points| float triplets that are |byte_stride| bytes apart
+  // (0 means tightly packed).
+  Status EncodePositions(const float *positions, size_t num_points,
+                         int64_t byte_stride, EncoderBuffer *out_buffer);
+
+  // Encodes the POSITION attribute of |pc|.
+  Status EncodePointCloud(const PointCloud &pc, EncoderBuffer *out_buffer);
+
+ private:
+  int quantization_bits_;
+
+  // Scratch storage reused between calls.
+  std::vector<Point3ui> points_;
+  ProgressiveIntegerPointsKdTreeEncoder kd_tree_encoder_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_PROGRESSIVE_POINT_CLOUD_ENCODER_H_
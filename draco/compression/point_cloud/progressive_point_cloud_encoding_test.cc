@@ -0,0 +1,360 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "compression/bit_coders/rans_bit_encoder.h"
+#include "compression/point_cloud/progressive_point_cloud_decoder.h"
+#include "compression/point_cloud/progressive_point_cloud_encoder.h"
+#include "core/bit_utils.h"
+#include "core/draco_test_base.h"
+#include "core/varint_encoding.h"
+
+namespace draco {
+
+class ProgressivePointCloudEncodingTest : public ::testing::Test {
+ protected:
+  ProgressivePointCloudEncodingTest() : rng_(3) {}
+
+  // Creates |num_points| random points with integer coordinates. The first
+  // two points span the whole grid, so the points are quantized without loss
+  // and the decoded positions must match exactly.
+  void CreatePoints(size_t num_points) {
+    const uint32_t max_value = (1u << kQuantizationBits) - 1;
+    positions_ = {0.f, 0.f, 0.f, static_cast<float>(max_value),
+                  static_cast<float>(max_value), static_cast<float>(max_value)};
+    std::uniform_int_distribution<uint32_t> dist(0, max_value);
+    while (positions_.size() < 3 * num_points) {
+      positions_.push_back(static_cast<float>(dist(rng_)));
+    }
+  }
+
+  void Encode(std::vector<char> *out_data) {
+    ProgressivePointCloudEncoder encoder;
+    encoder.SetQuantizationBits(kQuantizationBits);
+    EncoderBuffer buffer;
+    ASSERT_TRUE(encoder
+                    .EncodePositions(positions_.data(), positions_.size() / 3,
+                                     0, &buffer)
+                    .ok());
+    out_data->assign(buffer.data(), buffer.data() + buffer.size());
+  }
+
+  // Decodes the first |size| bytes of |data|.
+  static Status Decode(const std::vector<char> &data, size_t size,
+                       ProgressivePointCloudDecoder *decoder) {
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), size);
+    return decoder->DecodePositions(&buffer);
+  }
+
+  static std::vector<float> GetSortedPositions(
+      const ProgressivePointCloudDecoder &decoder) {
+    std::vector<float> positions(3 * decoder.num_points());
+    decoder.GetPositions(positions.data(), 0, decoder.num_points());
+    return SortPoints(positions);
+  }
+
+  static std::vector<float> SortPoints(const std::vector<float> &positions) {
+    std::vector<std::array<float, 3>> points(positions.size() / 3);
+    for (size_t i = 0; i < points.size(); ++i) {
+      points[i] = {positions[3 * i], positions[3 * i + 1],
+                   positions[3 * i + 2]};
+    }
+    std::sort(points.begin(), points.end());
+    std::vector<float> sorted;
+    for (const std::array<float, 3> &point : points) {
+      sorted.insert(sorted.end(), point.begin(), point.end());
+    }
+    return sorted;
+  }
+
+  // Encodes |positions_| like version 1 of the encoder, which coded the
+  // kd-tree levels with RAnsBitEncoder.
+  void EncodeVersion1(std::vector<char> *out_data) const {
+    std::vector<Point3ui> points(positions_.size() / 3);
+    for (size_t i = 0; i < points.size(); ++i) {
+      for (int c = 0; c < 3; ++c) {
+        points[i][c] = static_cast<uint32_t>(positions_[3 * i + c]);
+      }
+    }
+    EncoderBuffer buffer;
+    buffer.Encode(static_cast<uint8_t>(1));
+    buffer.Encode(static_cast<uint8_t>(kQuantizationBits));
+    const float origin[3] = {0.f, 0.f, 0.f};
+    buffer.Encode(origin, sizeof(origin));
+    buffer.Encode(static_cast<float>((1u << kQuantizationBits) - 1));
+    buffer.Encode(static_cast<uint8_t>(kQuantizationBits));
+    EncodeVarint(static_cast<uint32_t>(points.size()), &buffer);
+
+    struct Cell {
+      uint32_t begin;
+      uint32_t end;
+      Point3ui base;
+    };
+    std::vector<Cell> cells = {
+        {0, static_cast<uint32_t>(points.size()), Point3ui(0, 0, 0)}};
+    for (int level = 0; level < 3 * kQuantizationBits; ++level) {
+      const int axis = level % 3;
+      const uint32_t modifier = 1u << (kQuantizationBits - 1 - level / 3);
+      RAnsBitEncoder half_encoder;
+      RAnsBitEncoder numbers_encoder;
+      half_encoder.StartEncoding();
+      numbers_encoder.StartEncoding();
+      bool has_numbers = false;
+      std::vector<Cell> next_cells;
+      for (const Cell &cell : cells) {
+        const uint32_t split_value = cell.base[axis] + modifier;
+        const uint32_t split =
+            cell.begin +
+            static_cast<uint32_t>(
+                std::partition(points.begin() + cell.begin,
+                               points.begin() + cell.end,
+                               [axis, split_value](const Point3ui &p) {
+                                 return p[axis] < split_value;
+                               }) -
+                (points.begin() + cell.begin));
+        const uint32_t num_points = cell.end - cell.begin;
+        const uint32_t first_half = split - cell.begin;
+        const uint32_t second_half = cell.end - split;
+        const bool left = first_half < second_half;
+        const int required_bits = MostSignificantBit(num_points);
+        if (required_bits > 0) {
+          numbers_encoder.EncodeLeastSignificantBits32(
+              required_bits,
+              num_points / 2 - (left ? first_half : second_half));
+          has_numbers = true;
+        }
+        if (first_half != second_half) {
+          half_encoder.EncodeBit(left);
+        }
+        if (first_half > 0) {
+          next_cells.push_back({cell.begin, split, cell.base});
+        }
+        if (second_half > 0) {
+          Cell second_cell = {split, cell.end, cell.base};
+          second_cell.base[axis] += modifier;
+          next_cells.push_back(second_cell);
+        }
+      }
+      EncoderBuffer level_buffer;
+      half_encoder.EndEncoding(&level_buffer);
+      if (has_numbers) {
+        numbers_encoder.EndEncoding(&level_buffer);
+      }
+      EncodeVarint(static_cast<uint64_t>(level_buffer.size()), &buffer);
+      buffer.Encode(level_buffer.data(), level_buffer.size());
+      cells.swap(next_cells);
+    }
+    out_data->assign(buffer.data(), buffer.data() + buffer.size());
+  }
+
+  static constexpr int kQuantizationBits = 8;
+
+  std::mt19937 rng_;
+  std::vector<float> positions_;
+};
+
+TEST_F(ProgressivePointCloudEncodingTest, TestRoundTrip) {
+  for (const size_t num_points : {2, 3, 100, 5000}) {
+    CreatePoints(num_points);
+    std::vector<char> data;
+    Encode(&data);
+    ProgressivePointCloudDecoder decoder;
+    ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+    EXPECT_TRUE(decoder.is_complete());
+    EXPECT_EQ(decoder.depth(), 3 * kQuantizationBits);
+    EXPECT_EQ(decoder.num_encoded_points(), num_points);
+    EXPECT_EQ(GetSortedPositions(decoder), SortPoints(positions_));
+  }
+}
+
+TEST_F(ProgressivePointCloudEncodingTest, TestDuplicatePoints) {
+  CreatePoints(10);
+  // Each point is repeated a few times.
+  const std::vector<float> points = positions_;
+  for (int i = 0; i < 3; ++i) {
+    positions_.insert(positions_.end(), points.begin(), points.end());
+  }
+  std::vector<char> data;
+  Encode(&data);
+  ProgressivePointCloudDecoder decoder;
+  ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+  EXPECT_EQ(GetSortedPositions(decoder), SortPoints(positions_));
+}
+
+TEST_F(ProgressivePointCloudEncodingTest, TestEmptyPointCloud) {
+  positions_.clear();
+  std::vector<char> data;
+  Encode(&data);
+  ProgressivePointCloudDecoder decoder;
+  ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+  EXPECT_EQ(decoder.num_points(), 0u);
+  EXPECT_TRUE(decoder.is_complete());
+}
+
+TEST_F(ProgressivePointCloudEncodingTest, TestLevelsOfDetail) {
+  CreatePoints(5000);
+  std::vector<char> data;
+  Encode(&data);
+  size_t last_num_points = 0;
+  for (int depth = 0; depth <= 3 * kQuantizationBits; ++depth) {
+    ProgressivePointCloudDecoder decoder;
+    decoder.SetMaxDepth(depth);
+    ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+    EXPECT_EQ(decoder.depth(), depth);
+    EXPECT_EQ(decoder.num_levels(), 3 * kQuantizationBits);
+    EXPECT_EQ(decoder.is_complete(), depth == 3 * kQuantizationBits);
+    // Each level refines the cells of the previous one.
+    EXPECT_GE(decoder.num_points(), last_num_points);
+    EXPECT_LE(decoder.num_points(), decoder.num_encoded_points());
+    last_num_points = decoder.num_points();
+    if (depth == 0) {
+      EXPECT_EQ(decoder.num_points(), 1u);
+    }
+    if (depth % 3 != 0 || depth == 3 * kQuantizationBits) {
+      continue;
+    }
+    // A point at the center of each occupied cube of the level.
+    const float cell_size =
+        static_cast<float>(1u << (kQuantizationBits - depth / 3));
+    std::vector<float> positions(3 * decoder.num_points());
+    decoder.GetPositions(positions.data(), 0, decoder.num_points());
+    for (size_t i = 0; i < positions.size(); ++i) {
+      const float offset = std::fmod(positions[i], cell_size);
+      EXPECT_NEAR(offset, cell_size / 2, 1e-3f);
+    }
+  }
+}
+
+TEST_F(ProgressivePointCloudEncodingTest, TestByteBudget) {
+  CreatePoints(5000);
+  std::vector<char> data;
+  Encode(&data);
+  // The budget must cover the header, the bit length and the varint coded
+  // number of points.
+  {
+    ProgressivePointCloudDecoder decoder;
+    decoder.SetMaxNumBytes(kProgressivePointCloudHeaderSize + 2);
+    EXPECT_FALSE(
+        Decode(data, kProgressivePointCloudHeaderSize + 2, &decoder).ok());
+  }
+  int last_depth = 0;
+  for (size_t size = kProgressivePointCloudHeaderSize + 3; size < data.size();
+       size += 97) {
+    // The budget limits the data that is read, so the input may be truncated.
+    ProgressivePointCloudDecoder decoder;
+    decoder.SetMaxNumBytes(size);
+    ASSERT_TRUE(Decode(data, size, &decoder).ok()) << size;
+    EXPECT_GE(decoder.depth(), last_depth);
+    last_depth = decoder.depth();
+    EXPECT_FALSE(decoder.is_complete());
+  }
+  ProgressivePointCloudDecoder decoder;
+  decoder.SetMaxNumBytes(data.size());
+  ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+  EXPECT_TRUE(decoder.is_complete());
+  EXPECT_EQ(GetSortedPositions(decoder), SortPoints(positions_));
+}
+
+TEST_F(ProgressivePointCloudEncodingTest, TestVersion1) {
+  CreatePoints(2000);
+  std::vector<char> data;
+  Encode(&data);
+  std::vector<char> version1_data;
+  EncodeVersion1(&version1_data);
+  ASSERT_EQ(version1_data[0], 1);
+  for (const int depth : {0, 5, 12, -1}) {
+    ProgressivePointCloudDecoder decoder;
+    decoder.SetMaxDepth(depth);
+    ASSERT_TRUE(Decode(data, data.size(), &decoder).ok());
+    ProgressivePointCloudDecoder version1_decoder;
+    version1_decoder.SetMaxDepth(depth);
+    ASSERT_TRUE(
+        Decode(version1_data, version1_data.size(), &version1_decoder).ok());
+    EXPECT_EQ(version1_decoder.depth(), decoder.depth());
+    EXPECT_EQ(GetSortedPositions(version1_decoder),
+              GetSortedPositions(decoder));
+  }
+}
+
+TEST_F(ProgressivePointCloudEncodingTest, TestTruncatedData) {
+  CreatePoints(300);
+  std::vector<char> data;
+  Encode(&data);
+  // Without a byte budget all levels are required.
+  for (size_t size = 0; size < data.size(); ++size) {
+    ProgressivePointCloudDecoder decoder;
+    ASSERT_FALSE(Decode(data, size, &decoder).ok()) << size;
+    EXPECT_EQ(decoder.num_points(), 0u);
+  }
+}
+
+TEST_F(ProgressivePointCloudEncodingTest, TestCorruptedData) {
+  CreatePoints(300);
+  std::vector<char> data;
+  Encode(&data);
+  const struct {
+    int offset;
+    char value;
+  } corruptions[] = {
+      {0, 0},  // Version.
+      {0, kProgressivePointCloudBitstreamVersion + 1},
+      {1, 0},  // Quantization bits.
+      {1, kProgressivePointCloudMaxQuantizationBits + 1},
+      {1, kQuantizationBits + 1},  // Does not match the kd-tree.
+      {17, static_cast<char>(0xff)},  // Negative range.
+      {18, 33},  // Kd-tree bit length.
+  };
+  for (const auto &corruption : corruptions) {
+    std::vector<char> corrupted = data;
+    corrupted[corruption.offset] = corruption.value;
+    ProgressivePointCloudDecoder decoder;
+    EXPECT_FALSE(Decode(corrupted, corrupted.size(), &decoder).ok())
+        << corruption.offset;
+    EXPECT_EQ(decoder.num_points(), 0u);
+  }
+  {
+    std::vector<char> corrupted = data;
+    corrupted[0] = kProgressivePointCloudBitstreamVersion + 1;
+    ProgressivePointCloudDecoder decoder;
+    EXPECT_EQ(Decode(corrupted, corrupted.size(), &decoder).code(),
+              Status::UNSUPPORTED_VERSION);
+  }
+
+  // Flipped bits in the kd-tree must not crash the decoder. They are not
+  // always detected, but the decoded points stay within the grid.
+  for (int i = 0; i < 500; ++i) {
+    std::vector<char> corrupted = data;
+    const size_t offset =
+        kProgressivePointCloudHeaderSize +
+        rng_() % (data.size() - kProgressivePointCloudHeaderSize);
+    corrupted[offset] ^= static_cast<char>(1 << (rng_() % 8));
+    ProgressivePointCloudDecoder decoder;
+    if (Decode(corrupted, corrupted.size(), &decoder).ok()) {
+      std::vector<float> positions(3 * decoder.num_points());
+      decoder.GetPositions(positions.data(), 0, decoder.num_points());
+      for (const float value : positions) {
+        ASSERT_GE(value, 0.f);
+        ASSERT_LE(value, static_cast<float>((1u << kQuantizationBits) - 1));
+      }
+    }
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,48 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_PROGRESSIVE_POINT_CLOUD_SHARED_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_PROGRESSIVE_POINT_CLOUD_SHARED_H_
+
+#include <cstdint>
+
+namespace draco {
+
+// Shared constants of ProgressivePointCloudEncoder and
+// ProgressivePointCloudDecoder.
+//
+// Bitstream:
+//
+//   uint8   bitstream version
+//   uint8   quantization bits
+//   float   origin[3]
+//   float   range
+//   kd-tree coded points (ProgressiveIntegerPointsKdTreeEncoder)
+//
+// The kd-tree data is ordered coarse to fine, so the header together with any
+// number of complete kd-tree levels can be decoded.
+//
+// Version 1 coded the kd-tree levels with RAnsBit coders, version 2 with
+// AdaptiveRangeBit coders. Both versions can be decoded.
+
+constexpr uint8_t kProgressivePointCloudBitstreamVersion = 2;
+
+// Size of the bitstream header in bytes.
+constexpr int64_t kProgressivePointCloudHeaderSize = 18;
+
+constexpr int kProgressivePointCloudMaxQuantizationBits = 30;
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_PROGRESSIVE_POINT_CLOUD_SHARED_H_
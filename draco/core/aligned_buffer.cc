@@ -0,0 +1,145 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "core/aligned_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace draco {
+
+namespace {
+
+uint8_t *AllocateAligned(size_t size) {
+  return static_cast<uint8_t *>(
+      ::operator new(size, std::align_val_t(AlignedBuffer::kAlignment)));
+}
+
+void FreeAligned(uint8_t *data) {
+  ::operator delete(data, std::align_val_t(AlignedBuffer::kAlignment));
+}
+
+}  // namespace
+
+AlignedBuffer::AlignedBuffer()
+    : data_(nullptr), size_(0), capacity_(0), is_external_(false) {}
+
+AlignedBuffer::AlignedBuffer(const AlignedBuffer &buffer) : AlignedBuffer() {
+  *this = buffer;
+}
+
+AlignedBuffer::AlignedBuffer(AlignedBuffer &&buffer) : AlignedBuffer() {
+  *this = std::move(buffer);
+}
+
+AlignedBuffer &AlignedBuffer::operator=(const AlignedBuffer &buffer) {
+  if (this == &buffer) {
+    return *this;
+  }
+  // The copy always owns its storage.
+  if (is_external_) {
+    ReleaseStorage();
+  }
+  size_ = 0;
+  ResizeUninitialized(buffer.size_);
+  if (size_ > 0) {
+    memcpy(data_, buffer.data_, size_);
+  }
+  return *this;
+}
+
+AlignedBuffer &AlignedBuffer::operator=(AlignedBuffer &&buffer) {
+  if (this == &buffer) {
+    return *this;
+  }
+  ReleaseStorage();
+  data_ = buffer.data_;
+  size_ = buffer.size_;
+  capacity_ = buffer.capacity_;
+  is_external_ = buffer.is_external_;
+  deleter_ = std::move(buffer.deleter_);
+  buffer.data_ = nullptr;
+  buffer.size_ = 0;
+  buffer.capacity_ = 0;
+  buffer.is_external_ = false;
+  buffer.deleter_ = nullptr;
+  return *this;
+}
+
+AlignedBuffer::~AlignedBuffer() { ReleaseStorage(); }
+
+void AlignedBuffer::Resize(size_t new_size) {
+  const size_t old_size = size_;
+  ResizeUninitialized(new_size);
+  if (size_ > old_size) {
+    memset(data_ + old_size, 0, size_ - old_size);
+  }
+}
+
+void AlignedBuffer::ResizeUninitialized(size_t new_size) {
+  if (new_size > capacity_) {
+    // Grow geometrically so that repeated appends stay linear.
+    Grow(std::max(new_size, is_external_ ? new_size : 2 * capacity_));
+  }
+  size_ = new_size;
+}
+
+void AlignedBuffer::Reserve(size_t capacity) {
+  if (capacity > capacity_) {
+    Grow(capacity);
+  }
+}
+
+void AlignedBuffer::Clear() { ReleaseStorage(); }
+
+void AlignedBuffer::AdoptExternal(uint8_t *data, size_t size,
+                                  Deleter deleter) {
+  ReleaseStorage();
+  data_ = data;
+  size_ = size;
+  capacity_ = size;
+  is_external_ = true;
+  deleter_ = std::move(deleter);
+}
+
+void AlignedBuffer::Grow(size_t capacity) {
+  uint8_t *const new_data = AllocateAligned(capacity);
+  if (size_ > 0) {
+    memcpy(new_data, data_, size_);
+  }
+  const size_t size = size_;
+  ReleaseStorage();
+  data_ = new_data;
+  size_ = size;
+  capacity_ = capacity;
+}
+
+void AlignedBuffer::ReleaseStorage() {
+  if (is_external_) {
+    if (deleter_) {
+      deleter_(data_);
+    }
+    deleter_ = nullptr;
+    is_external_ = false;
+  } else if (data_ != nullptr) {
+    FreeAligned(data_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+}
+
+}  // namespace draco
@@ -0,0 +1,90 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_ALIGNED_BUFFER_H_
+#define DRACO_CORE_ALIGNED_BUFFER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace draco {
+
+// Byte storage for data that is overwritten right after it is allocated,
+// such as staging buffers and inputs of SIMD kernels. Unlike a
+// std::vector<uint8_t> it can grow without zero-filling, its storage is
+// aligned to kAlignment bytes, and it can use external memory (a mapped file,
+// the CPU side of a GPU buffer) in place, see AdoptExternal().
+//
+// DataBuffer, which holds the values of a PointAttribute, keeps its
+// std::vector storage because its layout is shared with the prebuilt
+// library.
+class AlignedBuffer {
+ public:
+  // Called with the data pointer when external memory is released.
+  typedef std::function<void(uint8_t *)> Deleter;
+
+  // Alignment of the storage allocated by the buffer, suitable for SIMD loads
+  // and stores of any width.
+  static constexpr size_t kAlignment = 64;
+
+  AlignedBuffer();
+  AlignedBuffer(const AlignedBuffer &buffer);
+  AlignedBuffer(AlignedBuffer &&buffer);
+  AlignedBuffer &operator=(const AlignedBuffer &buffer);
+  AlignedBuffer &operator=(AlignedBuffer &&buffer);
+  ~AlignedBuffer();
+
+  // Changes the size keeping the data unchanged. New bytes are set to zero.
+  void Resize(size_t new_size);
+  // Same as Resize() but the new bytes are left uninitialized. Use when the
+  // caller overwrites the whole buffer anyway.
+  void ResizeUninitialized(size_t new_size);
+  // Makes sure the buffer can grow to |capacity| bytes without reallocation.
+  void Reserve(size_t capacity);
+  // Frees or releases the storage of the buffer, which becomes empty.
+  void Clear();
+
+  // Uses |size| bytes of external memory at |data| as the new buffer content
+  // without making a copy. |deleter| is called when the buffer no longer uses
+  // the memory. If |deleter| is empty the memory is only borrowed and the
+  // caller must keep it valid for the lifetime of the buffer. The buffer
+  // moves to its own storage only if it has to grow past |size|. Memory that
+  // is not writable may be used only if the buffer is not modified.
+  void AdoptExternal(uint8_t *data, size_t size, Deleter deleter);
+
+  // Returns true if the buffer uses external memory.
+  bool is_external() const { return is_external_; }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  const uint8_t *data() const { return data_; }
+  uint8_t *data() { return data_; }
+
+ private:
+  // Makes sure the buffer owns at least |capacity| bytes of storage, keeping
+  // the first |size_| bytes.
+  void Grow(size_t capacity);
+  void ReleaseStorage();
+
+  uint8_t *data_;
+  size_t size_;
+  size_t capacity_;
+  bool is_external_;
+  Deleter deleter_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_ALIGNED_BUFFER_H_
@@ -0,0 +1,188 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "core/aligned_buffer.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class AlignedBufferTest : public ::testing::Test {
+ protected:
+  static bool IsAligned(const AlignedBuffer &buffer) {
+    return reinterpret_cast<uintptr_t>(buffer.data()) %
+               AlignedBuffer::kAlignment ==
+           0;
+  }
+
+  // Sets the bytes of |buffer| to 1, 2, 3, ...
+  static void Fill(AlignedBuffer *buffer) {
+    for (size_t i = 0; i < buffer->size(); ++i) {
+      buffer->data()[i] = static_cast<uint8_t>(i + 1);
+    }
+  }
+};
+
+TEST_F(AlignedBufferTest, TestResize) {
+  AlignedBuffer buffer;
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_EQ(buffer.data(), nullptr);
+
+  for (const size_t size : {1, 3, 64, 65, 1000}) {
+    buffer.ResizeUninitialized(size);
+    ASSERT_EQ(buffer.size(), size);
+    EXPECT_GE(buffer.capacity(), size);
+    EXPECT_TRUE(IsAligned(buffer)) << size;
+    Fill(&buffer);
+  }
+
+  // Growing keeps the data and Resize() zeroes the new bytes.
+  buffer.Resize(10);
+  buffer.Resize(2000);
+  ASSERT_EQ(buffer.size(), 2000u);
+  EXPECT_TRUE(IsAligned(buffer));
+  for (size_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(buffer.data()[i], i + 1);
+  }
+  for (size_t i = 10; i < 2000; ++i) {
+    ASSERT_EQ(buffer.data()[i], 0) << i;
+  }
+
+  // Shrinking keeps the storage.
+  const uint8_t *const data = buffer.data();
+  buffer.ResizeUninitialized(5);
+  EXPECT_EQ(buffer.data(), data);
+  buffer.ResizeUninitialized(2000);
+  EXPECT_EQ(buffer.data(), data);
+
+  buffer.Clear();
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_EQ(buffer.capacity(), 0u);
+  EXPECT_EQ(buffer.data(), nullptr);
+}
+
+TEST_F(AlignedBufferTest, TestReserve) {
+  AlignedBuffer buffer;
+  buffer.Resize(16);
+  Fill(&buffer);
+  buffer.Reserve(4096);
+  EXPECT_GE(buffer.capacity(), 4096u);
+  EXPECT_EQ(buffer.size(), 16u);
+  EXPECT_EQ(buffer.data()[15], 16);
+  EXPECT_TRUE(IsAligned(buffer));
+
+  // No reallocation up to the reserved capacity.
+  const uint8_t *const data = buffer.data();
+  buffer.ResizeUninitialized(4096);
+  EXPECT_EQ(buffer.data(), data);
+  buffer.Reserve(100);
+  EXPECT_EQ(buffer.data(), data);
+}
+
+TEST_F(AlignedBufferTest, TestCopyAndMove) {
+  AlignedBuffer buffer;
+  buffer.ResizeUninitialized(100);
+  Fill(&buffer);
+
+  AlignedBuffer copy(buffer);
+  ASSERT_EQ(copy.size(), 100u);
+  EXPECT_NE(copy.data(), buffer.data());
+  EXPECT_TRUE(IsAligned(copy));
+  EXPECT_EQ(memcmp(copy.data(), buffer.data(), 100), 0);
+
+  const uint8_t *const data = buffer.data();
+  AlignedBuffer moved(std::move(buffer));
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_EQ(moved.size(), 100u);
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_EQ(buffer.data(), nullptr);
+
+  copy = moved;
+  EXPECT_EQ(memcmp(copy.data(), moved.data(), 100), 0);
+  copy = AlignedBuffer();
+  EXPECT_EQ(copy.size(), 0u);
+}
+
+TEST_F(AlignedBufferTest, TestAdoptExternal) {
+  std::vector<uint8_t> external = {5, 6, 7, 8};
+  int num_deleted = 0;
+  uint8_t *deleted_data = nullptr;
+  {
+    AlignedBuffer buffer;
+    buffer.AdoptExternal(external.data(), external.size(),
+                         [&](uint8_t *data) {
+                           ++num_deleted;
+                           deleted_data = data;
+                         });
+    EXPECT_TRUE(buffer.is_external());
+    // The memory is used in place.
+    EXPECT_EQ(buffer.data(), external.data());
+    EXPECT_EQ(buffer.size(), 4u);
+
+    // Shrinking and growing up to the external size stays in place.
+    buffer.ResizeUninitialized(2);
+    buffer.ResizeUninitialized(4);
+    EXPECT_EQ(buffer.data(), external.data());
+    EXPECT_EQ(num_deleted, 0);
+
+    // Copies own their storage.
+    const AlignedBuffer copy(buffer);
+    EXPECT_FALSE(copy.is_external());
+    EXPECT_EQ(memcmp(copy.data(), external.data(), 4), 0);
+
+    // Growing past the external size moves to owned storage and releases
+    // the external memory.
+    buffer.Resize(6);
+    EXPECT_FALSE(buffer.is_external());
+    EXPECT_NE(buffer.data(), external.data());
+    EXPECT_TRUE(IsAligned(buffer));
+    EXPECT_EQ(num_deleted, 1);
+    EXPECT_EQ(deleted_data, external.data());
+    const uint8_t expected[] = {5, 6, 7, 8, 0, 0};
+    EXPECT_EQ(memcmp(buffer.data(), expected, 6), 0);
+  }
+  EXPECT_EQ(num_deleted, 1);
+
+  // The deleter is called when the buffer is destroyed, cleared or adopts
+  // other memory.
+  num_deleted = 0;
+  {
+    AlignedBuffer buffer;
+    buffer.AdoptExternal(external.data(), external.size(),
+                         [&](uint8_t *) { ++num_deleted; });
+  }
+  EXPECT_EQ(num_deleted, 1);
+  {
+    AlignedBuffer buffer;
+    buffer.AdoptExternal(external.data(), external.size(),
+                         [&](uint8_t *) { ++num_deleted; });
+    buffer.Clear();
+    EXPECT_EQ(num_deleted, 2);
+    EXPECT_FALSE(buffer.is_external());
+    buffer.AdoptExternal(external.data(), external.size(),
+                         [&](uint8_t *) { ++num_deleted; });
+    buffer.AdoptExternal(external.data(), 2, nullptr);
+    EXPECT_EQ(num_deleted, 3);
+    EXPECT_EQ(buffer.size(), 2u);
+  }
+  // Borrowed memory has no deleter.
+  EXPECT_EQ(num_deleted, 3);
+  EXPECT_EQ(external[0], 5);
+}
+
+}  // namespace draco
@@ -17,6 +17,7 @@
 
 #include <cstring>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 #include "core/draco_types.h"
@@ -61,6 +62,22 @@ class DataBuffer {
            src_buf->data() + src_offset, size);
   }
 
+  // Takes ownership of |data| and uses it as the new buffer content. No copy of
+  // the input data is made.
+  void Adopt(std::vector<uint8_t> &&data) {
+    data_ = std::move(data);
+    descriptor_.buffer_update_count++;
+  }
+
+  // Moves the buffer content out without making a copy. The buffer becomes
+  // empty.
+  std::vector<uint8_t> Release() {
+    std::vector<uint8_t> data;
+    data.swap(data_);
+    descriptor_.buffer_update_count++;
+    return data;
+  }
+
   void set_update_count(int64_t buffer_update_count) {
     descriptor_.buffer_update_count = buffer_update_count;
   }
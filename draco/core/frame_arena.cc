@@ -0,0 +1,48 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "core/frame_arena.h"
+
+#include <utility>
+
+namespace draco {
+
+std::vector<uint8_t> FrameArena::AcquireBuffer(size_t size) {
+  std::vector<uint8_t> buffer;
+  if (!recycled_buffers_.empty()) {
+    // The largest buffer is the most likely to fit without reallocation.
+    size_t best = 0;
+    for (size_t i = 1; i < recycled_buffers_.size(); ++i) {
+      if (recycled_buffers_[i].capacity() >
+          recycled_buffers_[best].capacity()) {
+        best = i;
+      }
+    }
+    buffer.swap(recycled_buffers_[best]);
+    recycled_buffers_[best].swap(recycled_buffers_.back());
+    recycled_buffers_.pop_back();
+  }
+  buffer.resize(size);
+  return buffer;
+}
+
+void FrameArena::RecycleBuffer(std::vector<uint8_t> &&buffer) {
+  if (buffer.capacity() == 0 ||
+      recycled_buffers_.size() == kMaxNumRecycledBuffers) {
+    return;
+  }
+  recycled_buffers_.push_back(std::move(buffer));
+}
+
+}  // namespace draco
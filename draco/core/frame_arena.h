@@ -0,0 +1,75 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_FRAME_ARENA_H_
+#define DRACO_CORE_FRAME_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace draco {
+
+// Recycles the attribute storage of decoded frames, so that decoding a
+// sequence of frames of a steady size does not allocate or clear the
+// attribute values of each frame.
+//
+// The attribute storage of a PointCloud is a std::vector owned by a
+// DataBuffer of the prebuilt library, so it can't be carved out of a block of
+// memory owned by the arena. The arena keeps the released vectors instead and
+// hands them out again, see AcquireBuffer().
+//
+// Decoders that keep their frames in place, like FrameSequencePlayer with its
+// ring of point clouds and EncoderSession with its reused point cloud, don't
+// need an arena.
+//
+// The arena is not thread safe. Each decoding thread should own its arena.
+//
+// Usage:
+//   FrameArena arena;
+//   while (NextFrame(&buffer)) {
+//     DRACO_RETURN_IF_ERROR(decoder.DecodeFrame(&buffer));
+//     std::unique_ptr<PointCloud> pc = decoder.CreatePointCloud(&arena);
+//     Render(*pc);
+//     RecyclePointCloud(std::move(pc), &arena);
+//   }
+class FrameArena {
+ public:
+  // Maximum number of buffers kept by RecycleBuffer(), enough for the
+  // attributes of a few point clouds in flight.
+  static constexpr size_t kMaxNumRecycledBuffers = 8;
+
+  FrameArena() {}
+  FrameArena(const FrameArena &) = delete;
+  FrameArena &operator=(const FrameArena &) = delete;
+
+  // Returns a buffer of |size| bytes that reuses the storage of a buffer
+  // passed to RecycleBuffer() if there is one. The content of the buffer is
+  // unspecified: only bytes past the size of the recycled buffer are zeroed,
+  // so buffers of a steady frame size are neither reallocated nor cleared.
+  std::vector<uint8_t> AcquireBuffer(size_t size);
+  // Keeps the storage of |buffer| for a later AcquireBuffer(). Empty buffers
+  // and buffers past the maximum number of kept buffers are released.
+  void RecycleBuffer(std::vector<uint8_t> &&buffer);
+
+  // Number of buffers kept for AcquireBuffer().
+  size_t num_recycled_buffers() const { return recycled_buffers_.size(); }
+
+ private:
+  std::vector<std::vector<uint8_t>> recycled_buffers_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_FRAME_ARENA_H_
@@ -0,0 +1,89 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "core/frame_arena.h"
+
+#include <utility>
+#include <vector>
+
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+TEST(FrameArenaTest, TestAcquireWithoutRecycledBuffers) {
+  FrameArena arena;
+  const std::vector<uint8_t> buffer = arena.AcquireBuffer(100);
+  ASSERT_EQ(buffer.size(), 100u);
+  for (const uint8_t value : buffer) {
+    ASSERT_EQ(value, 0);
+  }
+  EXPECT_EQ(arena.num_recycled_buffers(), 0u);
+}
+
+TEST(FrameArenaTest, TestRecycleBuffer) {
+  FrameArena arena;
+  std::vector<uint8_t> buffer = arena.AcquireBuffer(1000);
+  buffer[0] = 7;
+  const uint8_t *const data = buffer.data();
+  arena.RecycleBuffer(std::move(buffer));
+  EXPECT_EQ(arena.num_recycled_buffers(), 1u);
+
+  // A frame of the same or a smaller size reuses the storage without
+  // clearing it.
+  buffer = arena.AcquireBuffer(1000);
+  EXPECT_EQ(buffer.data(), data);
+  EXPECT_EQ(buffer[0], 7);
+  EXPECT_EQ(arena.num_recycled_buffers(), 0u);
+  arena.RecycleBuffer(std::move(buffer));
+  buffer = arena.AcquireBuffer(10);
+  EXPECT_EQ(buffer.data(), data);
+  EXPECT_EQ(buffer.size(), 10u);
+
+  // Bytes past the size of the recycled buffer are zeroed.
+  buffer[9] = 3;
+  arena.RecycleBuffer(std::move(buffer));
+  buffer = arena.AcquireBuffer(20);
+  EXPECT_EQ(buffer[9], 3);
+  for (size_t i = 10; i < 20; ++i) {
+    EXPECT_EQ(buffer[i], 0) << i;
+  }
+}
+
+TEST(FrameArenaTest, TestAcquireLargestBuffer) {
+  FrameArena arena;
+  arena.RecycleBuffer(std::vector<uint8_t>(10));
+  std::vector<uint8_t> large(5000);
+  const uint8_t *const large_data = large.data();
+  arena.RecycleBuffer(std::move(large));
+  arena.RecycleBuffer(std::vector<uint8_t>(100));
+  ASSERT_EQ(arena.num_recycled_buffers(), 3u);
+
+  const std::vector<uint8_t> buffer = arena.AcquireBuffer(3000);
+  EXPECT_EQ(buffer.data(), large_data);
+  EXPECT_EQ(arena.num_recycled_buffers(), 2u);
+}
+
+TEST(FrameArenaTest, TestRecycleLimits) {
+  FrameArena arena;
+  // Buffers without storage are not kept.
+  arena.RecycleBuffer(std::vector<uint8_t>());
+  EXPECT_EQ(arena.num_recycled_buffers(), 0u);
+
+  for (size_t i = 0; i < FrameArena::kMaxNumRecycledBuffers + 3; ++i) {
+    arena.RecycleBuffer(std::vector<uint8_t>(16));
+  }
+  EXPECT_EQ(arena.num_recycled_buffers(), FrameArena::kMaxNumRecycledBuffers);
+}
+
+}  // namespace draco
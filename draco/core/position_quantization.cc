@@ -0,0 +1,217 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "core/position_quantization.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DRACO_POSITION_QUANTIZATION_NEON
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DRACO_POSITION_QUANTIZATION_SSE2
+#endif
+
+#include "core/quantization_utils.h"
+
+namespace draco {
+
+namespace {
+
+const float *GetPosition(const float *positions, size_t i,
+                         int64_t byte_stride) {
+  return reinterpret_cast<const float *>(
+      reinterpret_cast<const uint8_t *>(positions) + byte_stride * i);
+}
+
+// Scalar versions of the kernels, used for the last point of the vectorized
+// loops because a full register load would read past the end of the data.
+bool ComputeBoundsScalar(const float *positions, size_t begin, size_t end,
+                         int64_t byte_stride, float *min_values,
+                         float *max_values) {
+  for (size_t i = begin; i < end; ++i) {
+    const float *const p = GetPosition(positions, i, byte_stride);
+    for (int c = 0; c < 3; ++c) {
+      if (!std::isfinite(p[c])) {
+        return false;
+      }
+      min_values[c] = std::min(min_values[c], p[c]);
+      max_values[c] = std::max(max_values[c], p[c]);
+    }
+  }
+  return true;
+}
+
+bool QuantizeScalar(const float *positions, size_t begin, size_t end,
+                    int64_t byte_stride, const float *origin, float range,
+                    uint32_t max_quantized_value, Vector3ui *out_points) {
+  Quantizer quantizer;
+  quantizer.Init(range, static_cast<int32_t>(max_quantized_value));
+  for (size_t i = begin; i < end; ++i) {
+    const float *const p = GetPosition(positions, i, byte_stride);
+    for (int c = 0; c < 3; ++c) {
+      const float value = p[c] - origin[c];
+      // Written to also reject NaNs.
+      if (!(value >= 0.f && value <= range)) {
+        return false;
+      }
+      out_points[i][c] = std::min(
+          static_cast<uint32_t>(quantizer.QuantizeFloat(value)),
+          max_quantized_value);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool ComputePositionBounds(const float *positions, size_t num_points,
+                           int64_t byte_stride, float *out_min_values,
+                           float *out_max_values) {
+  if (num_points == 0) {
+    return true;
+  }
+  float min_values[3] = {positions[0], positions[1], positions[2]};
+  float max_values[3] = {positions[0], positions[1], positions[2]};
+  size_t i = 0;
+#if defined(DRACO_POSITION_QUANTIZATION_NEON)
+  if (num_points > 1) {
+    // The fourth lane holds the next point or padding and is ignored.
+    float32x4_t min_v = vld1q_f32(positions);
+    float32x4_t max_v = min_v;
+    // x - x is zero for finite values and NaN otherwise.
+    uint32x4_t finite_v = vdupq_n_u32(~0u);
+    for (; i + 1 < num_points; ++i) {
+      const float32x4_t p =
+          vld1q_f32(GetPosition(positions, i, byte_stride));
+      min_v = vminq_f32(min_v, p);
+      max_v = vmaxq_f32(max_v, p);
+      finite_v = vandq_u32(finite_v,
+                           vceqq_f32(vsubq_f32(p, p), vdupq_n_f32(0.f)));
+    }
+    if ((vgetq_lane_u32(finite_v, 0) & vgetq_lane_u32(finite_v, 1) &
+         vgetq_lane_u32(finite_v, 2)) == 0) {
+      return false;
+    }
+    float min_lanes[4];
+    float max_lanes[4];
+    vst1q_f32(min_lanes, min_v);
+    vst1q_f32(max_lanes, max_v);
+    std::copy(min_lanes, min_lanes + 3, min_values);
+    std::copy(max_lanes, max_lanes + 3, max_values);
+  }
+#elif defined(DRACO_POSITION_QUANTIZATION_SSE2)
+  if (num_points > 1) {
+    // The fourth lane holds the next point or padding and is ignored.
+    __m128 min_v = _mm_loadu_ps(positions);
+    __m128 max_v = min_v;
+    // x - x is zero for finite values and NaN otherwise.
+    __m128 finite_v = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (; i + 1 < num_points; ++i) {
+      const __m128 p = _mm_loadu_ps(GetPosition(positions, i, byte_stride));
+      min_v = _mm_min_ps(min_v, p);
+      max_v = _mm_max_ps(max_v, p);
+      finite_v = _mm_and_ps(finite_v,
+                            _mm_cmpeq_ps(_mm_sub_ps(p, p), _mm_setzero_ps()));
+    }
+    if ((_mm_movemask_ps(finite_v) & 7) != 7) {
+      return false;
+    }
+    float min_lanes[4];
+    float max_lanes[4];
+    _mm_storeu_ps(min_lanes, min_v);
+    _mm_storeu_ps(max_lanes, max_v);
+    std::copy(min_lanes, min_lanes + 3, min_values);
+    std::copy(max_lanes, max_lanes + 3, max_values);
+  }
+#endif
+  if (!ComputeBoundsScalar(positions, i, num_points, byte_stride, min_values,
+                           max_values)) {
+    return false;
+  }
+  std::copy(min_values, min_values + 3, out_min_values);
+  std::copy(max_values, max_values + 3, out_max_values);
+  return true;
+}
+
+bool QuantizePositions(const float *positions, size_t num_points,
+                       int64_t byte_stride, const float *origin, float range,
+                       uint32_t max_quantized_value, Vector3ui *out_points) {
+  size_t i = 0;
+#if defined(DRACO_POSITION_QUANTIZATION_NEON) || \
+    defined(DRACO_POSITION_QUANTIZATION_SSE2)
+  // Same operations as Quantizer::QuantizeFloat(). The rounded values are
+  // positive, so truncation is equal to floor(). Each store writes a fourth
+  // lane into the next point, which is overwritten in the next iteration.
+  const float inverse_delta = static_cast<float>(max_quantized_value) / range;
+  uint32_t *const out = reinterpret_cast<uint32_t *>(out_points);
+#endif
+#if defined(DRACO_POSITION_QUANTIZATION_NEON)
+  const float origin_lanes[4] = {origin[0], origin[1], origin[2], 0.f};
+  const float32x4_t origin_v = vld1q_f32(origin_lanes);
+  const float32x4_t range_v = vdupq_n_f32(range);
+  const float32x4_t inverse_delta_v = vdupq_n_f32(inverse_delta);
+  const float32x4_t half_v = vdupq_n_f32(0.5f);
+  const uint32x4_t max_v = vdupq_n_u32(max_quantized_value);
+  uint32x4_t in_range_v = vdupq_n_u32(~0u);
+  for (; i + 1 < num_points; ++i) {
+    const float32x4_t value = vsubq_f32(
+        vld1q_f32(GetPosition(positions, i, byte_stride)), origin_v);
+    in_range_v = vandq_u32(in_range_v,
+                           vandq_u32(vcgeq_f32(value, vdupq_n_f32(0.f)),
+                                     vcleq_f32(value, range_v)));
+    const float32x4_t scaled =
+        vaddq_f32(vmulq_f32(value, inverse_delta_v), half_v);
+    vst1q_u32(out + 3 * i, vminq_u32(vcvtq_u32_f32(scaled), max_v));
+  }
+  if ((vgetq_lane_u32(in_range_v, 0) & vgetq_lane_u32(in_range_v, 1) &
+       vgetq_lane_u32(in_range_v, 2)) == 0) {
+    return false;
+  }
+#elif defined(DRACO_POSITION_QUANTIZATION_SSE2)
+  const __m128 origin_v = _mm_setr_ps(origin[0], origin[1], origin[2], 0.f);
+  const __m128 range_v = _mm_set1_ps(range);
+  const __m128 inverse_delta_v = _mm_set1_ps(inverse_delta);
+  const __m128 half_v = _mm_set1_ps(0.5f);
+  // SSE2 has no unsigned minimum, the values fit into int32 though.
+  const __m128i max_v =
+      _mm_set1_epi32(static_cast<int32_t>(max_quantized_value));
+  __m128 in_range_v = _mm_castsi128_ps(_mm_set1_epi32(-1));
+  for (; i + 1 < num_points; ++i) {
+    const __m128 value = _mm_sub_ps(
+        _mm_loadu_ps(GetPosition(positions, i, byte_stride)), origin_v);
+    in_range_v = _mm_and_ps(in_range_v,
+                            _mm_and_ps(_mm_cmpge_ps(value, _mm_setzero_ps()),
+                                       _mm_cmple_ps(value, range_v)));
+    const __m128 scaled =
+        _mm_add_ps(_mm_mul_ps(value, inverse_delta_v), half_v);
+    const __m128i q = _mm_cvttps_epi32(scaled);
+    const __m128i too_large = _mm_cmpgt_epi32(q, max_v);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i *>(out + 3 * i),
+        _mm_or_si128(_mm_and_si128(too_large, max_v),
+                     _mm_andnot_si128(too_large, q)));
+  }
+  if ((_mm_movemask_ps(in_range_v) & 7) != 7) {
+    return false;
+  }
+#endif
+  return QuantizeScalar(positions, i, num_points, byte_stride, origin, range,
+                        max_quantized_value, out_points);
+}
+
+}  // namespace draco
@@ -0,0 +1,51 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_POSITION_QUANTIZATION_H_
+#define DRACO_CORE_POSITION_QUANTIZATION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/vector_d.h"
+
+namespace draco {
+
+// Kernels for quantizing arrays of float positions, used by the encoders
+// that quantize positions on every frame. Positions are float triplets that
+// are |byte_stride| bytes apart, e.g. an array of simd_float3 with a stride
+// of 16 bytes. The kernels process one point per SSE2 or NEON register when
+// available and fall back to scalar code otherwise. The results are
+// identical on all code paths.
+
+// Computes the per-axis minimum and maximum of the positions in a single
+// pass. Returns false if any coordinate is not finite. The bounds are not
+// written when |num_points| is 0.
+bool ComputePositionBounds(const float *positions, size_t num_points,
+                           int64_t byte_stride, float *out_min_values,
+                           float *out_max_values);
+
+// Quantizes the positions to a grid starting at |origin| that spans |range|
+// along each axis with |max_quantized_value| + 1 cells. Values are rounded
+// like Quantizer::QuantizeFloat() and clamped to |max_quantized_value|.
+// Returns false if any coordinate lies outside of the grid or is NaN, in
+// which case the content of |out_points| is undefined. |max_quantized_value|
+// must be less than 2^31.
+bool QuantizePositions(const float *positions, size_t num_points,
+                       int64_t byte_stride, const float *origin, float range,
+                       uint32_t max_quantized_value, Vector3ui *out_points);
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_POSITION_QUANTIZATION_H_
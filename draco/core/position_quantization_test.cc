@@ -0,0 +1,198 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "core/position_quantization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "core/draco_test_base.h"
+#include "core/quantization_utils.h"
+
+namespace draco {
+
+class PositionQuantizationTest : public ::testing::Test {
+ protected:
+  PositionQuantizationTest() : rng_(11) {}
+
+  // Returns |num_points| random positions in range [-10, 10] that are
+  // |stride| floats apart. The padding between the points holds NaNs, which
+  // must be ignored. The vector ends right after the last point, so reads
+  // past it are caught by the address sanitizer.
+  std::vector<float> CreatePositions(size_t num_points, int stride) {
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+    std::vector<float> positions(
+        num_points == 0 ? 0 : stride * (num_points - 1) + 3,
+        std::numeric_limits<float>::quiet_NaN());
+    for (size_t i = 0; i < num_points; ++i) {
+      for (int c = 0; c < 3; ++c) {
+        positions[stride * i + c] = dist(rng_);
+      }
+    }
+    return positions;
+  }
+
+  // Same as QuantizePositions() with the scalar Quantizer.
+  static std::vector<Vector3ui> QuantizeReference(
+      const std::vector<float> &positions, size_t num_points, int stride,
+      const float *origin, float range, uint32_t max_quantized_value) {
+    Quantizer quantizer;
+    quantizer.Init(range, static_cast<int32_t>(max_quantized_value));
+    std::vector<Vector3ui> points(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+      for (int c = 0; c < 3; ++c) {
+        points[i][c] = std::min(
+            static_cast<uint32_t>(quantizer.QuantizeFloat(
+                positions[stride * i + c] - origin[c])),
+            max_quantized_value);
+      }
+    }
+    return points;
+  }
+
+  std::mt19937 rng_;
+};
+
+TEST_F(PositionQuantizationTest, TestBounds) {
+  for (const int stride : {3, 4, 5}) {
+    for (const size_t num_points : {1, 2, 3, 4, 5, 17, 1000}) {
+      const std::vector<float> positions = CreatePositions(num_points, stride);
+      float expected_min[3];
+      float expected_max[3];
+      for (int c = 0; c < 3; ++c) {
+        expected_min[c] = expected_max[c] = positions[c];
+        for (size_t i = 1; i < num_points; ++i) {
+          const float value = positions[stride * i + c];
+          expected_min[c] = std::min(expected_min[c], value);
+          expected_max[c] = std::max(expected_max[c], value);
+        }
+      }
+      float min_values[3];
+      float max_values[3];
+      ASSERT_TRUE(ComputePositionBounds(positions.data(), num_points,
+                                        stride * sizeof(float), min_values,
+                                        max_values));
+      for (int c = 0; c < 3; ++c) {
+        EXPECT_EQ(min_values[c], expected_min[c]) << stride << " " << c;
+        EXPECT_EQ(max_values[c], expected_max[c]) << stride << " " << c;
+      }
+    }
+  }
+}
+
+TEST_F(PositionQuantizationTest, TestBoundsNoPoints) {
+  float min_values[3] = {1.f, 2.f, 3.f};
+  float max_values[3] = {4.f, 5.f, 6.f};
+  ASSERT_TRUE(ComputePositionBounds(nullptr, 0, 0, min_values, max_values));
+  EXPECT_EQ(min_values[2], 3.f);
+  EXPECT_EQ(max_values[2], 6.f);
+}
+
+TEST_F(PositionQuantizationTest, TestBoundsNonFinite) {
+  // A non-finite coordinate is detected on the vectorized and the scalar
+  // path, i.e. in any point including the last one.
+  const float values[] = {std::numeric_limits<float>::quiet_NaN(),
+                          std::numeric_limits<float>::infinity(),
+                          -std::numeric_limits<float>::infinity()};
+  const size_t num_points = 9;
+  for (const int stride : {3, 4}) {
+    for (size_t point = 0; point < num_points; ++point) {
+      for (int c = 0; c < 3; ++c) {
+        std::vector<float> positions = CreatePositions(num_points, stride);
+        positions[stride * point + c] = values[(point + c) % 3];
+        float min_values[3];
+        float max_values[3];
+        EXPECT_FALSE(ComputePositionBounds(positions.data(), num_points,
+                                           stride * sizeof(float), min_values,
+                                           max_values))
+            << stride << " " << point << " " << c;
+      }
+    }
+  }
+}
+
+TEST_F(PositionQuantizationTest, TestQuantize) {
+  const float origin[3] = {-10.f, -11.f, -10.5f};
+  const float range = 21.f;
+  for (const int quantization_bits : {1, 8, 11, 16, 24, 30}) {
+    const uint32_t max_quantized_value = (1u << quantization_bits) - 1;
+    for (const int stride : {3, 4, 8}) {
+      for (const size_t num_points : {1, 2, 3, 17, 1000}) {
+        const std::vector<float> positions =
+            CreatePositions(num_points, stride);
+        const std::vector<Vector3ui> expected =
+            QuantizeReference(positions, num_points, stride, origin, range,
+                              max_quantized_value);
+        std::vector<Vector3ui> points(num_points);
+        ASSERT_TRUE(QuantizePositions(positions.data(), num_points,
+                                      stride * sizeof(float), origin, range,
+                                      max_quantized_value, points.data()));
+        for (size_t i = 0; i < num_points; ++i) {
+          ASSERT_EQ(points[i], expected[i])
+              << quantization_bits << " " << stride << " " << i;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(PositionQuantizationTest, TestQuantizeGridBounds) {
+  // Points on the bounds of the grid map to the first and last cells.
+  const float origin[3] = {1.f, 2.f, 3.f};
+  const float range = 4.f;
+  const uint32_t max_quantized_value = 1023;
+  const std::vector<float> positions = {
+      1.f, 2.f, 3.f,  //
+      5.f, 6.f, 7.f,  //
+      1.f, 6.f, 3.f,  //
+      3.f, 4.f, 5.f,  //
+      5.f, std::nextafter(6.f, 0.f), 7.f};
+  const size_t num_points = positions.size() / 3;
+  std::vector<Vector3ui> points(num_points);
+  ASSERT_TRUE(QuantizePositions(positions.data(), num_points,
+                                3 * sizeof(float), origin, range,
+                                max_quantized_value, points.data()));
+  EXPECT_EQ(points[0], Vector3ui(0, 0, 0));
+  EXPECT_EQ(points[1], Vector3ui(1023, 1023, 1023));
+  EXPECT_EQ(points[2], Vector3ui(0, 1023, 0));
+  EXPECT_EQ(points[3], Vector3ui(512, 512, 512));
+  EXPECT_EQ(points[4], Vector3ui(1023, 1023, 1023));
+}
+
+TEST_F(PositionQuantizationTest, TestQuantizeOutsideOfGrid) {
+  // Points outside of the grid or NaNs fail in any point.
+  const float origin[3] = {-10.f, -10.f, -10.f};
+  const float range = 20.f;
+  const float values[] = {-10.5f, 10.5f,
+                          std::numeric_limits<float>::quiet_NaN()};
+  const size_t num_points = 9;
+  for (const int stride : {3, 4}) {
+    for (size_t point = 0; point < num_points; ++point) {
+      for (int c = 0; c < 3; ++c) {
+        std::vector<float> positions = CreatePositions(num_points, stride);
+        positions[stride * point + c] = values[(point + c) % 3];
+        std::vector<Vector3ui> points(num_points);
+        EXPECT_FALSE(QuantizePositions(positions.data(), num_points,
+                                       stride * sizeof(float), origin, range,
+                                       2047, points.data()))
+            << stride << " " << point << " " << c;
+      }
+    }
+  }
+}
+
+}  // namespace draco
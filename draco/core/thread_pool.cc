@@ -0,0 +1,91 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "core/thread_pool.h"
+
+namespace draco {
+
+ThreadPool::ThreadPool(int num_threads)
+    : task_(nullptr),
+      num_tasks_(0),
+      next_task_(0),
+      num_pending_tasks_(0),
+      stop_(false) {
+  for (int i = 1; i < num_threads; ++i) {
+    threads_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_available_.notify_all();
+  for (std::thread &thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::Run(int num_tasks, const std::function<void(int)> &task) {
+  if (num_tasks <= 0) {
+    return;
+  }
+  if (threads_.empty() || num_tasks == 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  task_ = &task;
+  num_tasks_ = num_tasks;
+  next_task_ = 0;
+  num_pending_tasks_ = num_tasks;
+  work_available_.notify_all();
+  RunTasks(&lock);
+  batch_done_.wait(lock, [this] { return num_pending_tasks_ == 0; });
+  // The workers don't take tasks from a finished batch, so |task| can go out
+  // of scope.
+  task_ = nullptr;
+  num_tasks_ = 0;
+  next_task_ = 0;
+}
+
+void ThreadPool::WorkerLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    work_available_.wait(lock,
+                         [this] { return next_task_ < num_tasks_ || stop_; });
+    if (stop_) {
+      return;
+    }
+    RunTasks(&lock);
+  }
+}
+
+void ThreadPool::RunTasks(std::unique_lock<std::mutex> *lock) {
+  while (next_task_ < num_tasks_) {
+    const int task_index = next_task_++;
+    const std::function<void(int)> &task = *task_;
+    lock->unlock();
+    task(task_index);
+    lock->lock();
+    if (--num_pending_tasks_ == 0) {
+      batch_done_.notify_all();
+    }
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,73 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_THREAD_POOL_H_
+#define DRACO_CORE_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace draco {
+
+// Runs batches of independent tasks on a fixed set of threads. The threads
+// are started once and wait for work between the batches, so the pool can be
+// used for short parallel sections of a frame without the cost of creating
+// threads for each of them.
+//
+// Usage:
+//   ThreadPool pool(num_threads);
+//   pool.Run(num_tasks, [&](int task) { Process(task); });
+class ThreadPool {
+ public:
+  // Creates a pool running tasks on |num_threads| threads including the
+  // calling thread of Run(), i.e. num_threads - 1 threads are started.
+  explicit ThreadPool(int num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // Stops all threads.
+  ~ThreadPool();
+
+  int num_threads() const { return static_cast<int>(threads_.size()) + 1; }
+
+  // Calls |task| for each task index in range [0, num_tasks) and waits until
+  // all calls returned. The calling thread runs tasks as well. Tasks are
+  // started in order of their index. Must not be called concurrently.
+  void Run(int num_tasks, const std::function<void(int)> &task);
+
+ private:
+  void WorkerLoop();
+  // Runs tasks of the current batch until all of them were started.
+  void RunTasks(std::unique_lock<std::mutex> *lock);
+
+  std::mutex mutex_;
+  // Signaled when a batch is started or the pool is stopped.
+  std::condition_variable work_available_;
+  // Signaled when the last task of a batch returned.
+  std::condition_variable batch_done_;
+  const std::function<void(int)> *task_;
+  int num_tasks_;
+  int next_task_;
+  // Number of tasks of the current batch that did not return yet.
+  int num_pending_tasks_;
+  bool stop_;
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_THREAD_POOL_H_
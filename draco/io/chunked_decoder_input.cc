@@ -0,0 +1,101 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "io/chunked_decoder_input.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace draco {
+
+ChunkedDecoderInput::ChunkedDecoderInput()
+    : begin_offset_(0), end_offset_(0) {}
+
+void ChunkedDecoderInput::AppendSegment(const char *data, size_t size) {
+  if (size == 0) {
+    return;
+  }
+  Segment segment;
+  segment.data = data;
+  segment.size = size;
+  segment.offset = end_offset_;
+  segments_.push_back(segment);
+  end_offset_ += size;
+}
+
+Status ChunkedDecoderInput::InitDecoderBuffer(size_t offset, size_t size,
+                                              DecoderBuffer *out_buffer) {
+  if (!Contains(offset, size)) {
+    return Status(Status::INVALID_PARAMETER, "Range is not available.");
+  }
+  if (size == 0) {
+    out_buffer->Init(nullptr, 0);
+    return OkStatus();
+  }
+  const Segment &segment = segments_[FindSegment(offset)];
+  const size_t segment_offset = offset - segment.offset;
+  if (size <= segment.size - segment_offset) {
+    out_buffer->Init(segment.data + segment_offset, size);
+    return OkStatus();
+  }
+  staging_buffer_.ResizeUninitialized(size);
+  Read(offset, size, staging_buffer_.data());
+  out_buffer->Init(reinterpret_cast<const char *>(staging_buffer_.data()),
+                   size);
+  return OkStatus();
+}
+
+bool ChunkedDecoderInput::Read(size_t offset, size_t size,
+                               void *out_data) const {
+  if (!Contains(offset, size)) {
+    return false;
+  }
+  char *out = static_cast<char *>(out_data);
+  for (size_t i = size > 0 ? FindSegment(offset) : segments_.size();
+       size > 0; ++i) {
+    const Segment &segment = segments_[i];
+    const size_t segment_offset = offset - segment.offset;
+    const size_t num_bytes = std::min(size, segment.size - segment_offset);
+    memcpy(out, segment.data + segment_offset, num_bytes);
+    out += num_bytes;
+    offset += num_bytes;
+    size -= num_bytes;
+  }
+  return true;
+}
+
+void ChunkedDecoderInput::ReleaseBefore(size_t offset) {
+  while (!segments_.empty() &&
+         segments_.front().offset + segments_.front().size <= offset) {
+    begin_offset_ = segments_.front().offset + segments_.front().size;
+    segments_.pop_front();
+  }
+}
+
+void ChunkedDecoderInput::Clear() {
+  segments_.clear();
+  begin_offset_ = end_offset_;
+}
+
+size_t ChunkedDecoderInput::FindSegment(size_t offset) const {
+  // The first segment that starts past |offset| follows the one holding it.
+  const auto it = std::upper_bound(
+      segments_.begin(), segments_.end(), offset,
+      [](size_t value, const Segment &segment) {
+        return value < segment.offset;
+      });
+  return static_cast<size_t>(it - segments_.begin()) - 1;
+}
+
+}  // namespace draco
@@ -0,0 +1,113 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_CHUNKED_DECODER_INPUT_H_
+#define DRACO_IO_CHUNKED_DECODER_INPUT_H_
+
+#include <cstddef>
+#include <deque>
+
+#include "core/aligned_buffer.h"
+#include "core/decoder_buffer.h"
+#include "core/status.h"
+
+namespace draco {
+
+// Input of a decoder that arrives as a sequence of non-contiguous segments,
+// e.g. the packets of a network stream or blocks read from a file. Segments
+// are addressed by their offset in the stream, like a single contiguous
+// buffer.
+//
+// DecoderBuffer and the decoders of libdraco, e.g.
+// Decoder::DecodePointCloudFromBuffer(), need the encoded data in one
+// contiguous region of memory. A range that lies within a single segment is
+// passed to DecoderBuffer where it is. Only a range that spans several
+// segments is first copied into a staging buffer that is reused for all
+// ranges. The decoders still write the decoded values to storage of their
+// own, which the caller may have to copy again.
+//
+// Usage:
+//   ChunkedDecoderInput input;
+//   while (ReceivePacket(&packet)) {
+//     input.AppendSegment(packet.data, packet.size);
+//     while (input.Contains(frame_offset, frame_size)) {
+//       DecoderBuffer buffer;
+//       DRACO_RETURN_IF_ERROR(
+//           input.InitDecoderBuffer(frame_offset, frame_size, &buffer));
+//       DRACO_RETURN_IF_ERROR(decoder.DecodeFrame(&buffer));
+//       input.ReleaseBefore(frame_offset + frame_size);
+//       ...
+//     }
+//   }
+class ChunkedDecoderInput {
+ public:
+  ChunkedDecoderInput();
+
+  // Appends |size| bytes at the end of the stream. The data is not copied, it
+  // must stay valid until the segment is released.
+  void AppendSegment(const char *data, size_t size);
+
+  // Offset of the first byte that was not released.
+  size_t begin_offset() const { return begin_offset_; }
+  // Offset right past the last appended byte.
+  size_t end_offset() const { return end_offset_; }
+
+  // Returns true if the |size| bytes at |offset| were appended and not
+  // released.
+  bool Contains(size_t offset, size_t size) const {
+    return offset >= begin_offset_ && offset <= end_offset_ &&
+           size <= end_offset_ - offset;
+  }
+
+  // Initializes |out_buffer| to decode the |size| bytes at |offset|. The
+  // buffer is valid until the next call of InitDecoderBuffer() or until the
+  // range is released.
+  Status InitDecoderBuffer(size_t offset, size_t size,
+                           DecoderBuffer *out_buffer);
+
+  // Copies the |size| bytes at |offset| to |out_data|, e.g. to parse a header
+  // that may span several segments. Returns false if the range is not
+  // available.
+  bool Read(size_t offset, size_t size, void *out_data) const;
+
+  // Releases all segments that end at or before |offset|. Their memory is no
+  // longer referenced afterwards.
+  void ReleaseBefore(size_t offset);
+
+  // Releases all segments. The offsets of the stream are kept.
+  void Clear();
+
+ private:
+  struct Segment {
+    const char *data;
+    size_t size;
+    // Offset of the first byte of the segment in the stream.
+    size_t offset;
+  };
+
+  // Returns the index of the segment holding the byte at |offset|, which
+  // must be available.
+  size_t FindSegment(size_t offset) const;
+
+  std::deque<Segment> segments_;
+  size_t begin_offset_;
+  size_t end_offset_;
+  // Gathered ranges are overwritten completely, so the buffer grows without
+  // zero-filling.
+  AlignedBuffer staging_buffer_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_CHUNKED_DECODER_INPUT_H_
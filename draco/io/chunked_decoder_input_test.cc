@@ -0,0 +1,141 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "io/chunked_decoder_input.h"
+
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "core/draco_test_base.h"
+
+namespace draco {
+
+class ChunkedDecoderInputTest : public ::testing::Test {
+ protected:
+  ChunkedDecoderInputTest() {
+    for (int i = 0; i < 100; ++i) {
+      stream_.push_back(static_cast<char>(i * 7 + 3));
+    }
+  }
+
+  // Splits the stream into segments of |sizes| and appends them to |input|.
+  // The segments are copies, so their memory is not contiguous. They are kept
+  // in a deque, where appending doesn't move the stored strings.
+  void AppendSegments(const std::vector<size_t> &sizes,
+                      ChunkedDecoderInput *input) {
+    size_t offset = 0;
+    for (const size_t size : sizes) {
+      segments_.push_back(stream_.substr(offset, size));
+      input->AppendSegment(segments_.back().data(), size);
+      offset += size;
+    }
+  }
+
+  // Returns the bytes remaining in |buffer|.
+  static std::string GetData(const DecoderBuffer &buffer) {
+    return std::string(buffer.data_head(), buffer.remaining_size());
+  }
+
+  std::string stream_;
+  std::deque<std::string> segments_;
+};
+
+TEST_F(ChunkedDecoderInputTest, TestRanges) {
+  // Every range of a stream split into segments of different sizes,
+  // including empty ones that are ignored.
+  ChunkedDecoderInput input;
+  AppendSegments({1, 0, 3, 17, 4, 1, 40, 34}, &input);
+  EXPECT_EQ(input.begin_offset(), 0u);
+  EXPECT_EQ(input.end_offset(), 100u);
+  for (size_t offset = 0; offset <= 100; ++offset) {
+    for (size_t size = 0; offset + size <= 100; ++size) {
+      ASSERT_TRUE(input.Contains(offset, size));
+      DecoderBuffer buffer;
+      ASSERT_TRUE(input.InitDecoderBuffer(offset, size, &buffer).ok());
+      ASSERT_EQ(GetData(buffer), stream_.substr(offset, size))
+          << offset << " " << size;
+      std::string data(size, '\0');
+      ASSERT_TRUE(input.Read(offset, size, &data[0]));
+      ASSERT_EQ(data, stream_.substr(offset, size)) << offset << " " << size;
+    }
+  }
+}
+
+TEST_F(ChunkedDecoderInputTest, TestRangeInSegmentIsNotCopied) {
+  ChunkedDecoderInput input;
+  AppendSegments({10, 20, 70}, &input);
+  DecoderBuffer buffer;
+  // Ranges that end right at the end of a segment or start right at its
+  // beginning are used where they are.
+  ASSERT_TRUE(input.InitDecoderBuffer(3, 7, &buffer).ok());
+  EXPECT_EQ(buffer.data_head(), segments_[0].data() + 3);
+  ASSERT_TRUE(input.InitDecoderBuffer(10, 20, &buffer).ok());
+  EXPECT_EQ(buffer.data_head(), segments_[1].data());
+
+  // A range across the boundary of two segments is gathered.
+  ASSERT_TRUE(input.InitDecoderBuffer(9, 2, &buffer).ok());
+  EXPECT_EQ(GetData(buffer), stream_.substr(9, 2));
+  uint16_t value;
+  ASSERT_TRUE(buffer.Decode(&value));
+  uint16_t expected_value;
+  memcpy(&expected_value, stream_.data() + 9, sizeof(expected_value));
+  EXPECT_EQ(value, expected_value);
+}
+
+TEST_F(ChunkedDecoderInputTest, TestUnavailableRanges) {
+  ChunkedDecoderInput input;
+  AppendSegments({10, 20, 30}, &input);
+  DecoderBuffer buffer;
+  char data[64];
+  EXPECT_FALSE(input.Contains(50, 11));
+  EXPECT_EQ(input.InitDecoderBuffer(50, 11, &buffer).code(),
+            Status::INVALID_PARAMETER);
+  EXPECT_FALSE(input.Read(61, 0, data));
+  EXPECT_TRUE(input.Contains(60, 0));
+
+  // Releasing up to the middle of a segment keeps that segment.
+  input.ReleaseBefore(15);
+  EXPECT_EQ(input.begin_offset(), 10u);
+  EXPECT_FALSE(input.Contains(9, 2));
+  EXPECT_EQ(input.InitDecoderBuffer(5, 10, &buffer).code(),
+            Status::INVALID_PARAMETER);
+  ASSERT_TRUE(input.InitDecoderBuffer(10, 30, &buffer).ok());
+  EXPECT_EQ(GetData(buffer), stream_.substr(10, 30));
+
+  // Segments are released up to their end.
+  input.ReleaseBefore(60);
+  EXPECT_EQ(input.begin_offset(), 60u);
+  EXPECT_FALSE(input.Contains(59, 1));
+  EXPECT_TRUE(input.Contains(60, 0));
+}
+
+TEST_F(ChunkedDecoderInputTest, TestClear) {
+  ChunkedDecoderInput input;
+  AppendSegments({10, 20}, &input);
+  input.Clear();
+  EXPECT_EQ(input.begin_offset(), 30u);
+  EXPECT_EQ(input.end_offset(), 30u);
+  EXPECT_FALSE(input.Contains(0, 1));
+
+  // New segments continue at the old end of the stream.
+  segments_.push_back(stream_.substr(30, 15));
+  input.AppendSegment(segments_.back().data(), 15);
+  DecoderBuffer buffer;
+  ASSERT_TRUE(input.InitDecoderBuffer(30, 15, &buffer).ok());
+  EXPECT_EQ(GetData(buffer), stream_.substr(30, 15));
+}
+
+}  // namespace draco
@@ -0,0 +1,134 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_FRAME_SEQUENCE_FORMAT_H_
+#define DRACO_IO_FRAME_SEQUENCE_FORMAT_H_
+
+#include <cstdint>
+#include <cstring>
+
+namespace draco {
+
+// Layout of a single-file container for sequences of encoded Draco frames
+// (.drcseq). All values are stored in little-endian byte order and all chunks
+// start at 8-byte aligned offsets so that a memory-mapped file can be accessed
+// directly.
+//
+//   FrameSequenceFileHeader          Fixed size, start of the file.
+//   FrameSequenceChunkHeader         One chunk per frame, appended while
+//     payload + padding              recording. Metadata is stored in a chunk
+//   ...                              of the same format.
+//   FrameSequenceChunkHeader         Index chunk written on finalization, the
+//     FrameSequenceIndexEntry[n]     payload holds one entry per frame.
+//   FrameSequenceTrailer             Fixed size, end of the file.
+//
+// The file header and the trailer both point to the index chunk. A file that
+// was not finalized (e.g. when the recording was interrupted) has no index,
+// its frames can still be recovered by walking the chunks from the start.
+
+constexpr char kFrameSequenceMagic[8] = {'D', 'R', 'C', 'S', 'E', 'Q', 0, 0};
+constexpr char kFrameSequenceTrailerMagic[8] = {'D', 'R', 'C', 'S',
+                                                'E', 'Q', 'I', 'X'};
+constexpr uint16_t kFrameSequenceMajorVersion = 1;
+constexpr uint16_t kFrameSequenceMinorVersion = 0;
+
+constexpr uint32_t FrameSequenceFourCc(char a, char b, char c, char d) {
+  return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+         (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+         (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+         (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+}
+
+// Types of chunks stored in the file.
+enum FrameSequenceChunkType : uint32_t {
+  FRAME_SEQUENCE_CHUNK_FRAME = FrameSequenceFourCc('F', 'R', 'M', 'E'),
+  FRAME_SEQUENCE_CHUNK_METADATA = FrameSequenceFourCc('M', 'E', 'T', 'A'),
+  FRAME_SEQUENCE_CHUNK_INDEX = FrameSequenceFourCc('I', 'N', 'D', 'X'),
+};
+
+// Flags stored with each frame.
+enum FrameSequenceFrameFlags : uint32_t {
+  // The frame can be decoded without any other frame.
+  FRAME_SEQUENCE_FLAG_KEYFRAME = 1,
+};
+
+// Codecs of the frame payloads.
+enum FrameSequenceCodec : uint32_t {
+  // Each frame is an independent Draco bitstream.
+  FRAME_SEQUENCE_CODEC_DRACO = 0,
+  // Frames are coded by PointCloudSequenceEncoder. Frames without the
+  // FRAME_SEQUENCE_FLAG_KEYFRAME flag depend on the previous frame.
+  FRAME_SEQUENCE_CODEC_POINT_CLOUD_SEQUENCE = 1,
+};
+
+struct FrameSequenceFileHeader {
+  char magic[8];
+  uint16_t major_version;
+  uint16_t minor_version;
+  uint32_t header_size;
+  // Nominal frame rate of the sequence, 0 when unknown.
+  double frame_rate;
+  // Offset of the index chunk, 0 until the file is finalized.
+  uint64_t index_offset;
+  // Number of frames in the index, 0 until the file is finalized.
+  uint64_t num_frames;
+  // Offset and size of the payload of the metadata chunk (0 if none).
+  uint64_t metadata_offset;
+  uint64_t metadata_size;
+  // FrameSequenceCodec of the frames. Files written before the field was
+  // added have zeros in its place, i.e. FRAME_SEQUENCE_CODEC_DRACO.
+  uint32_t codec;
+  uint8_t reserved[4];
+};
+
+struct FrameSequenceChunkHeader {
+  uint32_t type;
+  uint32_t flags;
+  // Presentation time of the frame in microseconds.
+  int64_t timestamp_us;
+  // Size of the payload excluding the padding to the next 8-byte boundary.
+  uint64_t payload_size;
+};
+
+struct FrameSequenceIndexEntry {
+  // Offset of the frame payload from the start of the file.
+  uint64_t offset;
+  uint64_t size;
+  int64_t timestamp_us;
+  uint32_t flags;
+  uint32_t reserved;
+};
+
+struct FrameSequenceTrailer {
+  uint64_t index_offset;
+  char magic[8];
+};
+
+static_assert(sizeof(FrameSequenceFileHeader) == 64,
+              "Unexpected size of FrameSequenceFileHeader.");
+static_assert(sizeof(FrameSequenceChunkHeader) == 24,
+              "Unexpected size of FrameSequenceChunkHeader.");
+static_assert(sizeof(FrameSequenceIndexEntry) == 32,
+              "Unexpected size of FrameSequenceIndexEntry.");
+static_assert(sizeof(FrameSequenceTrailer) == 16,
+              "Unexpected size of FrameSequenceTrailer.");
+
+// Returns the number of padding bytes following a payload of |size| bytes.
+inline uint64_t FrameSequencePadding(uint64_t size) {
+  return (8 - size % 8) % 8;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_IO_FRAME_SEQUENCE_FORMAT_H_
@@ -0,0 +1,406 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "io/frame_sequence_player.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+#include "compression/decode.h"
+#include "compression/point_cloud/point_cloud_sequence_decoder.h"
+
+namespace draco {
+
+struct FrameSequencePlayer::WorkerState {
+  Decoder decoder;
+  PointCloudSequenceDecoder sequence_decoder;
+  // Last frame held by |sequence_decoder| or -1.
+  int64_t last_decoded_frame = -1;
+  // Set when the current frame was abandoned because it left the window.
+  bool cancelled = false;
+};
+
+StatusOr<std::unique_ptr<FrameSequencePlayer>> FrameSequencePlayer::Create(
+    std::unique_ptr<FrameSequenceReader> reader,
+    const FrameSequencePlayerOptions &options) {
+  if (reader == nullptr) {
+    return Status(Status::INVALID_PARAMETER, "Missing frame sequence.");
+  }
+  if (reader->codec() != FRAME_SEQUENCE_CODEC_DRACO &&
+      reader->codec() != FRAME_SEQUENCE_CODEC_POINT_CLOUD_SEQUENCE) {
+    return Status(Status::UNSUPPORTED_VERSION, "Unknown frame codec.");
+  }
+  std::unique_ptr<FrameSequencePlayer> player(
+      new FrameSequencePlayer(std::move(reader), options));
+  return player;
+}
+
+FrameSequencePlayer::FrameSequencePlayer(
+    std::unique_ptr<FrameSequenceReader> reader,
+    const FrameSequencePlayerOptions &options)
+    : reader_(std::move(reader)),
+      options_(options),
+      window_size_(std::min<int64_t>(std::max(options.ring_size, 1),
+                                     reader_->num_frames())),
+      playhead_(0),
+      stop_(false),
+      num_busy_workers_(0) {
+  slots_.resize(std::max(options_.ring_size, 1));
+  for (Slot &slot : slots_) {
+    slot.point_cloud.reset(new PointCloud());
+    GeometryAttribute va;
+    va.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+            sizeof(float) * 3, 0);
+    const int att_id = slot.point_cloud->AddAttribute(va, true, 0);
+    slot.positions = slot.point_cloud->attribute(att_id);
+  }
+  const int num_workers = std::max(options_.num_workers, 1);
+  for (int i = 0; i < num_workers; ++i) {
+    worker_states_.push_back(
+        std::unique_ptr<WorkerState>(new WorkerState()));
+  }
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.emplace_back(&FrameSequencePlayer::WorkerLoop, this,
+                          worker_states_[i].get());
+  }
+}
+
+FrameSequencePlayer::~FrameSequencePlayer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_available_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+void FrameSequencePlayer::Seek(size_t frame_index) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SetPlayhead(frame_index);
+  }
+  work_available_.notify_all();
+}
+
+StatusOr<const PointCloud *> FrameSequencePlayer::GetFrame(
+    size_t frame_index, int64_t timeout_us) {
+  if (frame_index >= reader_->num_frames()) {
+    return Status(Status::INVALID_PARAMETER, "Invalid frame index.");
+  }
+  const int64_t index = static_cast<int64_t>(frame_index);
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (playhead_.load() != index) {
+    SetPlayhead(index);
+    work_available_.notify_all();
+  }
+  const auto is_done = [this, index] {
+    const Slot *const slot = FindSlot(index);
+    return slot != nullptr &&
+           (slot->state == SLOT_READY || slot->state == SLOT_FAILED);
+  };
+  if (timeout_us < 0) {
+    frame_done_.wait(lock, is_done);
+  } else if (!frame_done_.wait_for(
+                 lock, std::chrono::microseconds(timeout_us), is_done)) {
+    return static_cast<const PointCloud *>(nullptr);
+  }
+  const Slot *const slot = FindSlot(index);
+  if (slot->state == SLOT_FAILED) {
+    return slot->status;
+  }
+  return static_cast<const PointCloud *>(slot->point_cloud.get());
+}
+
+bool FrameSequencePlayer::IsFrameReady(size_t frame_index) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Slot *const slot = FindSlot(static_cast<int64_t>(frame_index));
+  return slot != nullptr && slot->state == SLOT_READY;
+}
+
+void FrameSequencePlayer::SetPlayhead(int64_t frame_index) {
+  playhead_.store(frame_index);
+  // Frames outside of the new window are released. Slots of frames that are
+  // being decoded are released by their worker.
+  for (Slot &slot : slots_) {
+    if (slot.state != SLOT_DECODING &&
+        WindowOffset(slot.frame_index, frame_index) < 0) {
+      slot.frame_index = -1;
+      slot.state = SLOT_EMPTY;
+    }
+  }
+}
+
+int64_t FrameSequencePlayer::WindowOffset(int64_t frame_index,
+                                          int64_t playhead) const {
+  if (frame_index < 0) {
+    return -1;
+  }
+  int64_t offset = frame_index - playhead;
+  if (offset < 0 && options_.loop) {
+    offset += reader_->num_frames();
+  }
+  if (offset < 0 || offset >= window_size_) {
+    return -1;
+  }
+  return offset;
+}
+
+int64_t FrameSequencePlayer::WindowFrame(int64_t playhead,
+                                         int64_t offset) const {
+  int64_t frame = playhead + offset;
+  if (frame >= static_cast<int64_t>(reader_->num_frames())) {
+    if (!options_.loop) {
+      return -1;
+    }
+    frame -= reader_->num_frames();
+  }
+  return frame;
+}
+
+bool FrameSequencePlayer::IsKeyFrame(int64_t frame_index) const {
+  return (reader_->GetIndexEntry(frame_index).flags &
+          FRAME_SEQUENCE_FLAG_KEYFRAME) != 0;
+}
+
+FrameSequencePlayer::Slot *FrameSequencePlayer::FindSlot(int64_t frame_index) {
+  for (Slot &slot : slots_) {
+    if (slot.frame_index == frame_index) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+const FrameSequencePlayer::Slot *FrameSequencePlayer::FindSlot(
+    int64_t frame_index) const {
+  for (const Slot &slot : slots_) {
+    if (slot.frame_index == frame_index) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+bool FrameSequencePlayer::SelectTask(const WorkerState &state,
+                                     int64_t *out_frame_index,
+                                     Slot **out_slot) {
+  Slot *free_slot = nullptr;
+  for (Slot &slot : slots_) {
+    if (slot.frame_index < 0) {
+      free_slot = &slot;
+      break;
+    }
+  }
+  if (free_slot == nullptr) {
+    return false;
+  }
+  const int64_t playhead = playhead_.load();
+  int64_t selected = -1;
+  if (reader_->codec() == FRAME_SEQUENCE_CODEC_DRACO) {
+    // Frames are independent, the earliest missing frame is decoded first.
+    for (int64_t i = 0; i < window_size_ && selected < 0; ++i) {
+      const int64_t frame = WindowFrame(playhead, i);
+      if (frame < 0) {
+        break;
+      }
+      if (FindSlot(frame) == nullptr) {
+        selected = frame;
+      }
+    }
+  } else {
+    // Decoding a predicted frame requires all frames since the preceding key
+    // frame. The worker continues its run if possible, otherwise it starts at
+    // a key frame so that the workers don't decode the same frames.
+    int64_t first_missing = -1;
+    for (int64_t i = 0; i < window_size_ && selected < 0; ++i) {
+      const int64_t frame = WindowFrame(playhead, i);
+      if (frame < 0) {
+        break;
+      }
+      if (FindSlot(frame) != nullptr) {
+        continue;
+      }
+      if (state.last_decoded_frame >= 0 &&
+          frame == state.last_decoded_frame + 1 &&
+          !IsKeyFrame(frame)) {
+        selected = frame;
+      } else if (first_missing < 0) {
+        first_missing = frame;
+      }
+    }
+    if (selected < 0) {
+      for (int64_t i = 0; i < window_size_ && selected < 0; ++i) {
+        const int64_t frame = WindowFrame(playhead, i);
+        if (frame < 0) {
+          break;
+        }
+        if (FindSlot(frame) == nullptr && IsKeyFrame(frame)) {
+          selected = frame;
+        }
+      }
+    }
+    // Otherwise the earliest missing frame is decoded starting at its key
+    // frame, but only if no other worker is busy. The busy worker may be
+    // about to continue into this frame.
+    if (selected < 0 && first_missing >= 0 && num_busy_workers_ == 0) {
+      selected = first_missing;
+    }
+  }
+  if (selected < 0) {
+    return false;
+  }
+  free_slot->frame_index = selected;
+  free_slot->state = SLOT_DECODING;
+  *out_frame_index = selected;
+  *out_slot = free_slot;
+  return true;
+}
+
+void FrameSequencePlayer::WorkerLoop(WorkerState *state) {
+  while (true) {
+    int64_t frame_index = -1;
+    Slot *slot = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_available_.wait(lock, [this, state, &frame_index, &slot] {
+        return stop_ || SelectTask(*state, &frame_index, &slot);
+      });
+      if (stop_) {
+        if (slot != nullptr) {
+          slot->frame_index = -1;
+          slot->state = SLOT_EMPTY;
+        }
+        return;
+      }
+      ++num_busy_workers_;
+    }
+
+    // The slot is owned by this worker until its state changes, so it can be
+    // written without holding the lock.
+    const Status status = DecodeFrame(state, frame_index, slot);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_busy_workers_;
+      if (state->cancelled || IsStale(frame_index)) {
+        slot->frame_index = -1;
+        slot->state = SLOT_EMPTY;
+      } else if (status.ok()) {
+        slot->state = SLOT_READY;
+      } else {
+        slot->state = SLOT_FAILED;
+        slot->status = status;
+      }
+    }
+    frame_done_.notify_all();
+    // Other workers may wait for a free slot or for this worker to finish.
+    work_available_.notify_all();
+  }
+}
+
+Status FrameSequencePlayer::DecodeFrame(WorkerState *state,
+                                        int64_t frame_index, Slot *slot) {
+  state->cancelled = false;
+  if (reader_->codec() == FRAME_SEQUENCE_CODEC_DRACO) {
+    return DecodeDracoFrame(state, frame_index, slot);
+  }
+  return DecodeSequenceFrame(state, frame_index, slot);
+}
+
+Status FrameSequencePlayer::DecodeDracoFrame(WorkerState *state,
+                                             int64_t frame_index,
+                                             Slot *slot) {
+  if (IsStale(frame_index)) {
+    state->cancelled = true;
+    return OkStatus();
+  }
+  DecoderBuffer buffer;
+  DRACO_RETURN_IF_ERROR(reader_->InitDecoderBuffer(frame_index, &buffer));
+  DRACO_ASSIGN_OR_RETURN(std::unique_ptr<PointCloud> pc,
+                         state->decoder.DecodePointCloudFromBuffer(&buffer));
+  const PointAttribute *const att =
+      pc->GetNamedAttribute(GeometryAttribute::POSITION);
+  if (att == nullptr || att->num_components() != 3) {
+    return ErrorStatus("Missing position attribute.");
+  }
+  // The decoded positions are copied to the slot so that its storage is
+  // reused for all frames.
+  const PointIndex::ValueType num_points = pc->num_points();
+  slot->point_cloud->set_num_points(num_points);
+  slot->positions->Reset(num_points);
+  if (num_points == 0) {
+    return OkStatus();
+  }
+  float *const out = reinterpret_cast<float *>(
+      slot->positions->GetAddress(AttributeValueIndex(0)));
+  if (att->data_type() == DT_FLOAT32 && att->is_mapping_identity() &&
+      att->byte_stride() == 3 * sizeof(float) && att->size() == num_points) {
+    memcpy(out, att->GetAddress(AttributeValueIndex(0)),
+           3 * sizeof(float) * num_points);
+  } else {
+    for (PointIndex i(0); i < num_points; ++i) {
+      att->ConvertValue<float, 3>(att->mapped_index(i), &out[3 * i.value()]);
+    }
+  }
+  return OkStatus();
+}
+
+Status FrameSequencePlayer::DecodeSequenceFrame(WorkerState *state,
+                                                int64_t frame_index,
+                                                Slot *slot) {
+  PointCloudSequenceDecoder &decoder = state->sequence_decoder;
+  int64_t first_frame = frame_index;
+  if (state->last_decoded_frame < 0 ||
+      state->last_decoded_frame + 1 != frame_index) {
+    // Restart from the preceding key frame.
+    while (first_frame > 0 && !IsKeyFrame(first_frame)) {
+      --first_frame;
+    }
+    decoder.Reset();
+    state->last_decoded_frame = -1;
+  }
+  for (int64_t i = first_frame; i <= frame_index; ++i) {
+    if (IsStale(frame_index)) {
+      // The decoded run is kept so that it can be continued later.
+      state->cancelled = true;
+      return OkStatus();
+    }
+    DecoderBuffer buffer;
+    Status status = reader_->InitDecoderBuffer(i, &buffer);
+    if (status.ok()) {
+      status = decoder.DecodeFrame(&buffer);
+    }
+    if (!status.ok()) {
+      state->last_decoded_frame = -1;
+      return status;
+    }
+    state->last_decoded_frame = i;
+  }
+  const PointIndex::ValueType num_points =
+      static_cast<PointIndex::ValueType>(decoder.num_points());
+  slot->point_cloud->set_num_points(num_points);
+  slot->positions->Reset(num_points);
+  if (num_points > 0) {
+    decoder.GetPositions(reinterpret_cast<float *>(slot->positions->GetAddress(
+                             AttributeValueIndex(0))),
+                         0, num_points);
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
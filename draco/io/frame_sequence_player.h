@@ -0,0 +1,169 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_FRAME_SEQUENCE_PLAYER_H_
+#define DRACO_IO_FRAME_SEQUENCE_PLAYER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/status.h"
+#include "core/status_or.h"
+#include "io/frame_sequence_reader.h"
+#include "point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Options used by the FrameSequencePlayer class.
+struct FrameSequencePlayerOptions {
+  // Number of decoding threads.
+  int num_workers = 2;
+
+  // Number of decoded frames kept in memory. Frames are decoded ahead of the
+  // playhead until the ring is full.
+  int ring_size = 8;
+
+  // If true, the frames at the start of the sequence are prefetched when the
+  // playhead approaches the end.
+  bool loop = false;
+};
+
+// Plays back a frame sequence by decoding the frames ahead of a playhead on a
+// pool of worker threads. Decoded frames are stored in a fixed ring of
+// PointCloud instances that are reused for all frames, so memory use depends
+// only on the ring size and the size of the frames, not on the length of the
+// sequence. Only the POSITION attribute is decoded. For sequences of Draco
+// frames, Decoder returns a new point cloud for each frame, whose positions
+// are then copied into the ring.
+//
+// Moving the playhead (by GetFrame() or Seek()) releases all decoded frames
+// outside of the new prefetch window. Decoding of frames that are no longer
+// needed is abandoned as soon as possible.
+//
+// Sequences coded with temporal prediction are decoded in runs starting at
+// key frames. A worker continues its run while the next frame is needed and
+// other workers start at the following key frames.
+//
+// Usage:
+//   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<FrameSequencePlayer> player,
+//                          FrameSequencePlayer::Create(std::move(reader),
+//                                                      options));
+//   for (size_t i = 0; i < player->num_frames(); ++i) {
+//     DRACO_ASSIGN_OR_RETURN(const PointCloud *pc, player->GetFrame(i, -1));
+//     Render(*pc);
+//   }
+//
+// GetFrame() and Seek() must be called from a single thread.
+class FrameSequencePlayer {
+ public:
+  static StatusOr<std::unique_ptr<FrameSequencePlayer>> Create(
+      std::unique_ptr<FrameSequenceReader> reader,
+      const FrameSequencePlayerOptions &options);
+
+  FrameSequencePlayer(const FrameSequencePlayer &) = delete;
+  FrameSequencePlayer &operator=(const FrameSequencePlayer &) = delete;
+
+  // Stops all worker threads.
+  ~FrameSequencePlayer();
+
+  size_t num_frames() const { return reader_->num_frames(); }
+  const FrameSequenceReader &reader() const { return *reader_; }
+
+  // Moves the playhead to |frame_index| without waiting for the frame.
+  void Seek(size_t frame_index);
+
+  // Moves the playhead to |frame_index| and returns the decoded frame. Waits
+  // up to |timeout_us| microseconds for the frame to be decoded, or
+  // indefinitely if |timeout_us| is negative. Returns nullptr if the frame is
+  // not available in time and an error status if it could not be decoded.
+  // The returned point cloud is valid until the next call of GetFrame() or
+  // Seek().
+  StatusOr<const PointCloud *> GetFrame(size_t frame_index,
+                                        int64_t timeout_us);
+
+  // Returns true if the frame at |frame_index| is decoded.
+  bool IsFrameReady(size_t frame_index) const;
+
+ private:
+  enum SlotState { SLOT_EMPTY, SLOT_DECODING, SLOT_READY, SLOT_FAILED };
+
+  struct Slot {
+    int64_t frame_index = -1;
+    SlotState state = SLOT_EMPTY;
+    Status status;
+    std::unique_ptr<PointCloud> point_cloud;
+    PointAttribute *positions = nullptr;
+  };
+
+  // Decoder state owned by a worker thread.
+  struct WorkerState;
+
+  FrameSequencePlayer(std::unique_ptr<FrameSequenceReader> reader,
+                      const FrameSequencePlayerOptions &options);
+
+  void WorkerLoop(WorkerState *state);
+  // Selects the next frame to be decoded by the worker and reserves a slot
+  // for it. Returns false if there is nothing to do. Must be called with
+  // |mutex_| held.
+  bool SelectTask(const WorkerState &state, int64_t *out_frame_index,
+                  Slot **out_slot);
+  Status DecodeFrame(WorkerState *state, int64_t frame_index, Slot *slot);
+  Status DecodeDracoFrame(WorkerState *state, int64_t frame_index,
+                          Slot *slot);
+  Status DecodeSequenceFrame(WorkerState *state, int64_t frame_index,
+                             Slot *slot);
+
+  // Returns the distance of |frame_index| from |playhead| or -1 if the frame
+  // is outside of the prefetch window.
+  int64_t WindowOffset(int64_t frame_index, int64_t playhead) const;
+  // Returns the frame at |offset| in the window of |playhead| or -1 if the
+  // window extends past the end of the sequence.
+  int64_t WindowFrame(int64_t playhead, int64_t offset) const;
+  // Returns true if the frame left the prefetch window, i.e. its decoding can
+  // be abandoned.
+  bool IsStale(int64_t frame_index) const {
+    return WindowOffset(frame_index, playhead_.load()) < 0;
+  }
+  bool IsKeyFrame(int64_t frame_index) const;
+  Slot *FindSlot(int64_t frame_index);
+  const Slot *FindSlot(int64_t frame_index) const;
+  // Moves the playhead. Must be called with |mutex_| held.
+  void SetPlayhead(int64_t frame_index);
+
+  const std::unique_ptr<FrameSequenceReader> reader_;
+  const FrameSequencePlayerOptions options_;
+  const int64_t window_size_;
+
+  mutable std::mutex mutex_;
+  // Signaled when the playhead moves or a slot becomes available.
+  std::condition_variable work_available_;
+  // Signaled when a frame is decoded.
+  std::condition_variable frame_done_;
+  std::atomic<int64_t> playhead_;
+  bool stop_;
+  // Number of workers decoding a frame.
+  int num_busy_workers_;
+  std::vector<Slot> slots_;
+
+  std::vector<std::unique_ptr<WorkerState>> worker_states_;
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_FRAME_SEQUENCE_PLAYER_H_
@@ -0,0 +1,218 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "io/frame_sequence_player.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "compression/point_cloud/point_cloud_sequence_decoder.h"
+#include "compression/point_cloud/point_cloud_sequence_encoder.h"
+#include "core/draco_test_base.h"
+#include "io/frame_sequence_writer.h"
+
+namespace draco {
+
+// Plays back sequences coded with temporal prediction, i.e. runs of frames
+// that must be decoded from the preceding key frame.
+class FrameSequencePlayerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    file_name_ = ::testing::TempDir() + "frame_sequence_player_test.drcseq";
+  }
+
+  void TearDown() override { remove(file_name_.c_str()); }
+
+  // Writes |num_frames| frames with a key frame every |key_frame_interval|
+  // frames and stores the positions of each decoded frame in
+  // |expected_frames_|.
+  void WriteSequence(int num_frames, int key_frame_interval) {
+    auto writer_or = FrameSequenceWriter::Create(
+        file_name_, 30.0, FRAME_SEQUENCE_CODEC_POINT_CLOUD_SEQUENCE);
+    ASSERT_TRUE(writer_or.ok());
+    std::unique_ptr<FrameSequenceWriter> writer = std::move(writer_or).value();
+    PointCloudSequenceEncoder encoder;
+    encoder.SetKeyFrameInterval(key_frame_interval);
+    PointCloudSequenceDecoder decoder;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> positions(3 * 500);
+    for (float &value : positions) {
+      value = dist(rng);
+    }
+    for (int i = 0; i < num_frames; ++i) {
+      // Frames differ by a few points and in their number of points.
+      for (int j = 0; j < 10; ++j) {
+        positions[rng() % positions.size()] = dist(rng);
+      }
+      const size_t num_points = positions.size() / 3 - i;
+      EncoderBuffer buffer;
+      ASSERT_TRUE(
+          encoder.EncodeFrame(positions.data(), num_points, 0, &buffer).ok());
+      const uint32_t flags =
+          encoder.last_frame_is_key_frame() ? FRAME_SEQUENCE_FLAG_KEYFRAME : 0u;
+      ASSERT_TRUE(
+          writer->AppendFrame(buffer.data(), buffer.size(), 1000 * i, flags)
+              .ok());
+      DecoderBuffer in_buffer;
+      in_buffer.Init(buffer.data(), buffer.size());
+      ASSERT_TRUE(decoder.DecodeFrame(&in_buffer).ok());
+      std::vector<float> expected(3 * decoder.num_points());
+      decoder.GetPositions(expected.data(), 0, decoder.num_points());
+      expected_frames_.push_back(expected);
+    }
+    ASSERT_TRUE(writer->Finalize().ok());
+  }
+
+  std::unique_ptr<FrameSequencePlayer> CreatePlayer(
+      const FrameSequencePlayerOptions &options) {
+    auto reader_or = FrameSequenceReader::Open(file_name_);
+    EXPECT_TRUE(reader_or.ok());
+    if (!reader_or.ok()) {
+      return nullptr;
+    }
+    auto player_or =
+        FrameSequencePlayer::Create(std::move(reader_or).value(), options);
+    EXPECT_TRUE(player_or.ok());
+    if (!player_or.ok()) {
+      return nullptr;
+    }
+    return std::move(player_or).value();
+  }
+
+  void ExpectFrame(FrameSequencePlayer *player, int frame_index) {
+    const StatusOr<const PointCloud *> pc_or =
+        player->GetFrame(frame_index, -1);
+    ASSERT_TRUE(pc_or.ok()) << frame_index;
+    const PointCloud *const pc = pc_or.value();
+    ASSERT_NE(pc, nullptr);
+    EXPECT_TRUE(player->IsFrameReady(frame_index));
+    const std::vector<float> &expected = expected_frames_[frame_index];
+    ASSERT_EQ(pc->num_points(), expected.size() / 3);
+    const PointAttribute *const att =
+        pc->GetNamedAttribute(GeometryAttribute::POSITION);
+    ASSERT_NE(att, nullptr);
+    const float *const positions = reinterpret_cast<const float *>(
+        att->GetAddress(AttributeValueIndex(0)));
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), positions))
+        << frame_index;
+  }
+
+  std::string file_name_;
+  std::vector<std::vector<float>> expected_frames_;
+};
+
+TEST_F(FrameSequencePlayerTest, TestPlayback) {
+  WriteSequence(20, 5);
+  FrameSequencePlayerOptions options;
+  options.ring_size = 4;
+  std::unique_ptr<FrameSequencePlayer> player = CreatePlayer(options);
+  ASSERT_NE(player, nullptr);
+  ASSERT_EQ(player->num_frames(), 20u);
+  for (int i = 0; i < 20; ++i) {
+    ExpectFrame(player.get(), i);
+  }
+}
+
+TEST_F(FrameSequencePlayerTest, TestSeek) {
+  WriteSequence(20, 5);
+  for (const int num_workers : {1, 3}) {
+    FrameSequencePlayerOptions options;
+    options.num_workers = num_workers;
+    options.ring_size = 3;
+    std::unique_ptr<FrameSequencePlayer> player = CreatePlayer(options);
+    ASSERT_NE(player, nullptr);
+    // Frames in the middle of a run are decoded from the preceding key frame.
+    for (const int frame_index : {17, 3, 12, 13, 0, 19, 9, 4, 5}) {
+      ExpectFrame(player.get(), frame_index);
+    }
+    player->Seek(8);
+    ExpectFrame(player.get(), 11);
+  }
+}
+
+TEST_F(FrameSequencePlayerTest, TestLoop) {
+  WriteSequence(10, 4);
+  FrameSequencePlayerOptions options;
+  options.ring_size = 4;
+  options.loop = true;
+  std::unique_ptr<FrameSequencePlayer> player = CreatePlayer(options);
+  ASSERT_NE(player, nullptr);
+  for (int i = 0; i < 25; ++i) {
+    ExpectFrame(player.get(), i % 10);
+  }
+}
+
+TEST_F(FrameSequencePlayerTest, TestCorruptedFrame) {
+  WriteSequence(10, 5);
+  // Read the file into memory and corrupt the key frame of the first run.
+  std::vector<char> data;
+  FILE *file = fopen(file_name_.c_str(), "rb");
+  ASSERT_NE(file, nullptr);
+  char chunk[4096];
+  size_t size;
+  while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    data.insert(data.end(), chunk, chunk + size);
+  }
+  fclose(file);
+  {
+    auto reader_or = FrameSequenceReader::OpenFromMemory(data.data(),
+                                                         data.size());
+    ASSERT_TRUE(reader_or.ok());
+    const StatusOr<FrameSequenceFrame> frame =
+        reader_or.value()->GetFrame(0);
+    ASSERT_TRUE(frame.ok());
+    // Invalid frame version.
+    data[frame.value().data - data.data()] = 0;
+  }
+  auto reader_or = FrameSequenceReader::OpenFromMemory(data.data(),
+                                                       data.size());
+  ASSERT_TRUE(reader_or.ok());
+  auto player_or = FrameSequencePlayer::Create(std::move(reader_or).value(),
+                                               FrameSequencePlayerOptions());
+  ASSERT_TRUE(player_or.ok());
+  std::unique_ptr<FrameSequencePlayer> player = std::move(player_or).value();
+
+  // The whole run depends on the corrupted key frame.
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_FALSE(player->GetFrame(i, -1).ok()) << i;
+  }
+  for (int i = 5; i < 10; ++i) {
+    ExpectFrame(player.get(), i);
+  }
+}
+
+TEST_F(FrameSequencePlayerTest, TestUnknownCodec) {
+  EXPECT_FALSE(
+      FrameSequencePlayer::Create(nullptr, FrameSequencePlayerOptions()).ok());
+  {
+    auto writer_or = FrameSequenceWriter::Create(
+        file_name_, 30.0, static_cast<FrameSequenceCodec>(7));
+    ASSERT_TRUE(writer_or.ok());
+    ASSERT_TRUE(writer_or.value()->AppendFrame("frame", 5, 0).ok());
+    ASSERT_TRUE(writer_or.value()->Finalize().ok());
+  }
+  auto reader_or = FrameSequenceReader::Open(file_name_);
+  ASSERT_TRUE(reader_or.ok());
+  EXPECT_EQ(FrameSequencePlayer::Create(std::move(reader_or).value(),
+                                        FrameSequencePlayerOptions())
+                .status()
+                .code(),
+            Status::UNSUPPORTED_VERSION);
+}
+
+}  // namespace draco
@@ -0,0 +1,206 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "io/frame_sequence_reader.h"
+
+namespace draco {
+
+FrameSequenceReader::FrameSequenceReader()
+    : data_(nullptr),
+      size_(0),
+      header_(),
+      finalized_(false),
+      index_(nullptr),
+      num_frames_(0),
+      metadata_(nullptr),
+      metadata_size_(0) {}
+
+StatusOr<std::unique_ptr<FrameSequenceReader>> FrameSequenceReader::Open(
+    const std::string &file_name) {
+  std::unique_ptr<MappedFile> file = MappedFile::Open(file_name);
+  if (file == nullptr) {
+    return Status(Status::IO_ERROR, "Unable to open the file.");
+  }
+  std::unique_ptr<FrameSequenceReader> reader(new FrameSequenceReader());
+  reader->data_ = file->data();
+  reader->size_ = file->size();
+  reader->file_ = std::move(file);
+  DRACO_RETURN_IF_ERROR(reader->Parse());
+  return reader;
+}
+
+StatusOr<std::unique_ptr<FrameSequenceReader>>
+FrameSequenceReader::OpenFromMemory(const char *data, size_t size) {
+  std::unique_ptr<FrameSequenceReader> reader(new FrameSequenceReader());
+  reader->data_ = data;
+  reader->size_ = size;
+  DRACO_RETURN_IF_ERROR(reader->Parse());
+  return reader;
+}
+
+StatusOr<FrameSequenceFrame> FrameSequenceReader::GetFrame(
+    size_t frame_index) const {
+  if (frame_index >= num_frames_) {
+    return Status(Status::INVALID_PARAMETER, "Frame index out of range.");
+  }
+  // All entries were validated against the file size in Parse().
+  const FrameSequenceIndexEntry entry = GetIndexEntry(frame_index);
+  FrameSequenceFrame frame;
+  frame.data = data_ + entry.offset;
+  frame.size = static_cast<size_t>(entry.size);
+  frame.timestamp_us = entry.timestamp_us;
+  frame.flags = entry.flags;
+  return frame;
+}
+
+Status FrameSequenceReader::InitDecoderBuffer(size_t frame_index,
+                                              DecoderBuffer *out_buffer) const {
+  DRACO_ASSIGN_OR_RETURN(const FrameSequenceFrame frame,
+                         GetFrame(frame_index));
+  out_buffer->Init(frame.data, frame.size);
+  return OkStatus();
+}
+
+size_t FrameSequenceReader::FindFrame(int64_t timestamp_us) const {
+  // Binary search for the first frame with a larger timestamp.
+  size_t lo = 0;
+  size_t hi = num_frames_;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (GetIndexEntry(mid).timestamp_us <= timestamp_us) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo == 0 ? 0 : lo - 1;
+}
+
+uint64_t FrameSequenceReader::frames_end_offset() const {
+  if (num_frames_ == 0) {
+    return header_.header_size;
+  }
+  const FrameSequenceIndexEntry last = GetIndexEntry(num_frames_ - 1);
+  return last.offset + last.size + FrameSequencePadding(last.size);
+}
+
+Status FrameSequenceReader::Parse() {
+  if (data_ == nullptr || size_ < sizeof(FrameSequenceFileHeader)) {
+    return Status(Status::IO_ERROR, "Input is not a frame sequence.");
+  }
+  memcpy(&header_, data_, sizeof(header_));
+  if (memcmp(header_.magic, kFrameSequenceMagic, sizeof(header_.magic)) !=
+      0) {
+    return Status(Status::IO_ERROR, "Input is not a frame sequence.");
+  }
+  if (header_.major_version != kFrameSequenceMajorVersion) {
+    return Status(Status::UNKNOWN_VERSION, "Unknown frame sequence version.");
+  }
+  if (header_.header_size < sizeof(FrameSequenceFileHeader) ||
+      header_.header_size > size_) {
+    return Status(Status::IO_ERROR, "Invalid frame sequence header.");
+  }
+
+  // Prefer the offset stored in the header, fall back to the trailer in case
+  // the header could not be updated when the file was finalized.
+  uint64_t index_offset = header_.index_offset;
+  if (index_offset == 0 && size_ >= header_.header_size +
+                                        sizeof(FrameSequenceTrailer)) {
+    FrameSequenceTrailer trailer;
+    memcpy(&trailer, data_ + size_ - sizeof(trailer), sizeof(trailer));
+    if (memcmp(trailer.magic, kFrameSequenceTrailerMagic,
+               sizeof(trailer.magic)) == 0) {
+      index_offset = trailer.index_offset;
+    }
+  }
+  finalized_ = index_offset != 0 && ParseIndex(index_offset);
+  if (finalized_) {
+    if (header_.metadata_size > 0 &&
+        !ParseMetadata(header_.metadata_offset, header_.metadata_size)) {
+      return Status(Status::IO_ERROR, "Invalid frame sequence metadata.");
+    }
+  } else {
+    RecoverIndex();
+  }
+  return OkStatus();
+}
+
+bool FrameSequenceReader::ParseIndex(uint64_t index_offset) {
+  if (index_offset < header_.header_size ||
+      index_offset > size_ - sizeof(FrameSequenceChunkHeader)) {
+    return false;
+  }
+  FrameSequenceChunkHeader chunk;
+  memcpy(&chunk, data_ + index_offset, sizeof(chunk));
+  const uint64_t payload_offset = index_offset + sizeof(chunk);
+  if (chunk.type != FRAME_SEQUENCE_CHUNK_INDEX ||
+      chunk.payload_size % sizeof(FrameSequenceIndexEntry) != 0 ||
+      chunk.payload_size > size_ - payload_offset) {
+    return false;
+  }
+  index_ = data_ + payload_offset;
+  num_frames_ = chunk.payload_size / sizeof(FrameSequenceIndexEntry);
+  for (size_t i = 0; i < num_frames_; ++i) {
+    const FrameSequenceIndexEntry entry = GetIndexEntry(i);
+    if (entry.offset < header_.header_size || entry.offset > size_ ||
+        entry.size > size_ - entry.offset) {
+      index_ = nullptr;
+      num_frames_ = 0;
+      return false;
+    }
+  }
+  return true;
+}
+
+void FrameSequenceReader::RecoverIndex() {
+  recovered_index_.clear();
+  uint64_t pos = header_.header_size;
+  while (pos <= size_ && size_ - pos >= sizeof(FrameSequenceChunkHeader)) {
+    FrameSequenceChunkHeader chunk;
+    memcpy(&chunk, data_ + pos, sizeof(chunk));
+    const uint64_t payload_offset = pos + sizeof(chunk);
+    if (chunk.payload_size > size_ - payload_offset) {
+      break;  // Truncated chunk.
+    }
+    if (chunk.type == FRAME_SEQUENCE_CHUNK_FRAME) {
+      FrameSequenceIndexEntry entry;
+      entry.offset = payload_offset;
+      entry.size = chunk.payload_size;
+      entry.timestamp_us = chunk.timestamp_us;
+      entry.flags = chunk.flags;
+      entry.reserved = 0;
+      recovered_index_.push_back(entry);
+    } else if (chunk.type == FRAME_SEQUENCE_CHUNK_METADATA) {
+      ParseMetadata(payload_offset, chunk.payload_size);
+    } else {
+      break;  // Index chunk or unknown data.
+    }
+    pos = payload_offset + chunk.payload_size +
+          FrameSequencePadding(chunk.payload_size);
+  }
+  index_ = reinterpret_cast<const char *>(recovered_index_.data());
+  num_frames_ = recovered_index_.size();
+}
+
+bool FrameSequenceReader::ParseMetadata(uint64_t offset, uint64_t size) {
+  if (offset < header_.header_size || offset > size_ ||
+      size > size_ - offset) {
+    return false;
+  }
+  metadata_ = data_ + offset;
+  metadata_size_ = static_cast<size_t>(size);
+  return true;
+}
+
+}  // namespace draco
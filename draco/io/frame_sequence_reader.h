@@ -0,0 +1,141 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_FRAME_SEQUENCE_READER_H_
+#define DRACO_IO_FRAME_SEQUENCE_READER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/decoder_buffer.h"
+#include "core/status.h"
+#include "core/status_or.h"
+#include "io/frame_sequence_format.h"
+#include "io/mapped_file.h"
+
+namespace draco {
+
+// Encoded frame stored in a frame sequence. |data| points directly into the
+// memory of the reader.
+struct FrameSequenceFrame {
+  FrameSequenceFrame()
+      : data(nullptr), size(0), timestamp_us(0), flags(0) {}
+
+  const char *data;
+  size_t size;
+  int64_t timestamp_us;
+  uint32_t flags;
+};
+
+// Reader of the single-file frame sequence container described in
+// frame_sequence_format.h. The file is memory-mapped and frames are returned
+// as views into the mapping, so the encoded data is not read into memory
+// first. The decoded frames are still new point clouds. Any frame can be
+// accessed in constant time using the trailing index. Files without an index
+// (e.g. an interrupted recording) are indexed once on open by walking their
+// chunks.
+//
+// Usage:
+//   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<FrameSequenceReader> reader,
+//                          FrameSequenceReader::Open(file_name));
+//   DecoderBuffer buffer;
+//   DRACO_RETURN_IF_ERROR(reader->InitDecoderBuffer(frame_index, &buffer));
+//   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<PointCloud> pc,
+//                          decoder.DecodePointCloudFromBuffer(&buffer));
+class FrameSequenceReader {
+ public:
+  // Opens and memory-maps the sequence stored in |file_name|. A file that is
+  // still being recorded can be opened as well, frames appended after this
+  // call are not visible to the reader.
+  static StatusOr<std::unique_ptr<FrameSequenceReader>> Open(
+      const std::string &file_name);
+
+  // Reads the sequence from memory. |data| must stay valid for the lifetime
+  // of the reader.
+  static StatusOr<std::unique_ptr<FrameSequenceReader>> OpenFromMemory(
+      const char *data, size_t size);
+
+  size_t num_frames() const { return num_frames_; }
+  double frame_rate() const { return header_.frame_rate; }
+  FrameSequenceCodec codec() const {
+    return static_cast<FrameSequenceCodec>(header_.codec);
+  }
+  const FrameSequenceFileHeader &header() const { return header_; }
+
+  // Returns true if the file was finalized by the writer. Files that were not
+  // finalized are indexed on open.
+  bool is_finalized() const { return finalized_; }
+
+  // Returns a view of the encoded frame at |frame_index| in the memory of the
+  // reader.
+  StatusOr<FrameSequenceFrame> GetFrame(size_t frame_index) const;
+
+  // Initializes |out_buffer| to decode the frame at |frame_index| directly
+  // from the memory of the reader.
+  Status InitDecoderBuffer(size_t frame_index, DecoderBuffer *out_buffer) const;
+
+  // Returns the index of the last frame with a timestamp not greater than
+  // |timestamp_us|, or 0 if there is no such frame. Frames are expected to be
+  // stored in the order of their timestamps.
+  size_t FindFrame(int64_t timestamp_us) const;
+
+  // Metadata stored with the sequence, e.g. a JSON description of the
+  // recording. Returns nullptr if there is none.
+  const char *metadata() const { return metadata_; }
+  size_t metadata_size() const { return metadata_size_; }
+
+  // Returns the index entry of the frame at |frame_index|. The index must be
+  // smaller than num_frames().
+  FrameSequenceIndexEntry GetIndexEntry(size_t frame_index) const {
+    FrameSequenceIndexEntry entry;
+    memcpy(&entry, index_ + frame_index * sizeof(FrameSequenceIndexEntry),
+           sizeof(FrameSequenceIndexEntry));
+    return entry;
+  }
+
+  // Offset right past the last frame chunk. New frames can be appended at
+  // this offset.
+  uint64_t frames_end_offset() const;
+
+ private:
+  FrameSequenceReader();
+
+  Status Parse();
+  // Uses the index chunk at |index_offset|. Returns false if the index is not
+  // valid, in which case the frames need to be recovered.
+  bool ParseIndex(uint64_t index_offset);
+  // Builds the index by walking all chunks of the file.
+  void RecoverIndex();
+  bool ParseMetadata(uint64_t offset, uint64_t size);
+
+  std::unique_ptr<MappedFile> file_;
+  const char *data_;
+  size_t size_;
+  FrameSequenceFileHeader header_;
+  bool finalized_;
+
+  // Array of |num_frames_| FrameSequenceIndexEntry values. Points either into
+  // the file or into |recovered_index_|.
+  const char *index_;
+  size_t num_frames_;
+  std::vector<FrameSequenceIndexEntry> recovered_index_;
+
+  const char *metadata_;
+  size_t metadata_size_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_FRAME_SEQUENCE_READER_H_
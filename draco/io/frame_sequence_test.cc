@@ -0,0 +1,249 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "core/draco_test_base.h"
+#include "io/frame_sequence_reader.h"
+#include "io/frame_sequence_writer.h"
+
+namespace draco {
+
+class FrameSequenceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    file_name_ = ::testing::TempDir() + "frame_sequence_test.drcseq";
+    for (int i = 0; i < 4; ++i) {
+      // Frames of different sizes to exercise the padding of the chunks.
+      frames_.push_back(std::string(5 + 7 * i, static_cast<char>('a' + i)));
+    }
+  }
+
+  void TearDown() override { remove(file_name_.c_str()); }
+
+  // Appends the test frames [begin, end), frame i at time 1000 * i. Only the
+  // first frame is a keyframe.
+  void WriteFrames(FrameSequenceWriter *writer, int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      ASSERT_TRUE(writer
+                      ->AppendFrame(frames_[i].data(), frames_[i].size(),
+                                    1000 * i, i == 0 ? 1 : 0)
+                      .ok());
+    }
+  }
+
+  void ExpectFrames(const FrameSequenceReader &reader, int num_frames) {
+    ASSERT_EQ(reader.num_frames(), num_frames);
+    for (int i = 0; i < num_frames; ++i) {
+      const StatusOr<FrameSequenceFrame> frame = reader.GetFrame(i);
+      ASSERT_TRUE(frame.ok());
+      EXPECT_EQ(std::string(frame.value().data, frame.value().size),
+                frames_[i]);
+      EXPECT_EQ(frame.value().timestamp_us, 1000 * i);
+      EXPECT_EQ(frame.value().flags, i == 0 ? 1u : 0u);
+    }
+  }
+
+  std::vector<char> ReadFile() const {
+    std::vector<char> data;
+    FILE *file = fopen(file_name_.c_str(), "rb");
+    if (file == nullptr) {
+      return data;
+    }
+    char chunk[4096];
+    size_t size;
+    while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+      data.insert(data.end(), chunk, chunk + size);
+    }
+    fclose(file);
+    return data;
+  }
+
+  std::string file_name_;
+  std::vector<std::string> frames_;
+};
+
+TEST_F(FrameSequenceTest, TestRoundTrip) {
+  auto writer_or = FrameSequenceWriter::Create(
+      file_name_, 30.0, FRAME_SEQUENCE_CODEC_POINT_CLOUD_SEQUENCE);
+  ASSERT_TRUE(writer_or.ok());
+  std::unique_ptr<FrameSequenceWriter> writer = std::move(writer_or).value();
+  WriteFrames(writer.get(), 0, 4);
+  writer->SetMetadata("{}", 2);
+  ASSERT_TRUE(writer->Finalize().ok());
+
+  auto reader_or = FrameSequenceReader::Open(file_name_);
+  ASSERT_TRUE(reader_or.ok());
+  const std::unique_ptr<FrameSequenceReader> reader =
+      std::move(reader_or).value();
+  EXPECT_TRUE(reader->is_finalized());
+  EXPECT_EQ(reader->frame_rate(), 30.0);
+  EXPECT_EQ(reader->codec(), FRAME_SEQUENCE_CODEC_POINT_CLOUD_SEQUENCE);
+  ExpectFrames(*reader, 4);
+  ASSERT_EQ(reader->metadata_size(), 2);
+  EXPECT_EQ(std::string(reader->metadata(), 2), "{}");
+  EXPECT_EQ(reader->FindFrame(-1), 0);
+  EXPECT_EQ(reader->FindFrame(1999), 1);
+  EXPECT_EQ(reader->FindFrame(100000), 3);
+  EXPECT_FALSE(reader->GetFrame(4).ok());
+}
+
+TEST_F(FrameSequenceTest, TestUnfinalizedFile) {
+  // Frames of a recording that was interrupted are recovered from the chunks.
+  auto writer_or = FrameSequenceWriter::Create(file_name_, 30.0);
+  ASSERT_TRUE(writer_or.ok());
+  std::unique_ptr<FrameSequenceWriter> writer = std::move(writer_or).value();
+  WriteFrames(writer.get(), 0, 3);
+  ASSERT_TRUE(writer->Flush().ok());
+  const std::vector<char> data = ReadFile();
+  ASSERT_TRUE(writer->Finalize().ok());
+
+  auto reader_or =
+      FrameSequenceReader::OpenFromMemory(data.data(), data.size());
+  ASSERT_TRUE(reader_or.ok());
+  EXPECT_FALSE(reader_or.value()->is_finalized());
+  ExpectFrames(*reader_or.value(), 3);
+}
+
+TEST_F(FrameSequenceTest, TestAppend) {
+  {
+    auto writer_or = FrameSequenceWriter::Create(file_name_, 30.0);
+    ASSERT_TRUE(writer_or.ok());
+    WriteFrames(writer_or.value().get(), 0, 2);
+    writer_or.value()->SetMetadata("meta", 4);
+    ASSERT_TRUE(writer_or.value()->Finalize().ok());
+  }
+  auto writer_or = FrameSequenceWriter::OpenForAppend(file_name_);
+  ASSERT_TRUE(writer_or.ok());
+  std::unique_ptr<FrameSequenceWriter> writer = std::move(writer_or).value();
+  WriteFrames(writer.get(), 2, 3);
+  ASSERT_TRUE(writer->Flush().ok());
+  {
+    // While appending, the old metadata and index are gone and the file
+    // reads as an unfinalized recording.
+    const std::vector<char> data = ReadFile();
+    auto reader_or =
+        FrameSequenceReader::OpenFromMemory(data.data(), data.size());
+    ASSERT_TRUE(reader_or.ok());
+    EXPECT_FALSE(reader_or.value()->is_finalized());
+    EXPECT_EQ(reader_or.value()->metadata(), nullptr);
+    ExpectFrames(*reader_or.value(), 3);
+  }
+  WriteFrames(writer.get(), 3, 4);
+  ASSERT_TRUE(writer->Finalize().ok());
+
+  auto reader_or = FrameSequenceReader::Open(file_name_);
+  ASSERT_TRUE(reader_or.ok());
+  EXPECT_TRUE(reader_or.value()->is_finalized());
+  ExpectFrames(*reader_or.value(), 4);
+  ASSERT_EQ(reader_or.value()->metadata_size(), 4);
+  EXPECT_EQ(std::string(reader_or.value()->metadata(), 4), "meta");
+  EXPECT_EQ(reader_or.value()->header().num_frames, 4);
+}
+
+TEST_F(FrameSequenceTest, TestTruncatedFile) {
+  auto writer_or = FrameSequenceWriter::Create(file_name_, 30.0);
+  ASSERT_TRUE(writer_or.ok());
+  WriteFrames(writer_or.value().get(), 0, 4);
+  ASSERT_TRUE(writer_or.value()->Finalize().ok());
+  const std::vector<char> data = ReadFile();
+
+  for (size_t size = 0; size < data.size(); ++size) {
+    auto reader_or = FrameSequenceReader::OpenFromMemory(data.data(), size);
+    if (size < sizeof(FrameSequenceFileHeader)) {
+      EXPECT_FALSE(reader_or.ok());
+      continue;
+    }
+    // Unless the index is still complete, only the complete frames are
+    // recovered.
+    ASSERT_TRUE(reader_or.ok());
+    const FrameSequenceReader &reader = *reader_or.value();
+    ASSERT_LE(reader.num_frames(), 4);
+    if (reader.is_finalized()) {
+      EXPECT_EQ(reader.num_frames(), 4);
+    }
+    for (size_t i = 0; i < reader.num_frames(); ++i) {
+      const FrameSequenceFrame frame = reader.GetFrame(i).value();
+      ASSERT_LE(frame.data + frame.size, data.data() + size);
+      EXPECT_EQ(std::string(frame.data, frame.size), frames_[i]);
+    }
+  }
+}
+
+TEST_F(FrameSequenceTest, TestCorruptedFile) {
+  auto writer_or = FrameSequenceWriter::Create(file_name_, 30.0);
+  ASSERT_TRUE(writer_or.ok());
+  WriteFrames(writer_or.value().get(), 0, 4);
+  ASSERT_TRUE(writer_or.value()->Finalize().ok());
+  const std::vector<char> data = ReadFile();
+
+  std::vector<char> corrupted = data;
+  corrupted[0] = 'X';
+  EXPECT_FALSE(
+      FrameSequenceReader::OpenFromMemory(corrupted.data(), corrupted.size())
+          .ok());
+
+  corrupted = data;
+  FrameSequenceFileHeader header;
+  memcpy(&header, data.data(), sizeof(header));
+  header.major_version = kFrameSequenceMajorVersion + 1;
+  memcpy(corrupted.data(), &header, sizeof(header));
+  auto reader_or =
+      FrameSequenceReader::OpenFromMemory(corrupted.data(), corrupted.size());
+  ASSERT_FALSE(reader_or.ok());
+  EXPECT_EQ(reader_or.status().code(), Status::UNKNOWN_VERSION);
+
+  // Flipping any byte after the header must not produce frames outside of
+  // the data.
+  for (size_t i = sizeof(FrameSequenceFileHeader); i < data.size(); ++i) {
+    corrupted = data;
+    corrupted[i] ^= 0x5a;
+    auto corrupted_reader_or =
+        FrameSequenceReader::OpenFromMemory(corrupted.data(), corrupted.size());
+    if (!corrupted_reader_or.ok()) {
+      continue;
+    }
+    const FrameSequenceReader &reader = *corrupted_reader_or.value();
+    for (size_t j = 0; j < reader.num_frames(); ++j) {
+      const FrameSequenceFrame frame = reader.GetFrame(j).value();
+      ASSERT_GE(frame.data, corrupted.data());
+      ASSERT_LE(frame.data + frame.size,
+                corrupted.data() + corrupted.size());
+    }
+  }
+}
+
+TEST_F(FrameSequenceTest, TestFileWithoutCodec) {
+  // Files written before the codec was stored have zeros in its place.
+  auto writer_or = FrameSequenceWriter::Create(
+      file_name_, 30.0, FRAME_SEQUENCE_CODEC_POINT_CLOUD_SEQUENCE);
+  ASSERT_TRUE(writer_or.ok());
+  WriteFrames(writer_or.value().get(), 0, 2);
+  ASSERT_TRUE(writer_or.value()->Finalize().ok());
+  std::vector<char> data = ReadFile();
+  FrameSequenceFileHeader header;
+  memcpy(&header, data.data(), sizeof(header));
+  header.codec = 0;
+  memcpy(data.data(), &header, sizeof(header));
+
+  auto reader_or =
+      FrameSequenceReader::OpenFromMemory(data.data(), data.size());
+  ASSERT_TRUE(reader_or.ok());
+  EXPECT_EQ(reader_or.value()->codec(), FRAME_SEQUENCE_CODEC_DRACO);
+  ExpectFrames(*reader_or.value(), 2);
+}
+
+}  // namespace draco
@@ -0,0 +1,213 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "io/frame_sequence_writer.h"
+
+#include "io/frame_sequence_reader.h"
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace draco {
+
+namespace {
+
+// Flushes |file| and cuts it to |size| bytes.
+bool TruncateFile(FILE *file, uint64_t size) {
+  if (fflush(file) != 0) {
+    return false;
+  }
+#if defined(_WIN32)
+  return _chsize_s(_fileno(file), static_cast<__int64>(size)) == 0;
+#else
+  return ftruncate(fileno(file), static_cast<off_t>(size)) == 0;
+#endif
+}
+
+}  // namespace
+
+FrameSequenceWriter::FrameSequenceWriter()
+    : file_(nullptr), offset_(0), header_() {}
+
+FrameSequenceWriter::~FrameSequenceWriter() {
+  if (file_ != nullptr) {
+    Finalize();
+  }
+}
+
+StatusOr<std::unique_ptr<FrameSequenceWriter>> FrameSequenceWriter::Create(
+    const std::string &file_name, double frame_rate, FrameSequenceCodec codec) {
+  std::unique_ptr<FrameSequenceWriter> writer(new FrameSequenceWriter());
+  writer->file_ = fopen(file_name.c_str(), "wb");
+  if (writer->file_ == nullptr) {
+    return Status(Status::IO_ERROR, "Unable to create the file.");
+  }
+  FrameSequenceFileHeader &header = writer->header_;
+  memcpy(header.magic, kFrameSequenceMagic, sizeof(header.magic));
+  header.major_version = kFrameSequenceMajorVersion;
+  header.minor_version = kFrameSequenceMinorVersion;
+  header.header_size = sizeof(FrameSequenceFileHeader);
+  header.frame_rate = frame_rate;
+  header.codec = codec;
+  DRACO_RETURN_IF_ERROR(writer->Write(&header, sizeof(header)));
+  // Make sure the file can be opened by readers while it is being recorded.
+  DRACO_RETURN_IF_ERROR(writer->Flush());
+  return writer;
+}
+
+StatusOr<std::unique_ptr<FrameSequenceWriter>>
+FrameSequenceWriter::OpenForAppend(const std::string &file_name) {
+  std::unique_ptr<FrameSequenceWriter> writer(new FrameSequenceWriter());
+  uint64_t append_offset = 0;
+  {
+    // The existing content is read through a temporary mapping that is
+    // released before the file is modified.
+    DRACO_ASSIGN_OR_RETURN(std::unique_ptr<FrameSequenceReader> reader,
+                           FrameSequenceReader::Open(file_name));
+    writer->header_ = reader->header();
+    writer->index_.reserve(reader->num_frames());
+    for (size_t i = 0; i < reader->num_frames(); ++i) {
+      writer->index_.push_back(reader->GetIndexEntry(i));
+    }
+    if (reader->metadata() != nullptr) {
+      writer->SetMetadata(reader->metadata(), reader->metadata_size());
+    }
+    append_offset = reader->frames_end_offset();
+  }
+  writer->file_ = fopen(file_name.c_str(), "r+b");
+  if (writer->file_ == nullptr) {
+    return Status(Status::IO_ERROR, "Unable to open the file.");
+  }
+  // The old metadata, index and trailer are going to be overwritten by new
+  // frames. Mark the file as not finalized and drop everything after the last
+  // frame so that an interrupted append never leaves a stale trailer behind.
+  // The metadata is written again by Finalize().
+  writer->header_.index_offset = 0;
+  writer->header_.num_frames = 0;
+  writer->header_.metadata_offset = 0;
+  writer->header_.metadata_size = 0;
+  if (fwrite(&writer->header_, sizeof(writer->header_), 1, writer->file_) !=
+          1 ||
+      !TruncateFile(writer->file_, append_offset) ||
+      fseek(writer->file_, static_cast<long>(append_offset), SEEK_SET) != 0) {
+    return Status(Status::IO_ERROR, "Unable to prepare the file.");
+  }
+  writer->offset_ = append_offset;
+  return writer;
+}
+
+Status FrameSequenceWriter::AppendFrame(const char *data, size_t size,
+                                        int64_t timestamp_us,
+                                        uint32_t flags) {
+  if (file_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "The writer was finalized.");
+  }
+  FrameSequenceIndexEntry entry;
+  entry.offset = offset_ + sizeof(FrameSequenceChunkHeader);
+  entry.size = size;
+  entry.timestamp_us = timestamp_us;
+  entry.flags = flags;
+  entry.reserved = 0;
+  DRACO_RETURN_IF_ERROR(WriteChunk(FRAME_SEQUENCE_CHUNK_FRAME, flags,
+                                   timestamp_us, data, size));
+  index_.push_back(entry);
+  return OkStatus();
+}
+
+Status FrameSequenceWriter::Flush() {
+  if (file_ == nullptr || fflush(file_) != 0) {
+    return Status(Status::IO_ERROR, "Unable to flush the file.");
+  }
+  return OkStatus();
+}
+
+Status FrameSequenceWriter::Finalize() {
+  if (file_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "The writer was already finalized.");
+  }
+  Status status = OkStatus();
+  header_.metadata_offset = 0;
+  header_.metadata_size = 0;
+  if (!metadata_.empty()) {
+    header_.metadata_offset = offset_ + sizeof(FrameSequenceChunkHeader);
+    header_.metadata_size = metadata_.size();
+    status = WriteChunk(FRAME_SEQUENCE_CHUNK_METADATA, 0, 0, metadata_.data(),
+                        metadata_.size());
+  }
+  const uint64_t index_offset = offset_;
+  if (status.ok()) {
+    status = WriteChunk(FRAME_SEQUENCE_CHUNK_INDEX, 0, 0,
+                        reinterpret_cast<const char *>(index_.data()),
+                        index_.size() * sizeof(FrameSequenceIndexEntry));
+  }
+  if (status.ok()) {
+    FrameSequenceTrailer trailer;
+    trailer.index_offset = index_offset;
+    memcpy(trailer.magic, kFrameSequenceTrailerMagic, sizeof(trailer.magic));
+    status = Write(&trailer, sizeof(trailer));
+  }
+  if (status.ok()) {
+    // Drop any leftovers of a previous index when frames were appended to an
+    // existing file.
+    if (!TruncateFile(file_, offset_)) {
+      status = Status(Status::IO_ERROR, "Unable to truncate the file.");
+    }
+  }
+  if (status.ok()) {
+    header_.index_offset = index_offset;
+    header_.num_frames = index_.size();
+    if (fseek(file_, 0, SEEK_SET) != 0 ||
+        fwrite(&header_, sizeof(header_), 1, file_) != 1) {
+      status = Status(Status::IO_ERROR, "Unable to update the file header.");
+    }
+  }
+  if (fclose(file_) != 0 && status.ok()) {
+    status = Status(Status::IO_ERROR, "Unable to close the file.");
+  }
+  file_ = nullptr;
+  return status;
+}
+
+Status FrameSequenceWriter::WriteChunk(uint32_t type, uint32_t flags,
+                                       int64_t timestamp_us, const char *data,
+                                       uint64_t size) {
+  FrameSequenceChunkHeader chunk;
+  chunk.type = type;
+  chunk.flags = flags;
+  chunk.timestamp_us = timestamp_us;
+  chunk.payload_size = size;
+  DRACO_RETURN_IF_ERROR(Write(&chunk, sizeof(chunk)));
+  if (size > 0) {
+    DRACO_RETURN_IF_ERROR(Write(data, size));
+  }
+  const uint8_t padding[8] = {0};
+  const uint64_t padding_size = FrameSequencePadding(size);
+  if (padding_size > 0) {
+    DRACO_RETURN_IF_ERROR(Write(padding, padding_size));
+  }
+  return OkStatus();
+}
+
+Status FrameSequenceWriter::Write(const void *data, size_t size) {
+  if (fwrite(data, 1, size, file_) != size) {
+    return Status(Status::IO_ERROR, "Unable to write to the file.");
+  }
+  offset_ += size;
+  return OkStatus();
+}
+
+}  // namespace draco
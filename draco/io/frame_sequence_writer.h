@@ -0,0 +1,102 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_FRAME_SEQUENCE_WRITER_H_
+#define DRACO_IO_FRAME_SEQUENCE_WRITER_H_
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/status.h"
+#include "core/status_or.h"
+#include "io/frame_sequence_format.h"
+
+namespace draco {
+
+// Writer of the single-file frame sequence container described in
+// frame_sequence_format.h. Frames are appended to the end of the file as they
+// arrive, the index is written by Finalize(). A file that was not finalized
+// can still be read, and it can be re-opened to append more frames.
+//
+// Usage:
+//   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<FrameSequenceWriter> writer,
+//                          FrameSequenceWriter::Create(file_name, 25.0));
+//   for (each frame) {
+//     DRACO_RETURN_IF_ERROR(writer->AppendFrame(
+//         buffer.data(), buffer.size(), timestamp_us));
+//   }
+//   DRACO_RETURN_IF_ERROR(writer->Finalize());
+class FrameSequenceWriter {
+ public:
+  // Creates a new file at |file_name|, replacing any existing file.
+  // |frame_rate| is the nominal frame rate of the sequence (0 if unknown).
+  // |codec| is the FrameSequenceCodec of the appended frames.
+  static StatusOr<std::unique_ptr<FrameSequenceWriter>> Create(
+      const std::string &file_name, double frame_rate,
+      FrameSequenceCodec codec = FRAME_SEQUENCE_CODEC_DRACO);
+
+  // Opens an existing file for appending more frames. Existing frames and
+  // metadata are kept, the index is rewritten by Finalize().
+  static StatusOr<std::unique_ptr<FrameSequenceWriter>> OpenForAppend(
+      const std::string &file_name);
+
+  FrameSequenceWriter(const FrameSequenceWriter &) = delete;
+  FrameSequenceWriter &operator=(const FrameSequenceWriter &) = delete;
+
+  // Finalizes the file if Finalize() was not called.
+  ~FrameSequenceWriter();
+
+  // Appends an encoded frame with a presentation time of |timestamp_us|
+  // microseconds.
+  Status AppendFrame(const char *data, size_t size, int64_t timestamp_us,
+                     uint32_t flags = FRAME_SEQUENCE_FLAG_KEYFRAME);
+
+  // Sets the metadata stored with the sequence. The metadata is written by
+  // Finalize().
+  void SetMetadata(const char *data, size_t size) {
+    metadata_.assign(data, data + size);
+  }
+
+  // Flushes all appended frames to the file.
+  Status Flush();
+
+  // Writes the metadata and the index and closes the file. No more frames can
+  // be appended afterwards.
+  Status Finalize();
+
+  size_t num_frames() const { return index_.size(); }
+
+  // Current size of the file in bytes.
+  uint64_t file_size() const { return offset_; }
+
+ private:
+  FrameSequenceWriter();
+
+  // Writes a chunk at the current offset.
+  Status WriteChunk(uint32_t type, uint32_t flags, int64_t timestamp_us,
+                    const char *data, uint64_t size);
+  Status Write(const void *data, size_t size);
+
+  FILE *file_;
+  uint64_t offset_;
+  FrameSequenceFileHeader header_;
+  std::vector<FrameSequenceIndexEntry> index_;
+  std::vector<char> metadata_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_FRAME_SEQUENCE_WRITER_H_
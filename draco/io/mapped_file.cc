@@ -0,0 +1,96 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "io/mapped_file.h"
+
+#include <cstdio>
+
+#if defined(_WIN32)
+#define DRACO_MAPPED_FILE_USE_STDIO
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace draco {
+
+MappedFile::MappedFile()
+    : data_(nullptr), size_(0), mapping_(nullptr), mapping_size_(0) {}
+
+MappedFile::~MappedFile() {
+#ifndef DRACO_MAPPED_FILE_USE_STDIO
+  if (mapping_ != nullptr) {
+    munmap(mapping_, mapping_size_);
+  }
+#endif
+}
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string &file_name) {
+  std::unique_ptr<MappedFile> file(new MappedFile());
+#ifndef DRACO_MAPPED_FILE_USE_STDIO
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    return nullptr;
+  }
+  const size_t file_size = static_cast<size_t>(file_stat.st_size);
+  if (file_size > 0) {
+    void *const mapping =
+        mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      close(fd);
+      return nullptr;
+    }
+    file->mapping_ = mapping;
+    file->mapping_size_ = file_size;
+    file->data_ = static_cast<const char *>(mapping);
+    file->size_ = file_size;
+  }
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
+#else
+  FILE *const fp = fopen(file_name.c_str(), "rb");
+  if (fp == nullptr) {
+    return nullptr;
+  }
+  if (fseek(fp, 0, SEEK_END) != 0) {
+    fclose(fp);
+    return nullptr;
+  }
+  const long file_size = ftell(fp);
+  if (file_size < 0 || fseek(fp, 0, SEEK_SET) != 0) {
+    fclose(fp);
+    return nullptr;
+  }
+  file->buffer_.resize(file_size);
+  if (file_size > 0 &&
+      fread(file->buffer_.data(), 1, file_size, fp) !=
+          static_cast<size_t>(file_size)) {
+    fclose(fp);
+    return nullptr;
+  }
+  fclose(fp);
+  file->data_ = file->buffer_.data();
+  file->size_ = file->buffer_.size();
+#endif
+  return file;
+}
+
+}  // namespace draco
@@ -0,0 +1,55 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_MAPPED_FILE_H_
+#define DRACO_IO_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace draco {
+
+// Read-only view of the whole content of a file. On POSIX systems the file is
+// memory-mapped so that its content is paged in on demand and not read into
+// heap memory.
+// On other systems the content is read into memory.
+class MappedFile {
+ public:
+  // Maps the file at |file_name|. Returns nullptr on error.
+  static std::unique_ptr<MappedFile> Open(const std::string &file_name);
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile();
+
+  const char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  MappedFile();
+
+  const char *data_;
+  size_t size_;
+  // Address and length passed to munmap(), unused when the file is read.
+  void *mapping_;
+  size_t mapping_size_;
+  // Storage used when the file can't be mapped.
+  std::vector<char> buffer_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_MAPPED_FILE_H_
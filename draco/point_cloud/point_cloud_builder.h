@@ -16,6 +16,7 @@
 #define DRACO_POINT_CLOUD_POINT_CLOUD_BUILDER_H_
 
 #include <utility>
+#include <vector>
 
 #include "point_cloud/point_cloud.h"
 
@@ -67,6 +68,37 @@ class PointCloudBuilder {
   void SetAttributeValuesForAllPoints(int att_id, const void *attribute_values,
                                       int stride);
 
+  // Same as above but all values are copied in bulk. |stride| may be larger
+  // than the attribute entry (e.g. 16 for simd_float3 positions), any padding
+  // is skipped. Returns false on invalid input.
+  bool SetAttributeValuesForAllPointsBulk(int att_id,
+                                          const void *attribute_values,
+                                          int stride) {
+    return point_cloud_->attribute(att_id)->SetValuesFromInterleavedData(
+        attribute_values, stride, point_cloud_->num_points());
+  }
+
+  // Sets attribute values for all points from planar (SoA) input where
+  // |component_planes[c]| holds the c-th component of all points.
+  bool SetAttributeValuesForAllPointsFromPlanes(
+      int att_id, const void *const *component_planes) {
+    return point_cloud_->attribute(att_id)->SetValuesFromPlanarData(
+        component_planes, point_cloud_->num_points());
+  }
+
+  // Moves tightly packed |attribute_values| of all points into the attribute
+  // without copying them.
+  bool AdoptAttributeValuesForAllPoints(
+      int att_id, std::vector<uint8_t> &&attribute_values) {
+    PointAttribute *const att = point_cloud_->attribute(att_id);
+    const size_t entry_size =
+        DataTypeLength(att->data_type()) * att->num_components();
+    if (attribute_values.size() != entry_size * point_cloud_->num_points()) {
+      return false;
+    }
+    return att->AdoptValues(std::move(attribute_values));
+  }
+
   // Sets the unique ID for an attribute created with AddAttribute().
   void SetAttributeUniqueId(int att_id, uint32_t unique_id);
 
@@ -9,71 +9,71 @@ class DracoService {
     // MARK: - Point Cloud Loading
     func loadDracoPointCloudFromFile(url: URL) -> [SIMD3<Float>]? {
         do {
-            // Read the file data
-            let dracoData = try Data(contentsOf: url)
+            // Map the file instead of reading it into memory, the decoder
+            // still builds a new point cloud from the mapped data
+            let dracoData = try Data(contentsOf: url, options: .mappedIfSafe)
             
-            // Create decoder
-            let decoder = DracoDecoder()
-            
-            // Check if this is a valid point cloud
-            let geometryType = DracoDecoder.getEncodedGeometryType(dracoData)
-            guard geometryType == .pointCloud else {
-                print("File does not contain a valid Draco point cloud")
-                return nil
-            }
-            
-            // Decode the point cloud
-            guard let pointCloud = decoder.decodePointCloud(from: dracoData) else {
-                print("Failed to decode Draco point cloud")
-                return nil
-            }
-            
-            // Get the number of points
-            let numPoints = pointCloud.numPoints()
-            guard numPoints > 0 else {
-                print("Point cloud contains no points")
-                return nil
-            }
-            
-            // Get the bounding box to verify we have data
-            let boundingBox = pointCloud.computeBoundingBox()
-            print("Point cloud bounding box: \(boundingBox)")
-            
-            // Get the position data from the point cloud
-            guard let positionData = pointCloud.getPositionData() else {
-                print("Failed to extract position data from point cloud")
-                return nil
-            }
-            
-            // Convert the raw float data to an array of SIMD3<Float>
-            let floatValues = positionData.withUnsafeBytes { rawBuffer -> [Float] in
-                guard let floatBuffer = rawBuffer.baseAddress?.assumingMemoryBound(to: Float.self) else {
-                    return []
-                }
-                return Array(UnsafeBufferPointer(start: floatBuffer, count: positionData.count / MemoryLayout<Float>.size))
-            }
-            
-            // Create SIMD3<Float> points from the float array
-            var points: [SIMD3<Float>] = []
-            points.reserveCapacity(numPoints)
-            
-            for i in stride(from: 0, to: floatValues.count, by: 3) {
-                if i + 2 < floatValues.count {
-                    let point = SIMD3<Float>(floatValues[i], floatValues[i+1], floatValues[i+2])
-                    points.append(point)
-                }
-            }
-            
-            print("Successfully loaded \(points.count) points from Draco file")
-            return points
+            return decodePointCloudPositions(from: dracoData, decoder: DracoDecoder())
         } catch {
             print("Error loading Draco file: \(error)")
             return nil
         }
     }
     
+    // Decode the positions of an encoded Draco point cloud
+    func decodePointCloudPositions(from dracoData: Data, decoder: DracoDecoder) -> [SIMD3<Float>]? {
+        // Check if this is a valid point cloud
+        let geometryType = DracoDecoder.getEncodedGeometryType(dracoData)
+        guard geometryType == .pointCloud else {
+            print("File does not contain a valid Draco point cloud")
+            return nil
+        }
+        
+        // Decode the point cloud
+        guard let pointCloud = decoder.decodePointCloud(from: dracoData) else {
+            print("Failed to decode Draco point cloud")
+            return nil
+        }
+        
+        // Get the number of points
+        let numPoints = pointCloud.numPoints()
+        guard numPoints > 0 else {
+            print("Point cloud contains no points")
+            return nil
+        }
+        
+        // Get the bounding box to verify we have data
+        let boundingBox = pointCloud.computeBoundingBox()
+        print("Point cloud bounding box: \(boundingBox)")
+        
+        // Copy the positions straight into the SIMD3<Float> array
+        let points = [SIMD3<Float>](unsafeUninitializedCapacity: numPoints) { buffer, initializedCount in
+            guard let baseAddress = buffer.baseAddress else {
+                initializedCount = 0
+                return
+            }
+            let copied = pointCloud.copyPositions(to: baseAddress,
+                                                  capacity: numPoints,
+                                                  byteStride: MemoryLayout<SIMD3<Float>>.stride)
+            initializedCount = max(copied, 0)
+        }
+        guard points.count == numPoints else {
+            print("Failed to extract position data from point cloud")
+            return nil
+        }
+        
+        print("Successfully loaded \(points.count) points from Draco file")
+        return points
+    }
+    
     // MARK: - PLY Video Bundle Loading
     func loadDracoPLYVideoBundle(from bundleURL: URL, completion: @escaping ([[SIMD3<Float>]]?) -> Void) {
+        // Recordings are stored as a single sequence file, older ones as a directory of frames
+        if bundleURL.pathExtension == "drcseq" {
+            loadDracoSequence(from: bundleURL, completion: completion)
+            return
+        }
+        
         DispatchQueue.global(qos: .userInitiated).async {
             do {
                 print("Loading Draco PLY video from: \(bundleURL.path)")
@@ -180,22 +180,12 @@ class DracoService {
             // 3 components (x,y,z), not normalized
             let positionAttId = pointCloud.addAttribute(withType: 0, dataType: 9, numComponents: 3, normalized: false)
             
-            // Convert our SIMD3<Float> array to raw data
-            // We need to pack the data as a continuous array of floats: [x1,y1,z1,x2,y2,z2,...]
-            var floatArray = [Float]()
-            floatArray.reserveCapacity(points.count * 3)
-            
-            for point in points {
-                floatArray.append(point.x)
-                floatArray.append(point.y)
-                floatArray.append(point.z)
+            // Hand the SIMD3<Float> storage to Draco directly, the stride skips the padding
+            let didSetData = points.withUnsafeBytes { rawBuffer -> Bool in
+                guard let baseAddress = rawBuffer.baseAddress else { return false }
+                return pointCloud.setFloatAttributeData(positionAttId, bytes: baseAddress, count: points.count, byteStride: MemoryLayout<SIMD3<Float>>.stride)
             }
-            
-            // Convert to NSData
-            let pointData = NSData(bytes: floatArray, length: floatArray.count * MemoryLayout<Float>.size)
-            
-            // Set the attribute values using our simplified method
-            if !pointCloud.setFloatAttributeData(positionAttId, data: pointData as Data) {
+            if !didSetData {
                 print("Failed to set point data")
                 return
             }
@@ -242,4 +232,90 @@ class DracoService {
             }
         }
     }
+    
+    // MARK: - Sequence File Loading
+    func loadDracoSequence(from url: URL, completion: @escaping ([[SIMD3<Float>]]?) -> Void) {
+        DispatchQueue.global(qos: .userInitiated).async {
+            print("Loading Draco sequence from: \(url.path)")
+            
+            // The file is memory-mapped, frames are decoded straight from the mapping
+            guard let reader = DracoFrameSequenceReader(path: url.path) else {
+                DispatchQueue.main.async {
+                    completion(nil)
+                }
+                return
+            }
+            
+            let decoder = DracoDecoder()
+            let sequenceDecoder = DracoSequenceDecoder()
+            let temporal = reader.codec() == .sequence
+            var frames: [[SIMD3<Float>]] = []
+            frames.reserveCapacity(reader.numFrames())
+            for index in 0..<reader.numFrames() {
+                guard let frameData = reader.frameData(at: index) else { continue }
+                let points = temporal
+                    ? self.decodeSequenceFramePositions(from: frameData, decoder: sequenceDecoder)
+                    : self.decodePointCloudPositions(from: frameData, decoder: decoder)
+                if let points = points {
+                    frames.append(points)
+                } else {
+                    print("  - Failed to load frame \(index)")
+                }
+            }
+            
+            print("Successfully loaded \(frames.count) of \(reader.numFrames()) frames")
+            DispatchQueue.main.async {
+                completion(frames.isEmpty ? nil : frames)
+            }
+        }
+    }
+    
+    // Decode the next frame of a temporally coded sequence
+    // Frames must be passed in order since each frame depends on the previous one
+    func decodeSequenceFramePositions(from frameData: Data, decoder: DracoSequenceDecoder) -> [SIMD3<Float>]? {
+        guard decoder.decodeFrame(frameData) else {
+            // Predicted frames can't be decoded until the next key frame
+            decoder.reset()
+            return nil
+        }
+        
+        let numPoints = decoder.numPoints()
+        return [SIMD3<Float>](unsafeUninitializedCapacity: numPoints) { buffer, initializedCount in
+            guard let baseAddress = buffer.baseAddress else {
+                initializedCount = 0
+                return
+            }
+            initializedCount = decoder.copyPositions(to: baseAddress,
+                                                     capacity: numPoints,
+                                                     byteStride: MemoryLayout<SIMD3<Float>>.stride)
+        }
+    }
+    
+    // Positions of a frame decoded by a sequence player
+    // Returns nil if the frame is not decoded within timeout seconds
+    func sequencePlayerFramePositions(from player: DracoSequencePlayer, at index: Int, timeout: TimeInterval) -> [SIMD3<Float>]? {
+        let numPoints = player.numPoints(ofFrame: index, timeout: timeout)
+        guard numPoints >= 0 else {
+            return nil
+        }
+        
+        return [SIMD3<Float>](unsafeUninitializedCapacity: numPoints) { buffer, initializedCount in
+            guard let baseAddress = buffer.baseAddress else {
+                initializedCount = 0
+                return
+            }
+            initializedCount = player.copyPositions(ofFrame: index,
+                                                    to: baseAddress,
+                                                    capacity: numPoints,
+                                                    byteStride: MemoryLayout<SIMD3<Float>>.stride)
+        }
+    }
+    
+    // Nominal frame rate of a sequence file, nil if unknown
+    func frameRateOfDracoSequence(at url: URL) -> Double? {
+        guard let reader = DracoFrameSequenceReader(path: url.path), reader.frameRate() > 0 else {
+            return nil
+        }
+        return reader.frameRate()
+    }
 } 
\ No newline at end of file
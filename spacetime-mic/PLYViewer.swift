@@ -21,6 +21,12 @@ extension UTType {
         UTType(exportedAs: "com.spacetime-mic.drcpack", 
                conformingTo: .package)
     }
+    
+    static var drcSequence: UTType {
+        // Register a type for single-file Draco point cloud sequences
+        UTType(exportedAs: "com.spacetime-mic.drcseq", 
+               conformingTo: .data)
+    }
 }
 
 struct PLYViewer: View {
@@ -39,6 +45,7 @@ struct PLYViewer: View {
     @State private var showPLYVideoOptions = false
     @State private var showDracoFileOptions = false
     @State private var isDracoEncodedVideo = false
+    @State private var sequencePlayer: DracoSequencePlayer?
     
     var body: some View {
         ZStack {
@@ -57,7 +64,7 @@ struct PLYViewer: View {
                                 .clipShape(Circle())
                         }
                         
-                        Text("Playing: Frame \(currentFrameIndex + 1) of \(plyVideoFrames.count)\(isDracoEncodedVideo ? " (Draco)" : "")")
+                        Text("Playing: Frame \(currentFrameIndex + 1) of \(sequencePlayer?.numFrames() ?? plyVideoFrames.count)\(isDracoEncodedVideo ? " (Draco)" : "")")
                             .foregroundColor(.white)
                             .padding()
                             .background(Color.black.opacity(0.6))
@@ -108,14 +115,14 @@ struct PLYViewer: View {
             }
         }
         .sheet(isPresented: $showVideoFilePicker) {
-            DocumentPicker(contentTypes: [.drcPlyVideo]) { url in
+            DocumentPicker(contentTypes: [.drcSequence, .drcPlyVideo]) { url in
                 loadDracoPLYVideo(from: url)
             }
         }
     }
     
     private func loadPLYFile(from url: URL) {
-        if url.pathExtension == "drcpack" {
+        if url.pathExtension == "drcpack" || url.pathExtension == "drcseq" {
             loadDracoPLYVideo(from: url)
         } else {
             do {
@@ -258,11 +265,46 @@ struct PLYViewer: View {
         }
     }
     
+    private func startSequencePlayback(player: DracoSequencePlayer) {
+        sequencePlayer = player
+        plyVideoFrames = []
+        isDracoEncodedVideo = true
+        
+        // Only the first frame is waited for, the following ones are decoded during playback
+        currentFrameIndex = 0
+        selectedPoints = DracoService.shared.sequencePlayerFramePositions(from: player, at: 0, timeout: 1.0)
+        isPlayingPLYVideo = true
+        
+        let frameRate = player.frameRate() > 0 ? player.frameRate() : 1.0
+        videoPlaybackTimer = Timer.scheduledTimer(withTimeInterval: 1.0 / frameRate, repeats: true) { _ in
+            self.advanceToNextSequenceFrame()
+        }
+    }
+    
+    private func advanceToNextSequenceFrame() {
+        guard let player = sequencePlayer else { return }
+        
+        let nextFrameIndex = currentFrameIndex + 1
+        if nextFrameIndex >= player.numFrames() {
+            stopPLYVideoPlayback()
+            return
+        }
+        
+        // Keep showing the current frame until the next one is decoded
+        guard let points = DracoService.shared.sequencePlayerFramePositions(from: player, at: nextFrameIndex, timeout: 0) else {
+            print("Frame \(nextFrameIndex) is not decoded yet")
+            return
+        }
+        currentFrameIndex = nextFrameIndex
+        selectedPoints = points
+    }
+    
     private func stopPLYVideoPlayback() {
         videoPlaybackTimer?.invalidate()
         videoPlaybackTimer = nil
         isPlayingPLYVideo = false
         isDracoEncodedVideo = false
+        sequencePlayer = nil
     }
     
     // Function to show the picker for Draco files
@@ -425,6 +467,8 @@ struct PLYViewer: View {
                     
                     if isDirectory && isPackage && url.pathExtension == "drcpack" {
                         dracoPLYVideoPaths.append(url)
+                    } else if !isDirectory && url.pathExtension == "drcseq" {
+                        dracoPLYVideoPaths.append(url)
                     }
                 }
                 
@@ -494,6 +538,18 @@ struct PLYViewer: View {
     private func loadDracoPLYVideo(from url: URL) {
         print("Loading Draco PLY video from: \(url.path)")
         
+        // Sequence files are streamed, frames are decoded ahead of the playhead
+        if url.pathExtension == "drcseq" {
+            guard let player = DracoSequencePlayer(path: url.path, workers: 2, ringSize: 8, loop: false),
+                  player.numFrames() > 0 else {
+                showAlert(title: "Error",
+                          message: "Failed to load Draco PLY video from \(url.lastPathComponent)")
+                return
+            }
+            startSequencePlayback(player: player)
+            return
+        }
+        
         // Use DracoService to load the video bundle
         DracoService.shared.loadDracoPLYVideoBundle(from: url) { frames in
             if let frames = frames, !frames.isEmpty {
@@ -501,12 +557,14 @@ struct PLYViewer: View {
                 self.plyVideoFrames = frames
                 self.isDracoEncodedVideo = true
                 
-                // Find metadata file to get frame rate
+                // Sequence files store the frame rate, older bundles keep it in a metadata file
                 let metadataURL = url.appendingPathComponent("metadata.json")
                 var frameRate: Double = 1.0
                 
                 // Safely read metadata without throwing
-                if let metadataData = try? Data(contentsOf: metadataURL),
+                if let rate = DracoService.shared.frameRateOfDracoSequence(at: url) {
+                    frameRate = rate
+                } else if let metadataData = try? Data(contentsOf: metadataURL),
                    let metadata = try? JSONSerialization.jsonObject(with: metadataData) as? [String: Any],
                    let rate = metadata["frameRate"] as? Double {
                     frameRate = rate
@@ -695,7 +753,7 @@ struct DocumentPicker: UIViewControllerRepresentable {
     let contentTypes: [UTType]
     let onPick: (URL) -> Void
     
-    init(contentTypes: [UTType] = [.ply, .drcPlyVideo], onPick: @escaping (URL) -> Void) {
+    init(contentTypes: [UTType] = [.ply, .drcSequence, .drcPlyVideo], onPick: @escaping (URL) -> Void) {
         self.contentTypes = contentTypes
         self.onPick = onPick
     }
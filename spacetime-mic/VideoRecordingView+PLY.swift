@@ -64,22 +64,12 @@ extension VideoRecordingView {
             // 3 components (x,y,z), not normalized
             let positionAttId = pointCloud.addAttribute(withType: 0, dataType: 9, numComponents: 3, normalized: false)
             
-            // Convert our SIMD3<Float> array to raw data
-            // We need to pack the data as a continuous array of floats: [x1,y1,z1,x2,y2,z2,...]
-            var floatArray = [Float]()
-            floatArray.reserveCapacity(points.count * 3)
-            
-            for point in points {
-                floatArray.append(point.x)
-                floatArray.append(point.y)
-                floatArray.append(point.z)
+            // Hand the SIMD3<Float> storage to Draco directly, the stride skips the padding
+            let didSetData = points.withUnsafeBytes { rawBuffer -> Bool in
+                guard let baseAddress = rawBuffer.baseAddress else { return false }
+                return pointCloud.setFloatAttributeData(positionAttId, bytes: baseAddress, count: points.count, byteStride: MemoryLayout<SIMD3<Float>>.stride)
             }
-            
-            // Convert to NSData
-            let pointData = NSData(bytes: floatArray, length: floatArray.count * MemoryLayout<Float>.size)
-            
-            // Set the attribute values using our simplified method
-            if !pointCloud.setFloatAttributeData(positionAttId, data: pointData as Data) {
+            if !didSetData {
                 print("Failed to set point data")
                 return
             }
@@ -129,34 +119,48 @@ extension VideoRecordingView {
     
     // Data structure to store frames for PLY video recording
     class PLYVideoBuffer {
-        var frames: [(timestamp: Date, points: [SIMD3<Float>])] = []
-        var encodedFrames: [(timestamp: Date, data: Data)] = []
         var isRecording = false
         var recordingStartTime: Date?
         var timer: Timer?
-        var outputDirectory: URL?
+        var outputURL: URL?
+        private var sequenceWriter: DracoFrameSequenceWriter?
         var frameCount = 0
         
         // Size tracking variables
         var totalUnencodedBytes: UInt64 = 0
         var totalEncodedBytes: UInt64 = 0
         var compressionRatios: [Double] = []
+        // Raw size of the frames that are still being encoded, by timestamp
+        private var pendingFrameSizes: [TimeInterval: UInt64] = [:]
+        
+        // Frames are encoded on a pool of worker threads with a bounded queue,
+        // the encoded frames are appended to the sequence file in capture order.
+        // When encoding falls behind, the oldest waiting frame is dropped instead
+        // of buffering frames without limit
+        private let encodeQueue = DispatchQueue(label: "PLYVideoBuffer.encode", qos: .userInitiated)
+        private var pipeline: DracoEncodingPipeline?
+        private let encodeWorkers = 2
+        private let encodeQueueCapacity = 4
+        
+        // With temporal coding only every keyFrameInterval-th frame is stored in
+        // full, the frames in between are coded as changes to the previous frame
+        var useTemporalCodec = true
+        private let keyFrameInterval: Int32 = 25
         
         func startRecording() {
             isRecording = true
-            frames = []
-            encodedFrames = []
             frameCount = 0
             
             // Reset size tracking
             totalUnencodedBytes = 0
             totalEncodedBytes = 0
             compressionRatios = []
+            pendingFrameSizes = [:]
             
             recordingStartTime = Date()
             
-            // Create output directory
-            createOutputDirectory()
+            // Create the output sequence file
+            createOutputFile()
             
             // Set up timer to capture frames at regular intervals
             timer = Timer.scheduledTimer(withTimeInterval: 1.0/25.0, repeats: true) { [weak self] _ in
@@ -169,78 +173,119 @@ extension VideoRecordingView {
             timer?.invalidate()
             timer = nil
             
-            // Save metadata after stopping recording
-            saveMetadata()
-            
-            // Report compression statistics
-            reportCompressionStats()
-            
-            // Calculate and display size
-            calculateAndDisplaySize()
+            // Finish the sequence file once all pending frames have been written
+            let pipeline = self.pipeline
+            self.pipeline = nil
+            encodeQueue.async {
+                if let pipeline = pipeline {
+                    pipeline.close()
+                    print("Encoding pipeline: dropped \(pipeline.numDroppedFrames()) frames, " +
+                          "queue \(String(format: "%.1f", pipeline.averageQueueLatency() * 1000)) ms, " +
+                          "encode \(String(format: "%.1f", pipeline.averageEncodeLatency() * 1000)) ms, " +
+                          "reorder \(String(format: "%.1f", pipeline.averageReorderLatency() * 1000)) ms, " +
+                          "write \(String(format: "%.1f", pipeline.averageWriteLatency() * 1000)) ms")
+                }
+                
+                // The statistics are complete once all frames were written
+                DispatchQueue.main.async {
+                    self.pendingFrameSizes = [:]
+                    let metadata = self.makeMetadata()
+                    self.encodeQueue.async {
+                        self.finishOutputFile(metadata: metadata)
+                        
+                        DispatchQueue.main.async {
+                            // Report compression statistics
+                            self.reportCompressionStats()
+                            
+                            // Calculate and display size
+                            self.calculateAndDisplaySize()
+                        }
+                    }
+                }
+            }
         }
         
-        private func createOutputDirectory() {
+        private func createOutputFile() {
             let fileManager = FileManager.default
             guard let documentsDirectory = fileManager.urls(for: .documentDirectory, in: .userDomainMask).first else {
                 print("Could not access documents directory")
                 return
             }
             
-            // Create a directory for Draco-encoded frames
+            // All frames of the recording go into a single Draco sequence file
             let dateFormatter = DateFormatter()
             dateFormatter.dateFormat = "yyyyMMdd_HHmmss"
             let timestamp = dateFormatter.string(from: Date())
-            let drcDirName = "plyVideo_\(timestamp).drcpack"
-            var drcDirURL = documentsDirectory.appendingPathComponent(drcDirName)
+            let drcFileName = "plyVideo_\(timestamp).drcseq"
+            let drcFileURL = documentsDirectory.appendingPathComponent(drcFileName)
+            
+            let temporal = useTemporalCodec
+            guard let writer = DracoFrameSequenceWriter(path: drcFileURL.path,
+                                                        frameRate: 25.0,
+                                                        codec: temporal ? .sequence : .draco) else {
+                print("Error creating output file: \(drcFileURL.path)")
+                return
+            }
             
-            do {
-                // Create directory
-                try fileManager.createDirectory(at: drcDirURL, withIntermediateDirectories: true, attributes: nil)
-                
-                // Set package bit to make it appear as a package/bundle
-                var resourceValues = URLResourceValues()
-                resourceValues.isPackage = true
-                try drcDirURL.setResourceValues(resourceValues)
-                
-                outputDirectory = drcDirURL
-                print("Created output directory: \(drcDirURL.path)")
-            } catch {
-                print("Error creating output directory: \(error)")
+            // The writer is used by the writer thread of the pipeline while
+            // recording and from the encode queue afterwards
+            encodeQueue.sync {
+                self.sequenceWriter = writer
             }
+            pipeline = DracoEncodingPipeline(workers: encodeWorkers,
+                                             queueCapacity: encodeQueueCapacity,
+                                             queuePolicy: .dropOldest,
+                                             temporalPrediction: temporal,
+                                             keyFrameInterval: keyFrameInterval,
+                                             quantizationBits: 11) { [weak self] data, timestamp, keyFrame in
+                guard let self = self else { return false }
+                return self.writeEncodedFrame(data, timestamp: timestamp, keyFrame: keyFrame, writer: writer)
+            }
+            outputURL = drcFileURL
+            print("Created output file: \(drcFileURL.path)")
         }
         
-        private func saveMetadata() {
-            guard let outputDirectory = outputDirectory else { return }
+        private func makeMetadata() -> Data? {
+            // Create metadata stored with the sequence
+            let dateFormatter = DateFormatter()
+            dateFormatter.dateFormat = "yyyyMMdd_HHmmss"
+            let timestamp = dateFormatter.string(from: Date())
             
-            do {
-                // Create metadata file
-                let dateFormatter = DateFormatter()
-                dateFormatter.dateFormat = "yyyyMMdd_HHmmss"
-                let timestamp = dateFormatter.string(from: Date())
-                
-                let metadata: [String: Any] = [
-                    "frameCount": frameCount,
-                    "recordingDate": timestamp,
-                    "frameRate": 25.0, // 25 frames per second
-                    "compressionStats": [
-                        "totalUnencodedBytes": totalUnencodedBytes,
-                        "totalEncodedBytes": totalEncodedBytes,
-                        "avgCompressionRatio": compressionRatios.isEmpty ? 0 : compressionRatios.reduce(0, +) / Double(compressionRatios.count)
-                    ]
+            let metadata: [String: Any] = [
+                "frameCount": frameCount,
+                "recordingDate": timestamp,
+                "frameRate": 25.0, // 25 frames per second
+                "compressionStats": [
+                    "totalUnencodedBytes": totalUnencodedBytes,
+                    "totalEncodedBytes": totalEncodedBytes,
+                    "avgCompressionRatio": compressionRatios.isEmpty ? 0 : compressionRatios.reduce(0, +) / Double(compressionRatios.count)
                 ]
-                
-                let metadataData = try JSONSerialization.data(withJSONObject: metadata, options: .prettyPrinted)
-                
-                // Save metadata
-                let drcMetadataURL = outputDirectory.appendingPathComponent("metadata.json")
-                try metadataData.write(to: drcMetadataURL)
-                
-                print("Metadata saved with \(frameCount) frames")
+            ]
+            
+            do {
+                return try JSONSerialization.data(withJSONObject: metadata, options: .prettyPrinted)
             } catch {
-                print("Error saving metadata: \(error)")
+                print("Error creating metadata: \(error)")
+                return nil
             }
         }
         
+        // Must be called on the encode queue
+        private func finishOutputFile(metadata: Data?) {
+            guard let writer = sequenceWriter else { return }
+            
+            if let metadata = metadata {
+                writer.setMetadata(metadata)
+            }
+            let numFrames = writer.numFrames()
+            if writer.finish() {
+                print("Sequence file finished with \(numFrames) frames")
+            } else {
+                print("Error finishing sequence file")
+            }
+            sequenceWriter = nil
+        }
+        
         private func reportCompressionStats() {
             guard frameCount > 0 else { return }
             
@@ -260,12 +305,13 @@ extension VideoRecordingView {
         }
         
         private func calculateAndDisplaySize() {
-            guard let outputDirectory = outputDirectory else { return }
+            guard let outputURL = outputURL else { return }
             
             DispatchQueue.global(qos: .userInitiated).async {
                 do {
-                    // Calculate directory size directly
-                    let fileSizeBytes = try self.calculateDirectorySize(directory: outputDirectory)
+                    // Get the size of the sequence file
+                    let attributes = try FileManager.default.attributesOfItem(atPath: outputURL.path)
+                    let fileSizeBytes = (attributes[.size] as? NSNumber)?.uint64Value ?? 0
                     let fileSizeMB = Double(fileSizeBytes) / (1024.0 * 1024.0)
                     print("Total bundle size: \(fileSizeMB) MB")
                     
@@ -283,7 +329,7 @@ extension VideoRecordingView {
                            let rootViewController = windowScene.windows.first?.rootViewController {
                             let alert = UIAlertController(
                                 title: "PLY Video Saved",
-                                message: "The Draco-encoded PLY video has been saved to:\n\(outputDirectory.lastPathComponent)\nTotal size: \(String(format: "%.2f", fileSizeMB)) MB\(compressionInfo)",
+                                message: "The Draco-encoded PLY video has been saved to:\n\(outputURL.lastPathComponent)\nTotal size: \(String(format: "%.2f", fileSizeMB)) MB\(compressionInfo)",
                                 preferredStyle: .alert
                             )
                             alert.addAction(UIAlertAction(title: "OK", style: .default))
@@ -296,138 +342,54 @@ extension VideoRecordingView {
             }
         }
         
-        // Helper to calculate directory size
-        private func calculateDirectorySize(directory: URL) throws -> UInt64 {
-            let fileManager = FileManager.default
-            let resourceKeys: [URLResourceKey] = [.fileSizeKey, .isDirectoryKey]
-            
-            // Get the directory contents
-            let directoryContents = try fileManager.contentsOfDirectory(at: directory, includingPropertiesForKeys: resourceKeys, options: [])
-            
-            // Sum up the file sizes
-            var totalSize: UInt64 = 0
-            for fileURL in directoryContents {
-                let resourceValues = try fileURL.resourceValues(forKeys: Set(resourceKeys))
-                
-                if let isDirectory = resourceValues.isDirectory, isDirectory {
-                    // Recursively get the size of subdirectories
-                    totalSize += try calculateDirectorySize(directory: fileURL)
-                } else if let fileSize = resourceValues.fileSize {
-                    totalSize += UInt64(fileSize)
-                }
-            }
-            
-            return totalSize
-        }
-        
         func addFrame(points: [SIMD3<Float>]) {
-            if isRecording {
-                frames.append((timestamp: Date(), points: points))
-                
-                // Encode the frame immediately in a background thread
-                encodeFrameInBackground(timestamp: Date(), points: points)
+            guard isRecording, let pipeline = pipeline, !points.isEmpty else { return }
+            let now = Date()
+            let frameTime = now.timeIntervalSince(recordingStartTime ?? now)
+            
+            // The pipeline copies the SIMD3<Float> storage, the stride skips the padding
+            let accepted = points.withUnsafeBytes { rawBuffer -> Bool in
+                guard let baseAddress = rawBuffer.baseAddress else { return false }
+                return pipeline.submitPositions(baseAddress, count: points.count,
+                                                byteStride: MemoryLayout<SIMD3<Float>>.stride,
+                                                timestamp: frameTime)
+            }
+            if accepted {
+                // Calculate unencoded size (3 floats per point * 4 bytes per float)
+                pendingFrameSizes[frameTime] = UInt64(points.count * 3 * MemoryLayout<Float>.size)
+            } else {
+                print("Encoder is busy, frame dropped (queue depth \(pipeline.queueDepth()))")
             }
         }
         
-        private func encodeFrameInBackground(timestamp: Date, points: [SIMD3<Float>]) {
-            guard let outputDirectory = outputDirectory else { return }
-            
-            DispatchQueue.global(qos: .userInitiated).async {
-                // Create a Draco point cloud object
-                let pointCloud = DracoPointCloud()
-                
-                // Set the number of points
-                pointCloud.setNumPoints(points.count)
-                
-                // Calculate unencoded size (3 floats per point * 4 bytes per float)
-                let unencodedSize = UInt64(points.count * 3 * MemoryLayout<Float>.size)
-                
-                // Add a position attribute (GeometryAttribute::POSITION = 0, DataType::DT_FLOAT32 = 9)
-                let positionAttId = pointCloud.addAttribute(withType: 0, dataType: 9, numComponents: 3, normalized: false)
-                
-                // Convert points to flat array
-                var floatArray = [Float]()
-                floatArray.reserveCapacity(points.count * 3)
-                
-                for point in points {
-                    floatArray.append(point.x)
-                    floatArray.append(point.y)
-                    floatArray.append(point.z)
-                }
-                
-                // Convert to Data
-                let pointData = NSData(bytes: floatArray, length: floatArray.count * MemoryLayout<Float>.size)
-                
-                // Set the attribute values
-                if !pointCloud.setFloatAttributeData(positionAttId, data: pointData as Data) {
-                    print("Failed to set point data for streaming frame")
-                    return
-                }
-                
-                // Create an encoder
-                let encoder = DracoEncoder()
-                
-                // Apply dynamic compression settings based on point count
-                // For dense point clouds, we can use more aggressive compression
-                let pointCount = points.count
-                
-                if pointCount < 5000 {
-                    // For smaller point clouds, use lighter compression to preserve detail
-                    encoder.setSpeedOptions(5, decodingSpeed: 9)
-                    encoder.setAttributeQuantization(0, bits: 12)
-                } else if pointCount < 20000 {
-                    // Medium point clouds get more compression
-                    encoder.setSpeedOptions(4, decodingSpeed: 8)
-                    encoder.setAttributeQuantization(0, bits: 11)
-                } else {
-                    // Large point clouds get the most aggressive compression
-                    encoder.setSpeedOptions(3, decodingSpeed: 7)
-                    encoder.setAttributeQuantization(0, bits: 10)
-                }
+        // Called on the writer thread of the pipeline in capture order
+        // The data is only valid during the call
+        private func writeEncodedFrame(_ encodedData: Data, timestamp frameTime: TimeInterval,
+                                       keyFrame: Bool, writer: DracoFrameSequenceWriter) -> Bool {
+            let encodedSize = UInt64(encodedData.count)
+            let saved = writer.appendFrame(encodedData, timestamp: frameTime, keyFrame: keyFrame)
+            
+            DispatchQueue.main.async {
+                let currentFrameIndex = self.frameCount
+                self.frameCount += 1
                 
-                // Encode the point cloud
-                if let encodedData = encoder.encode(pointCloud) {
-                    // Calculate encoded size
-                    let encodedSize = UInt64(encodedData.count)
-                    
-                    // Calculate compression ratio
+                // Update totals (on the main thread to avoid race conditions)
+                if let unencodedSize = self.pendingFrameSizes.removeValue(forKey: frameTime) {
                     let compressionRatio = Double(unencodedSize) / Double(encodedSize)
-                    
-                    // Update totals (synchronized to avoid race conditions)
-                    DispatchQueue.main.async {
-                        self.totalUnencodedBytes += unencodedSize
-                        self.totalEncodedBytes += encodedSize
-                        self.compressionRatios.append(compressionRatio)
-                    }
-                    
-                    // Log compression settings and results
-                    let compressionLevel = pointCount < 5000 ? "Light (12-bit)" : 
-                                          pointCount < 20000 ? "Medium (11-bit)" : "Heavy (10-bit)"
-                    
-                    print("Frame \(self.frameCount): Points: \(points.count), Quantization: \(compressionLevel)")
+                    self.totalUnencodedBytes += unencodedSize
+                    self.compressionRatios.append(compressionRatio)
+                    print("Frame \(currentFrameIndex): \(keyFrame ? "key frame" : "predicted")")
                     print("  Size: Unencoded: \(unencodedSize/1024) KB → Encoded: \(encodedSize/1024) KB, Ratio: \(String(format: "%.2f", compressionRatio))x")
-                    
-                    // Save the encoded data
-                    self.encodedFrames.append((timestamp: timestamp, data: encodedData))
-                    
-                    // Get current frame number
-                    let currentFrameIndex = self.frameCount
-                    self.frameCount += 1
-                    
-                    // Save to file immediately
-                    let drcFrameFileName = String(format: "frame_%04d.drc", currentFrameIndex)
-                    let drcFrameFileURL = outputDirectory.appendingPathComponent(drcFrameFileName)
-                    
-                    do {
-                        try encodedData.write(to: drcFrameFileURL)
-                        print("Streamed frame \(currentFrameIndex) saved")
-                    } catch {
-                        print("Error saving streamed frame \(currentFrameIndex): \(error)")
-                    }
+                }
+                self.totalEncodedBytes += encodedSize
+                
+                if saved {
+                    print("Streamed frame \(currentFrameIndex) saved")
                 } else {
-                    print("Failed to encode streaming frame")
+                    print("Error saving streamed frame \(currentFrameIndex)")
                 }
             }
+            return saved
         }
         
         func requestFrame() {
@@ -465,8 +427,9 @@ extension VideoRecordingView {
     // Load a Draco encoded point cloud file and convert it to an array of SIMD3<Float> points
     func loadDracoPointCloudFromFile(url: URL) -> [SIMD3<Float>]? {
         do {
-            // Read the file data
-            let dracoData = try Data(contentsOf: url)
+            // Map the file instead of reading it into memory, the decoder
+            // still builds a new point cloud from the mapped data
+            let dracoData = try Data(contentsOf: url, options: .mappedIfSafe)
             
             // Create decoder
             let decoder = DracoDecoder()
@@ -495,29 +458,20 @@ extension VideoRecordingView {
             let boundingBox = pointCloud.computeBoundingBox()
             print("Point cloud bounding box: \(boundingBox)")
             
-            // Get the position data from the point cloud
-            guard let positionData = pointCloud.getPositionData() else {
-                print("Failed to extract position data from point cloud")
-                return nil
-            }
-            
-            // Convert the raw float data to an array of SIMD3<Float>
-            let floatValues = positionData.withUnsafeBytes { rawBuffer -> [Float] in
-                guard let floatBuffer = rawBuffer.baseAddress?.assumingMemoryBound(to: Float.self) else {
-                    return []
+            // Copy the positions straight into the SIMD3<Float> array
+            let points = [SIMD3<Float>](unsafeUninitializedCapacity: numPoints) { buffer, initializedCount in
+                guard let baseAddress = buffer.baseAddress else {
+                    initializedCount = 0
+                    return
                 }
-                return Array(UnsafeBufferPointer(start: floatBuffer, count: positionData.count / MemoryLayout<Float>.size))
+                let copied = pointCloud.copyPositions(to: baseAddress,
+                                                      capacity: numPoints,
+                                                      byteStride: MemoryLayout<SIMD3<Float>>.stride)
+                initializedCount = max(copied, 0)
             }
-            
-            // Create SIMD3<Float> points from the float array
-            var points: [SIMD3<Float>] = []
-            points.reserveCapacity(numPoints)
-            
-            for i in stride(from: 0, to: floatValues.count, by: 3) {
-                if i + 2 < floatValues.count {
-                    let point = SIMD3<Float>(floatValues[i], floatValues[i+1], floatValues[i+2])
-                    points.append(point)
-                }
+            guard points.count == numPoints else {
+                print("Failed to extract position data from point cloud")
+                return nil
             }
             
             print("Successfully loaded \(points.count) points from Draco file")